@@ -9,7 +9,8 @@ BUILD_TYPE="Release"
 JOBS="${TT_WAVELET_BUILD_JOBS:-$(nproc)}"
 BOOTSTRAP=false
 TARGET=""
-ALL_TARGETS=(ttnn lwt ilwt lwt_2d ilwt_2d tt_wavelet_benchmark_runner)
+ALL_TARGETS=(ttnn lwt ilwt lwt_2d ilwt_2d tt_wavelet_benchmark_runner tt_wavelet_planner_benchmark
+  tt_wavelet_planner_what_if)
 
 usage() {
   cat <<'EOF'
@@ -23,7 +24,8 @@ and all standalone tt-wavelet executables in build/.
   --type TYPE      CMake build type (default: Release)
   --target TARGET  Build one target; equivalent to passing TARGET positionally
 
-Targets: ttnn, lwt, ilwt, lwt_2d, ilwt_2d, tt_wavelet_benchmark_runner
+Targets: ttnn, lwt, ilwt, lwt_2d, ilwt_2d, tt_wavelet_benchmark_runner,
+         tt_wavelet_planner_benchmark, tt_wavelet_planner_what_if
 Without a target, builds all targets above.
 EOF
 }
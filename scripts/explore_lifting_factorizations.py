@@ -0,0 +1,469 @@
+#!/usr/bin/env python3
+"""Search alternative lifting factorizations of a JSON wavelet scheme.
+
+The polyphase matrix of a scheme, including its input delays, is rebuilt
+from the JSON steps and factored again by Euclidean division of one column.
+Every division may cancel any mix of leading and trailing terms, so each
+step offers several quotients; a beam search walks those choices. Each
+complete factorization is checked to reproduce the canonical outputs of
+the original scheme, scored with the planner cost model (routes, chunk
+dependency overhead, widest step) and the fp32 round-trip error, and the
+best one can be written as JSON for generate_static_schemes.py.
+"""
+
+import argparse
+import json
+import struct
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+
+from generate_static_schemes import (
+    DEFAULT_JSON_DIR,
+    STEP_COEFF_CAPACITY,
+    RawStep,
+    apply_raw_steps,
+    f32_bits,
+    f32_value,
+    parse_coeff,
+)
+
+# Output samples per chunk stream in the planner's dependency-overhead
+# estimate: kLwtGroupOutputElements, one device output group.
+GROUP_OUTPUT_ELEMENTS = 1536
+TEST_SIGNAL_LENGTH = 96
+
+# Laurent polynomial: delay exponent d -> coefficient of z^-d.
+Poly = dict[int, float]
+Matrix = list[list[Poly]]
+
+
+@dataclass(frozen=True)
+class Factorization:
+    delay_even: int
+    delay_odd: int
+    steps: tuple[RawStep, ...]
+
+
+@dataclass(frozen=True)
+class Score:
+    routes: int
+    max_k: int
+    dependency_overhead: float
+    fp32_error: float
+
+    def key(self) -> tuple[int, float, int, float]:
+        return (self.routes, self.dependency_overhead, self.max_k, self.fp32_error)
+
+
+def f32(value: float) -> float:
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def load_raw_scheme(path: Path) -> tuple[dict, Factorization]:
+    obj = json.loads(path.read_text(encoding="utf-8"))
+    steps = tuple(
+        RawStep(
+            kind=raw["type"],
+            shift=int(raw["shift"]),
+            coefficients=tuple(parse_coeff(c) for c in raw.get("coefficients", [])),
+        )
+        for raw in obj["steps"]
+    )
+    return obj, Factorization(
+        delay_even=int(obj["delay"]["even"]),
+        delay_odd=int(obj["delay"]["odd"]),
+        steps=steps,
+    )
+
+
+def poly_axpy(target: Poly, scale: float, poly: Poly, delay: int = 0) -> None:
+    """target += scale * z^-delay * poly."""
+    for d, c in poly.items():
+        target[d + delay] = target.get(d + delay, 0.0) + scale * c
+
+
+def poly_mul(lhs: Poly, rhs: Poly) -> Poly:
+    result: Poly = {}
+    for d, c in lhs.items():
+        poly_axpy(result, c, rhs, d)
+    return result
+
+
+def poly_trim(poly: Poly, tolerance: float) -> Poly:
+    return {d: c for d, c in poly.items() if abs(c) > tolerance}
+
+
+def poly_width(poly: Poly) -> int:
+    return max(poly) - min(poly)
+
+
+def step_poly(step: RawStep) -> Poly:
+    return {step.shift + j: c for j, c in enumerate(step.coefficients)}
+
+
+def polyphase_matrix(factorization: Factorization) -> Matrix:
+    """Matrix mapping the split input streams to the final even/odd streams.
+
+    A stream x is the series sum_p x[p] z^-p over sample positions, so the
+    input delays and every step's shift become powers of z.
+    """
+    matrix: Matrix = [
+        [{factorization.delay_even: 1.0}, {}],
+        [{}, {factorization.delay_odd: 1.0}],
+    ]
+    for step in factorization.steps:
+        if step.kind == "swap":
+            matrix.reverse()
+        elif step.kind in {"scale-even", "scale-odd"}:
+            row = matrix[0 if step.kind == "scale-even" else 1]
+            for col in range(2):
+                row[col] = {d: c * step.coefficients[0] for d, c in row[col].items()}
+        else:
+            target, source = (1, 0) if step.kind == "predict" else (0, 1)
+            filt = step_poly(step)
+            for col in range(2):
+                poly_axpy(matrix[target][col], 1.0, poly_mul(filt, matrix[source][col]))
+    return matrix
+
+
+def divide(dividend: Poly, divisor: Poly, low_terms: int, tolerance: float):
+    """Quotient cancelling `low_terms` lowest and the remaining excess top terms.
+
+    The remainder keeps poly_width(divisor) consecutive terms of the
+    dividend's span; a quotient that cancels the whole dividend early
+    returns an empty remainder.
+    """
+    remainder = dict(dividend)
+    quotient: Poly = {}
+    lo, hi = min(divisor), max(divisor)
+    total = poly_width(dividend) - poly_width(divisor) + 1
+    for index in range(total):
+        if not remainder:
+            break
+        d = min(remainder) if index < low_terms else max(remainder)
+        pivot = lo if index < low_terms else hi
+        factor = remainder[d] / divisor[pivot]
+        quotient[d - pivot] = quotient.get(d - pivot, 0.0) + factor
+        poly_axpy(remainder, -factor, divisor, d - pivot)
+        remainder.pop(d, None)
+        remainder = poly_trim(remainder, tolerance)
+    return poly_trim(quotient, tolerance), remainder
+
+
+def lift_rows(matrix: Matrix, target: int, filt: Poly, tolerance: float) -> Matrix:
+    """Undo a lifting step: row[target] -= filt * row[1 - target]."""
+    result = [[dict(p) for p in row] for row in matrix]
+    for col in range(2):
+        poly_axpy(result[target][col], -1.0, poly_mul(filt, matrix[1 - target][col]))
+        result[target][col] = poly_trim(result[target][col], tolerance)
+    return result
+
+
+@dataclass
+class SearchState:
+    matrix: Matrix
+    # Lifting steps peeled off the end of the scheme, last-applied first.
+    peeled: list[tuple[str, Poly]]
+
+
+def finish(state: SearchState, column: int, tolerance: float) -> Factorization | None:
+    """Turn a state whose `column` has one zero entry into a factorization.
+
+    With rows swapped if needed, the rest is [[u, v], [0, w]] = U(v / w) D
+    for column 0 or [[u, 0], [v, w]] = P(v / u) D for column 1, where
+    D = diag(u, w) must be monomials: the input delays and final scales.
+    """
+    matrix = state.matrix
+    zero_row = 1 if column == 0 else 0
+    tail: list[tuple[str, Poly]] = []
+    if matrix[zero_row][1 - zero_row]:
+        matrix = [matrix[1], matrix[0]]
+        tail.append(("swap", {}))
+    if matrix[zero_row][1 - zero_row]:
+        return None
+    diag = (matrix[0][0], matrix[1][1])
+    if len(diag[0]) != 1 or len(diag[1]) != 1:
+        return None
+    ((delay_even, scale_even),) = diag[0].items()
+    ((delay_odd, scale_odd),) = diag[1].items()
+    if column == 0:
+        kind, off, (pivot_delay, pivot_coeff) = "update", matrix[0][1], (delay_odd, scale_odd)
+    else:
+        kind, off, (pivot_delay, pivot_coeff) = "predict", matrix[1][0], (delay_even, scale_even)
+    inner: list[tuple[str, Poly]] = []
+    if off:
+        inner.append((kind, {d - pivot_delay: c / pivot_coeff for d, c in off.items()}))
+
+    # Time order: input delays, diag scales, inner step, optional swap, then
+    # the peeled steps in the order they were originally applied.
+    ordered = inner + tail + list(reversed(state.peeled))
+    scales = [scale_even, scale_odd]
+    steps: list[RawStep] = []
+    for kind, filt in ordered:
+        if kind == "swap":
+            scales.reverse()
+            steps.append(RawStep(kind="swap", shift=0, coefficients=()))
+            continue
+        # Moving diag(c, d) past a step rescales the step's filter.
+        ratio = scales[0] / scales[1] if kind == "predict" else scales[1] / scales[0]
+        filt = poly_trim({d: c * ratio for d, c in filt.items()}, tolerance)
+        if not filt:
+            continue
+        shift = min(filt)
+        coefficients = tuple(filt.get(shift + j, 0.0) for j in range(poly_width(filt) + 1))
+        steps.append(RawStep(kind=kind, shift=shift, coefficients=coefficients))
+    steps.append(RawStep(kind="scale-even", shift=0, coefficients=(scales[0],)))
+    steps.append(RawStep(kind="scale-odd", shift=0, coefficients=(scales[1],)))
+    return Factorization(delay_even=delay_even, delay_odd=delay_odd, steps=tuple(steps))
+
+
+def search(matrix: Matrix, beam: int, max_candidates: int, tolerance: float) -> list[Factorization]:
+    found: list[Factorization] = []
+    for column in range(2):
+        states = [SearchState(matrix=matrix, peeled=[])]
+        while states and len(found) < max_candidates:
+            expanded: list[SearchState] = []
+            for state in states:
+                top, bottom = state.matrix[0][column], state.matrix[1][column]
+                if not top or not bottom:
+                    factorization = finish(state, column, tolerance)
+                    if factorization is not None:
+                        found.append(factorization)
+                    continue
+                for target, dividend, divisor in ((0, top, bottom), (1, bottom, top)):
+                    if poly_width(dividend) < poly_width(divisor):
+                        continue
+                    excess = poly_width(dividend) - poly_width(divisor) + 1
+                    for low_terms in range(excess + 1):
+                        quotient, _ = divide(dividend, divisor, low_terms, tolerance)
+                        if not quotient or poly_width(quotient) + 1 > STEP_COEFF_CAPACITY:
+                            continue
+                        expanded.append(
+                            SearchState(
+                                matrix=lift_rows(state.matrix, target, quotient, tolerance),
+                                peeled=state.peeled
+                                + [("update" if target == 0 else "predict", quotient)],
+                            )
+                        )
+
+            def progress(state: SearchState) -> tuple[int, float]:
+                col = [state.matrix[0][column], state.matrix[1][column]]
+                width = sum(poly_width(p) + 1 for p in col if p)
+                largest = max(
+                    (abs(c) for _, filt in state.peeled for c in filt.values()), default=0.0
+                )
+                return (width, largest)
+
+            expanded.sort(key=progress)
+            states = expanded[:beam]
+    return found[:max_candidates]
+
+
+def test_streams(factorization: Factorization, tap_size: int):
+    padded = TEST_SIGNAL_LENGTH + 2 * (tap_size - 1)
+    signal = [((37 * n + 11) % 101) / 101.0 - 0.5 for n in range(padded)]
+    even = {factorization.delay_even + i: signal[2 * i] for i in range((padded + 1) // 2)}
+    odd = {factorization.delay_odd + i: signal[2 * i + 1] for i in range(padded // 2)}
+    return even, odd
+
+
+def canonical_positions(tap_size: int) -> range:
+    # Canonical output i sits at stream position (tap_size - 1 + 1) / 2 + i.
+    return range(tap_size // 2, tap_size // 2 + (TEST_SIGNAL_LENGTH + tap_size - 1) // 2)
+
+
+def reproduces(reference: Factorization, candidate: Factorization, tap_size: int) -> bool:
+    *expected, peak = apply_raw_steps(list(reference.steps), *test_streams(reference, tap_size))
+    *actual, _ = apply_raw_steps(list(candidate.steps), *test_streams(candidate, tap_size))
+    for lhs, rhs in zip(expected, actual):
+        for position in canonical_positions(tap_size):
+            if position not in rhs or abs(lhs[position] - rhs[position]) > 1e-9 * max(peak, 1.0):
+                return False
+    return True
+
+
+def apply_steps_f32(steps, even: dict[int, float], odd: dict[int, float]):
+    """apply_raw_steps with fp32 coefficients and every product and sum rounded."""
+    for step in steps:
+        coefficients = [f32(c) for c in step.coefficients]
+        if step.kind == "swap":
+            even, odd = odd, even
+        elif step.kind == "scale-even":
+            even = {n: f32(v * coefficients[0]) for n, v in even.items()}
+        elif step.kind == "scale-odd":
+            odd = {n: f32(v * coefficients[0]) for n, v in odd.items()}
+        else:
+            source, base = (even, odd) if step.kind == "predict" else (odd, even)
+            output: dict[int, float] = {}
+            for n, value in base.items():
+                taps = [n - step.shift - j for j in range(len(coefficients))]
+                if all(tap in source for tap in taps):
+                    for coeff, tap in zip(coefficients, taps):
+                        value = f32(value + f32(coeff * source[tap]))
+                    output[n] = value
+            if step.kind == "predict":
+                odd = output
+            else:
+                even = output
+    return even, odd
+
+
+def inverse_raw_steps(steps: tuple[RawStep, ...]) -> list[RawStep]:
+    inverse: list[RawStep] = []
+    for step in reversed(steps):
+        if step.kind in {"predict", "update"}:
+            coefficients = tuple(-c for c in step.coefficients)
+        elif step.kind in {"scale-even", "scale-odd"}:
+            coefficients = (f32_value(f32_bits(1.0 / f32(step.coefficients[0]))),)
+        else:
+            coefficients = ()
+        inverse.append(RawStep(kind=step.kind, shift=step.shift, coefficients=coefficients))
+    return inverse
+
+
+def fp32_round_trip_error(factorization: Factorization, tap_size: int) -> float:
+    even, odd = test_streams(factorization, tap_size)
+    forward = apply_steps_f32(factorization.steps, dict(even), dict(odd))
+    restored = apply_steps_f32(inverse_raw_steps(factorization.steps), *forward)
+    error = 0.0
+    for original, result in zip((even, odd), restored):
+        for position, value in result.items():
+            error = max(error, abs(value - original[position]))
+    return error
+
+
+def dependency_overhead(factorization: Factorization) -> float:
+    """Initial cone over outputs for one interior chunk of one output group."""
+    need = [(0, GROUP_OUTPUT_ELEMENTS), (0, GROUP_OUTPUT_ELEMENTS)]
+    for step in reversed(factorization.steps):
+        if step.kind == "swap":
+            need.reverse()
+        elif step.kind in {"predict", "update"}:
+            target, source = (1, 0) if step.kind == "predict" else (0, 1)
+            lo, hi = need[target]
+            k = len(step.coefficients)
+            src_lo, src_hi = need[source]
+            need[source] = (min(src_lo, lo - step.shift - (k - 1)), max(src_hi, hi - step.shift))
+    cone = sum(hi - lo for lo, hi in need)
+    return (cone - 2 * GROUP_OUTPUT_ELEMENTS) / (2 * GROUP_OUTPUT_ELEMENTS)
+
+
+def score(factorization: Factorization, tap_size: int) -> Score:
+    lifting = [s for s in factorization.steps if s.kind in {"predict", "update"}]
+    return Score(
+        routes=len(lifting),
+        max_k=max((len(s.coefficients) for s in lifting), default=0),
+        dependency_overhead=dependency_overhead(factorization),
+        fp32_error=fp32_round_trip_error(factorization, tap_size),
+    )
+
+
+def to_json(obj: dict, factorization: Factorization, result: Score, source: str) -> dict:
+    kinds = {"predict", "update", "scale-even", "scale-odd"}
+    return {
+        "tap_size": obj["tap_size"],
+        "delay": {"even": factorization.delay_even, "odd": factorization.delay_odd},
+        "steps": [
+            {"type": step.kind, "shift": step.shift, "coefficients": list(step.coefficients)}
+            if step.kind in kinds
+            else {"type": step.kind, "shift": step.shift}
+            for step in factorization.steps
+        ],
+        "meta": {
+            "explorer": {
+                "source": source,
+                "routes": result.routes,
+                "max_k": result.max_k,
+                "dependency_overhead": result.dependency_overhead,
+                "fp32_round_trip_error": result.fp32_error,
+            }
+        },
+    }
+
+
+def parse_args(argv: list[str]) -> argparse.Namespace:
+    parser = argparse.ArgumentParser(
+        description="Search alternative lifting factorizations of one JSON wavelet scheme."
+    )
+    parser.add_argument("wavelet", help="Scheme name, e.g. db4, or a path to its JSON file.")
+    parser.add_argument("--json-dir", type=Path, default=DEFAULT_JSON_DIR)
+    parser.add_argument("--beam", type=int, default=32)
+    parser.add_argument("--max-candidates", type=int, default=64)
+    parser.add_argument(
+        "--max-error-ratio",
+        type=float,
+        default=4.0,
+        help="Reject candidates whose fp32 round-trip error exceeds this multiple "
+        "of the original's.",
+    )
+    parser.add_argument("--top", type=int, default=8, help="Candidates to list.")
+    parser.add_argument("--output", type=Path, help="Write the best factorization here as JSON.")
+    return parser.parse_args(argv)
+
+
+def main(argv: list[str] | None = None) -> int:
+    args = parse_args(sys.argv[1:] if argv is None else argv)
+    path = Path(args.wavelet)
+    if not path.suffix:
+        path = args.json_dir / f"{args.wavelet}.json"
+    obj, original = load_raw_scheme(path)
+    tap_size = int(obj["tap_size"])
+
+    matrix = polyphase_matrix(original)
+    magnitude = max(abs(c) for row in matrix for poly in row for c in poly.values())
+    tolerance = 1e-12 * max(magnitude, 1.0)
+    matrix = [[poly_trim(poly, tolerance) for poly in row] for row in matrix]
+
+    baseline = score(original, tap_size)
+    candidates = [(baseline, original, "original")]
+    rejected = 0
+    seen: set[tuple] = set()
+    for factorization in search(matrix, args.beam, args.max_candidates, tolerance):
+        signature = (
+            factorization.delay_even,
+            factorization.delay_odd,
+            tuple(
+                (step.kind, step.shift, tuple(f32_bits(c) for c in step.coefficients))
+                for step in factorization.steps
+            ),
+        )
+        if signature in seen:
+            continue
+        seen.add(signature)
+        if not reproduces(original, factorization, tap_size):
+            rejected += 1
+            continue
+        result = score(factorization, tap_size)
+        if result.max_k > STEP_COEFF_CAPACITY:
+            rejected += 1
+            continue
+        if result.fp32_error > args.max_error_ratio * max(baseline.fp32_error, 1e-9):
+            rejected += 1
+            continue
+        candidates.append((result, factorization, "search"))
+
+    candidates.sort(key=lambda entry: entry[0].key())
+    print(
+        f"{path.stem}: {len(candidates) - 1} valid factorizations, {rejected} rejected "
+        f"(routes, dependency overhead, max k, fp32 round-trip error)"
+    )
+    listed = candidates[: args.top]
+    if all(origin != "original" for _, _, origin in listed):
+        listed.append((baseline, original, "original"))
+    for result, _, origin in listed:
+        print(
+            f"  {origin:8s} routes={result.routes:3d} overhead={result.dependency_overhead:.5f} "
+            f"max_k={result.max_k:2d} error={result.fp32_error:.3e}"
+        )
+    best_score, best, _ = candidates[0]
+    if args.output is not None:
+        args.output.write_text(
+            json.dumps(to_json(obj, best, best_score, path.stem)) + "\n", encoding="utf-8"
+        )
+        print(f"Wrote {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
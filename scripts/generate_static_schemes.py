@@ -1,12 +1,14 @@
 #!/usr/bin/env python3
 import argparse
 import json
+import math
+import os
 import re
 import struct
 import sys
 from dataclasses import dataclass
 from pathlib import Path
-from typing import Any
+from typing import Any, Callable
 
 SCRIPT_DIR = Path(__file__).resolve().parent
 REPO_ROOT = SCRIPT_DIR.parent
@@ -15,6 +17,19 @@ DEFAULT_SCHEME_DIR = (
     REPO_ROOT / "tt-wavelet" / "tt_wavelet" / "include" / "schemes" / "generated"
 )
 DEFAULT_REGISTRY = DEFAULT_SCHEME_DIR / "registry.hpp"
+STATIC_SCHEME_HEADER = (
+    REPO_ROOT
+    / "tt-wavelet"
+    / "tt_wavelet"
+    / "include"
+    / "lifting"
+    / "static_scheme.hpp"
+)
+# Compute kernels include their scheme header relative to this directory.
+KERNEL_DIR = REPO_ROOT / "tt-wavelet" / "kernels" / "compute"
+
+# Long enough for the widest scheme's support to reach well past both edges.
+PRUNE_SIGNAL_LENGTH = 384
 
 STEP_TYPES = {
     "predict": "StepType::kPredict",
@@ -65,6 +80,165 @@ def f32_value(bits: int) -> float:
     return struct.unpack("<f", struct.pack("<I", bits))[0]
 
 
+@dataclass(frozen=True)
+class RawStep:
+    kind: str
+    shift: int
+    coefficients: tuple[float, ...]
+
+
+def apply_raw_steps(
+    steps: list[RawStep], even: dict[int, float], odd: dict[int, float]
+) -> tuple[dict[int, float], dict[int, float]]:
+    """Run lifting steps over sparse streams keyed by sample position.
+
+    An output exists only where its base sample and every source tap do,
+    as the planner's route geometry keeps only fully supported samples.
+    """
+    for step in steps:
+        if step.kind == "swap":
+            even, odd = odd, even
+        elif step.kind == "scale-even":
+            even = {n: value * step.coefficients[0] for n, value in even.items()}
+        elif step.kind == "scale-odd":
+            odd = {n: value * step.coefficients[0] for n, value in odd.items()}
+        else:
+            source, base = (even, odd) if step.kind == "predict" else (odd, even)
+            output: dict[int, float] = {}
+            for n, value in base.items():
+                taps = [n - step.shift - j for j in range(len(step.coefficients))]
+                if all(tap in source for tap in taps):
+                    output[n] = value + sum(
+                        coeff * source[tap]
+                        for coeff, tap in zip(step.coefficients, taps)
+                    )
+            if step.kind == "predict":
+                odd = output
+            else:
+                even = output
+    return even, odd
+
+
+def symmetric_index(index: int, length: int) -> int:
+    phase = index % (2 * length)
+    return phase if phase < length else 2 * length - 1 - phase
+
+
+def forward_transform(
+    steps: list[RawStep],
+    tap_size: int,
+    delay_even: int,
+    delay_odd: int,
+    signal: list[float],
+) -> tuple[list[float], list[float]]:
+    """Forward DWT of `signal` with symmetric extension, as the planner runs it.
+
+    The signal is padded by tap_size - 1 samples on both sides and split into
+    even/odd streams at their delays; output i is read at stream position
+    tap_size // 2 + i, which reproduces pywt.dwt(signal, mode="symmetric").
+    """
+    pad = tap_size - 1
+    padded = [
+        signal[symmetric_index(index - pad, len(signal))]
+        for index in range(len(signal) + 2 * pad)
+    ]
+    even = {delay_even + i: value for i, value in enumerate(padded[0::2])}
+    odd = {delay_odd + i: value for i, value in enumerate(padded[1::2])}
+    even, odd = apply_raw_steps(steps, even, odd)
+    positions = range(tap_size // 2, tap_size // 2 + (len(signal) + pad) // 2)
+    if any(n not in even or n not in odd for n in positions):
+        raise RuntimeError("lifting steps do not cover the canonical outputs")
+    return [even[n] for n in positions], [odd[n] for n in positions]
+
+
+def relative_error(
+    actual: tuple[list[float], list[float]],
+    expected: tuple[list[float], list[float]],
+) -> float:
+    scale = max(abs(value) for band in expected for value in band)
+    difference = max(
+        abs(lhs - rhs)
+        for bands in zip(actual, expected)
+        for lhs, rhs in zip(*bands)
+    )
+    return difference / max(scale, 1e-30)
+
+
+def drop_units(steps: list[RawStep], units: set[tuple[int, str]]) -> list[RawStep]:
+    """Apply prune units `(step index, "step" | "first" | "last")`.
+
+    "step" removes a predict/update route; "first" and "last" drop an edge
+    tap, which shrinks k and the halo (interior taps would still cost a MAD
+    pass). Dropping the first tap moves the stencil one sample, which the
+    shift absorbs. A step left without taps is removed.
+    """
+    pruned: list[RawStep] = []
+    for index, step in enumerate(steps):
+        if (index, "step") in units:
+            continue
+        begin = 1 if (index, "first") in units else 0
+        end = len(step.coefficients) - (1 if (index, "last") in units else 0)
+        if begin >= end:
+            continue
+        pruned.append(
+            RawStep(
+                kind=step.kind,
+                shift=step.shift + begin,
+                coefficients=step.coefficients[begin:end],
+            )
+        )
+    return pruned
+
+
+def prune_steps(
+    steps: list[RawStep],
+    error_bound: float,
+    measure: Callable[[list[RawStep]], float],
+) -> tuple[list[RawStep], float]:
+    """Drop the most routes and edge taps whose joint error stays in bound.
+
+    Each unit is first measured alone; units are then taken cheapest first,
+    and a binary search over that order finds the longest prefix whose
+    joint error is within `error_bound`. Returns the pruned steps and their
+    measured error.
+    """
+    units: list[tuple[float, tuple[int, str]]] = []
+    for index, step in enumerate(steps):
+        if step.kind not in {"predict", "update"}:
+            continue
+        sides = ("step", "first", "last") if len(step.coefficients) > 1 else ("step",)
+        for side in sides:
+            try:
+                error = measure(drop_units(steps, {(index, side)}))
+            except RuntimeError:
+                continue
+            if error <= error_bound:
+                units.append((error, (index, side)))
+    units.sort()
+
+    best, best_error = steps, 0.0
+    low, high = 1, len(units)
+    while low <= high:
+        middle = (low + high) // 2
+        candidate = drop_units(steps, {unit for _, unit in units[:middle]})
+        try:
+            error = measure(candidate)
+        except RuntimeError:
+            error = math.inf
+        if error <= error_bound:
+            best, best_error = candidate, error
+            low = middle + 1
+        else:
+            high = middle - 1
+    return best, best_error
+
+
+def tap_count(steps: list[RawStep]) -> int:
+    return sum(
+        len(step.coefficients) for step in steps if step.kind in {"predict", "update"}
+    )
+
+
 def inverse_steps(steps: tuple[Step, ...]) -> tuple[Step, ...]:
     inverse: list[Step] = []
     for step in reversed(steps):
@@ -84,24 +258,36 @@ def inverse_steps(steps: tuple[Step, ...]) -> tuple[Step, ...]:
     return tuple(inverse)
 
 
-def load_scheme(path: Path) -> Scheme:
+def read_raw_scheme(path: Path) -> tuple[dict[str, Any], list[RawStep]]:
+    """Read one JSON scheme and validate its steps."""
     obj = json.loads(path.read_text(encoding="utf-8"))
-    name = path.stem
-    steps: list[Step] = []
+    raw_steps: list[RawStep] = []
     for raw_step in obj["steps"]:
         kind = raw_step["type"]
         if kind not in STEP_TYPES:
             raise ValueError(f"{path.name}: unsupported step type {kind!r}")
-        coeff_bits = tuple(
-            f32_bits(parse_coeff(coeff)) for coeff in raw_step.get("coefficients", [])
+        coefficients = tuple(
+            parse_coeff(coeff) for coeff in raw_step.get("coefficients", [])
         )
-        if kind in {"scale-even", "scale-odd"} and len(coeff_bits) != 1:
+        if kind in {"scale-even", "scale-odd"} and len(coefficients) != 1:
             raise ValueError(f"{path.name}: {kind} must have exactly one coefficient")
-        if kind == "swap" and coeff_bits:
+        if kind == "swap" and coefficients:
             raise ValueError(f"{path.name}: swap must not have coefficients")
-        steps.append(
-            Step(kind=kind, shift=int(raw_step["shift"]), coeff_bits=coeff_bits)
+        raw_steps.append(
+            RawStep(kind=kind, shift=int(raw_step["shift"]), coefficients=coefficients)
         )
+    return obj, raw_steps
+
+
+def make_scheme(name: str, obj: dict[str, Any], raw_steps: list[RawStep]) -> Scheme:
+    steps = tuple(
+        Step(
+            kind=step.kind,
+            shift=step.shift,
+            coeff_bits=tuple(f32_bits(coeff) for coeff in step.coefficients),
+        )
+        for step in raw_steps
+    )
 
     return Scheme(
         name=name,
@@ -109,8 +295,79 @@ def load_scheme(path: Path) -> Scheme:
         tap_size=int(obj["tap_size"]),
         delay_even=int(obj["delay"]["even"]),
         delay_odd=int(obj["delay"]["odd"]),
-        steps=tuple(steps),
+        steps=steps,
+    )
+
+
+def load_scheme(path: Path) -> Scheme:
+    obj, raw_steps = read_raw_scheme(path)
+    return make_scheme(path.stem, obj, raw_steps)
+
+
+@dataclass(frozen=True)
+class PruneReport:
+    routes: int
+    pruned_routes: int
+    taps: int
+    pruned_taps: int
+    error: float
+    reference: str
+
+
+def pywt_reference(
+    name: str, signal: list[float]
+) -> tuple[list[float], list[float]] | None:
+    try:
+        import pywt  # type: ignore[import-not-found]
+    except ImportError:
+        return None
+    if name not in pywt.wavelist(kind="discrete"):
+        return None
+    approximation, detail = pywt.dwt(signal, name, mode="symmetric")
+    return list(map(float, approximation)), list(map(float, detail))
+
+
+def load_fast_scheme(
+    path: Path, error_bound: float
+) -> tuple[Scheme, PruneReport] | None:
+    """Build the `<name>_fast` variant of one scheme with edge taps pruned.
+
+    Errors are measured on a test signal relative to its largest output,
+    against PyWavelets when it is installed and against the exact lifting
+    chain, which reproduces it, otherwise. Returns None when no tap can be
+    dropped within `error_bound`.
+    """
+    obj, raw_steps = read_raw_scheme(path)
+    tap_size = int(obj["tap_size"])
+    delays = (int(obj["delay"]["even"]), int(obj["delay"]["odd"]))
+    signal = [
+        math.sin(0.37 * n) + 0.25 * math.cos(1.9 * n) + 0.01 * (n % 97)
+        for n in range(PRUNE_SIGNAL_LENGTH)
+    ]
+
+    def transform(steps: list[RawStep]) -> tuple[list[float], list[float]]:
+        return forward_transform(steps, tap_size, *delays, signal)
+
+    exact = transform(raw_steps)
+    pruned, _ = prune_steps(
+        raw_steps, error_bound, lambda steps: relative_error(transform(steps), exact)
     )
+    if pruned == raw_steps:
+        return None
+
+    reference = pywt_reference(path.stem, signal)
+    scheme = make_scheme(f"{path.stem}_fast", obj, pruned)
+    report = PruneReport(
+        routes=len(raw_steps),
+        pruned_routes=len(scheme.steps),
+        taps=tap_count(raw_steps),
+        pruned_taps=tap_count(pruned),
+        error=relative_error(
+            transform(pruned), exact if reference is None else reference
+        ),
+        reference="exact lifting chain" if reference is None else "PyWavelets",
+    )
+    return scheme, report
 
 
 def coeff_args(step: Step) -> str:
@@ -119,13 +376,21 @@ def coeff_args(step: Step) -> str:
     return ", " + ", ".join(f"0x{bits:08x}U" for bits in step.coeff_bits)
 
 
-def render_scheme_header(scheme: Scheme) -> str:
+def include_path(header: Path, including_dir: Path) -> str:
+    """Relative inside the checkout, absolute into an out-of-tree build."""
+    if header.is_relative_to(REPO_ROOT) and including_dir.is_relative_to(REPO_ROOT):
+        return Path(os.path.relpath(header, including_dir)).as_posix()
+    return header.as_posix()
+
+
+def render_scheme_header(scheme: Scheme, header_path: Path) -> str:
     inverse_ident = f"{scheme.ident}_inverse"
     inverse = inverse_steps(scheme.steps)
+    compute_header = include_path(header_path, KERNEL_DIR)
     lines: list[str] = [
         "#pragma once",
         "",
-        '#include "../../lifting/static_scheme.hpp"',
+        f'#include "{include_path(STATIC_SCHEME_HEADER, header_path.parent)}"',
         "",
         "namespace ttwv::schemes {",
         "",
@@ -139,7 +404,7 @@ def render_scheme_header(scheme: Scheme) -> str:
         f"    static constexpr uint32_t num_steps = {len(scheme.steps)}U;",
         (
             f"    static constexpr const char* compute_scheme_header = "
-            f'"\\"../../tt_wavelet/include/schemes/generated/{scheme.ident}.hpp\\"";'
+            f'"\\"{compute_header}\\"";'
         ),
         f'    static constexpr const char* compute_scheme_type = "ttwv::schemes::{scheme.ident}";',
         f"    using inverse = {inverse_ident};",
@@ -173,7 +438,7 @@ def render_scheme_header(scheme: Scheme) -> str:
             f"    static constexpr uint32_t num_steps = {len(inverse)}U;",
             (
                 f"    static constexpr const char* compute_scheme_header = "
-                f'"\\"../../tt_wavelet/include/schemes/generated/{scheme.ident}.hpp\\"";'
+                f'"\\"{compute_header}\\"";'
             ),
             f'    static constexpr const char* compute_scheme_type = "ttwv::schemes::{inverse_ident}";',
             "",
@@ -203,9 +468,14 @@ def render_scheme_header(scheme: Scheme) -> str:
     return "\n".join(lines)
 
 
-def render_registry(schemes: list[Scheme]) -> str:
+def render_registry(
+    schemes: list[Scheme], header_paths: dict[str, Path], registry: Path
+) -> str:
     first_ident = schemes[0].ident
-    includes = "\n".join(f'#include "{scheme.ident}.hpp"' for scheme in schemes)
+    includes = "\n".join(
+        f'#include "{include_path(header_paths[scheme.ident], registry.parent)}"'
+        for scheme in schemes
+    )
     enum_entries = "\n".join(f"    k{scheme.ident}," for scheme in schemes)
     info_entries = "\n".join(
         (
@@ -308,6 +578,24 @@ def parse_args(argv: list[str]) -> argparse.Namespace:
     parser.add_argument("--json-dir", type=Path, default=DEFAULT_JSON_DIR)
     parser.add_argument("--scheme-dir", type=Path, default=DEFAULT_SCHEME_DIR)
     parser.add_argument("--registry", type=Path, default=DEFAULT_REGISTRY)
+    parser.add_argument(
+        "--prune-error",
+        type=float,
+        metavar="BOUND",
+        help=(
+            "Also generate <name>_fast schemes whose negligible edge taps are "
+            "dropped while the forward output stays within this relative error, "
+            "e.g. 1e-5."
+        ),
+    )
+    parser.add_argument(
+        "--fast-scheme-dir",
+        type=Path,
+        help=(
+            "Directory for the <name>_fast headers, such as the build tree; "
+            "defaults to --scheme-dir."
+        ),
+    )
     return parser.parse_args(argv)
 
 
@@ -321,19 +609,52 @@ def main(argv: list[str] | None = None) -> int:
     schemes = sorted(
         (load_scheme(path) for path in json_files), key=lambda scheme: scheme.name
     )
+    fast_schemes: list[Scheme] = []
+    if args.prune_error is not None:
+        if args.prune_error <= 0.0:
+            print("ERROR: --prune-error must be positive", file=sys.stderr)
+            return 1
+        for path in json_files:
+            fast = load_fast_scheme(path, args.prune_error)
+            if fast is None:
+                continue
+            scheme, report = fast
+            fast_schemes.append(scheme)
+            print(
+                f"{scheme.name}: {report.routes} -> {report.pruned_routes} routes, "
+                f"{report.taps} -> {report.pruned_taps} taps, relative error "
+                f"{report.error:.2e} against the {report.reference}"
+            )
+        schemes = sorted(schemes + fast_schemes, key=lambda scheme: scheme.name)
     if len({scheme.ident for scheme in schemes}) != len(schemes):
         raise RuntimeError("Generated scheme identifiers are not unique")
 
-    kept_scheme_headers: set[Path] = set()
+    scheme_dir = args.scheme_dir.resolve()
+    fast_scheme_dir = (args.fast_scheme_dir or args.scheme_dir).resolve()
+    registry = args.registry.resolve()
+    fast_idents = {scheme.ident for scheme in fast_schemes}
+    header_paths = {
+        scheme.ident: (
+            fast_scheme_dir if scheme.ident in fast_idents else scheme_dir
+        )
+        / f"{scheme.ident}.hpp"
+        for scheme in schemes
+    }
     writes = 0
 
     for scheme in schemes:
-        scheme_path = args.scheme_dir / f"{scheme.ident}.hpp"
-        kept_scheme_headers.add(scheme_path)
-        writes += write_if_changed(scheme_path, render_scheme_header(scheme))
+        header_path = header_paths[scheme.ident]
+        writes += write_if_changed(
+            header_path, render_scheme_header(scheme, header_path)
+        )
 
-    writes += write_if_changed(args.registry, render_registry(schemes))
-    remove_stale(args.scheme_dir, kept_scheme_headers | {args.registry}, "*.hpp")
+    writes += write_if_changed(
+        registry, render_registry(schemes, header_paths, registry)
+    )
+    kept_scheme_headers = set(header_paths.values())
+    remove_stale(scheme_dir, kept_scheme_headers | {registry}, "*.hpp")
+    if fast_scheme_dir != scheme_dir:
+        remove_stale(fast_scheme_dir, kept_scheme_headers, "*_fast.hpp")
 
     print(f"Generated {len(schemes)} static scheme headers ({writes} files changed)")
     return 0
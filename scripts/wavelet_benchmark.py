@@ -2628,6 +2628,9 @@ def _standalone_performance_row(
             "route_count",
             "planner_groups_per_chunk",
             "requested_core_limit",
+            "selected_engine",
+            "lifting_cost",
+            "polyphase_fir_cost",
         )
         if key in response
     }
@@ -29,6 +29,7 @@
 #include "tt_wavelet/include/common/tiling_2d.hpp"
 #include "tt_wavelet/include/lifting/device.hpp"
 #include "tt_wavelet/include/lifting/device_2d.hpp"
+#include "tt_wavelet/include/lifting/polyphase_fir.hpp"
 #include "tt_wavelet/include/schemes/generated/registry.hpp"
 
 namespace {
@@ -185,6 +186,21 @@ void add_scheduler(Json& result, const ttwv::LiftingSchedulerTelemetry& schedule
     result["memory_config"] = "dram-interleaved-input-output/l1-sharded-workspace";
 }
 
+// The device always runs lifting; the host cost model's engine pick for the
+// same plan and batch is reported beside it, as in the engine_selection
+// planner benchmark.
+void add_scheduler(
+    Json& result, const ttwv::LiftingSchedulerTelemetry& scheduler, const ttwv::LwtEngineSelection& engine) {
+    add_scheduler(result, scheduler);
+    result["selected_engine"] = ttwv::lwt_engine_name(engine.engine);
+    result["lifting_taps"] = engine.lifting_taps;
+    result["polyphase_fir_taps"] = engine.polyphase_fir_taps;
+    result["polyphase_fir_edge_outputs"] = engine.polyphase_fir_edge_outputs;
+    result["lifting_cost"] = engine.lifting_cost;
+    result["polyphase_fir_cost"] = engine.polyphase_fir_cost;
+    result["polyphase_fir_deviation"] = engine.polyphase_fir_deviation;
+}
+
 template <typename Scheme>
 [[nodiscard]] Json run_1d(
     const Json& request,
@@ -226,7 +242,14 @@ template <typename Scheme>
             warmup_runs,
             repeats);
         add_program_size(result, executable.workload);
-        add_scheduler(result, executable.buffers.scheduler);
+        add_scheduler(
+            result,
+            executable.buffers.scheduler,
+            ttwv::select_lwt_engine(
+                executable.plan,
+                ttwv::make_host_lwt_route_coefficients<Scheme>(executable.plan.full_plan),
+                ttwv::make_polyphase_fir_bank<Scheme>(),
+                batch_count));
         result["logical_output_size"] = executable.plan.full_plan.output_length;
         result["physical_input_size"] = input.descriptor.physical_nbytes() / sizeof(float);
         result["physical_output_size"] = {
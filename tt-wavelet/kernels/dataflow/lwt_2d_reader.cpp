@@ -711,7 +711,21 @@ ALWI void initialize_planes_tiled(
 }
 
 #ifdef TTWV_ILWT_2D
-template <typename BandAccessor>
+// Periodization bands repeat every band length, so chunks at either edge read
+// wrapped coefficients; the padded modes never leave the band.
+template <bool Periodic>
+[[nodiscard]] ALWI uint32_t canonical_band_index(
+    const uint32_t internal, const int32_t internal_offset, const uint32_t band_length) {
+    const int32_t canonical = static_cast<int32_t>(internal) - internal_offset;
+    if constexpr (Periodic) {
+        return ttwv::extension_positive_mod(canonical, band_length);
+    } else {
+        ASSERT(canonical >= 0 && canonical < static_cast<int32_t>(band_length));
+        return static_cast<uint32_t>(canonical);
+    }
+}
+
+template <bool Periodic, typename BandAccessor>
 ALWI void initialize_inverse_band_plane(
     const BandAccessor& band_args,
     const uint32_t band_addr,
@@ -765,27 +779,33 @@ ALWI void initialize_inverse_band_plane(
                 continue;
             }
 
-            const int32_t canonical_y_begin = static_cast<int32_t>(internal_y_begin) - y_internal_offset;
-            const int32_t canonical_y_end = static_cast<int32_t>(internal_y_end) - y_internal_offset;
-            const int32_t canonical_x_begin = static_cast<int32_t>(internal_x_begin) - x_internal_offset;
-            const int32_t canonical_x_end = static_cast<int32_t>(internal_x_end) - x_internal_offset;
-            ASSERT(canonical_y_begin >= 0 && canonical_x_begin >= 0);
-            ASSERT(canonical_y_end <= static_cast<int32_t>(band_height));
-            ASSERT(canonical_x_end <= static_cast<int32_t>(band_width));
-
-            const uint32_t source_tile_y_begin = static_cast<uint32_t>(canonical_y_begin) / kTileSide;
-            const uint32_t source_tile_y_end = (static_cast<uint32_t>(canonical_y_end - 1) / kTileSide) + 1;
-            const uint32_t source_tile_x_begin = static_cast<uint32_t>(canonical_x_begin) / kTileSide;
-            const uint32_t source_tile_x_end = (static_cast<uint32_t>(canonical_x_end - 1) / kTileSide) + 1;
-            const uint32_t source_tile_rows = source_tile_y_end - source_tile_y_begin;
-            const uint32_t source_tile_columns = source_tile_x_end - source_tile_x_begin;
-            ASSERT(source_tile_rows <= ttwv::device_protocol::kLwt2DSplitScratchTileRows);
-            ASSERT(source_tile_columns <= ttwv::device_protocol::kLwt2DSplitScratchTileColumns);
+            // A wrapped edge may read tiles from both ends of the band, so the
+            // source tiles are collected rather than taken as one range.
+            uint32_t source_rows[ttwv::device_protocol::kLwt2DSplitScratchTileRows];
+            uint32_t source_columns[ttwv::device_protocol::kLwt2DSplitScratchTileColumns];
+            uint32_t source_tile_rows = 0;
+            uint32_t source_tile_columns = 0;
+            const SourceAxisTileCollector row_collector{
+                .tiles = source_rows,
+                .count = source_tile_rows,
+                .capacity = ttwv::device_protocol::kLwt2DSplitScratchTileRows,
+            };
+            const SourceAxisTileCollector column_collector{
+                .tiles = source_columns,
+                .count = source_tile_columns,
+                .capacity = ttwv::device_protocol::kLwt2DSplitScratchTileColumns,
+            };
+            for (uint32_t internal_y = internal_y_begin; internal_y < internal_y_end; ++internal_y) {
+                row_collector(canonical_band_index<Periodic>(internal_y, y_internal_offset, band_height));
+            }
+            for (uint32_t internal_x = internal_x_begin; internal_x < internal_x_end; ++internal_x) {
+                column_collector(canonical_band_index<Periodic>(internal_x, x_internal_offset, band_width));
+            }
 
             for (uint32_t source_tile_y = 0; source_tile_y < source_tile_rows; ++source_tile_y) {
                 for (uint32_t source_tile_x = 0; source_tile_x < source_tile_columns; ++source_tile_x) {
                     const uint32_t source_tile =
-                        (source_tile_y_begin + source_tile_y) * band_tile_columns + source_tile_x_begin + source_tile_x;
+                        source_rows[source_tile_y] * band_tile_columns + source_columns[source_tile_x];
                     const uint32_t scratch_tile = source_tile_y * source_tile_columns + source_tile_x;
                     noc_async_read(
                         band.get_noc_addr(band_tile_base + source_tile),
@@ -797,13 +817,13 @@ ALWI void initialize_inverse_band_plane(
 
             auto* destination = reinterpret_cast<volatile tt_l1_ptr float*>(destination_addr);
             for (uint32_t internal_y = internal_y_begin; internal_y < internal_y_end; ++internal_y) {
-                const uint32_t canonical_y =
-                    static_cast<uint32_t>(static_cast<int32_t>(internal_y) - y_internal_offset);
-                const uint32_t source_tile_y = canonical_y / kTileSide - source_tile_y_begin;
+                const uint32_t canonical_y = canonical_band_index<Periodic>(internal_y, y_internal_offset, band_height);
+                const uint32_t source_tile_y = find_index(source_rows, source_tile_rows, canonical_y / kTileSide);
                 for (uint32_t internal_x = internal_x_begin; internal_x < internal_x_end; ++internal_x) {
                     const uint32_t canonical_x =
-                        static_cast<uint32_t>(static_cast<int32_t>(internal_x) - x_internal_offset);
-                    const uint32_t source_tile_x = canonical_x / kTileSide - source_tile_x_begin;
+                        canonical_band_index<Periodic>(internal_x, x_internal_offset, band_width);
+                    const uint32_t source_tile_x =
+                        find_index(source_columns, source_tile_columns, canonical_x / kTileSide);
                     const uint32_t scratch_tile = source_tile_y * source_tile_columns + source_tile_x;
                     const auto* source =
                         reinterpret_cast<volatile tt_l1_ptr float*>(scratch_addr + scratch_tile * kTileBytes);
@@ -815,7 +835,7 @@ ALWI void initialize_inverse_band_plane(
     }
 }
 
-template <typename BandAccessor>
+template <bool Periodic, typename BandAccessor>
 ALWI void initialize_inverse_band_planes(
     const BandAccessor& band_args,
     const uint32_t* band_addrs,
@@ -835,7 +855,7 @@ ALWI void initialize_inverse_band_planes(
     constexpr uint32_t y_stream[4] = {0, 0, 1, 1};
     constexpr uint32_t x_stream[4] = {0, 1, 0, 1};
     for (uint32_t plane = 0; plane < 4; ++plane) {
-        initialize_inverse_band_plane(
+        initialize_inverse_band_plane<Periodic>(
             band_args,
             band_addrs[plane],
             band_height,
@@ -1191,7 +1211,7 @@ void kernel_main() {
         stored[4] = Rect{};
 
 #ifdef TTWV_ILWT_2D
-        initialize_inverse_band_planes(
+        initialize_inverse_band_planes<boundary_mode == ttwv::BoundaryMode::kPeriodization>(
             input_args,
             band_addrs,
             input_height,
@@ -1,6 +1,5 @@
 #include <cstdint>
 
-#include "../../tt_wavelet/include/common/boundary.hpp"
 #include "../../tt_wavelet/include/device_protocol/lwt_config.hpp"
 #include "../../tt_wavelet/include/lifting/step.hpp"
 #include "../primitives/stick_cache.hpp"
@@ -154,7 +153,49 @@ ALWI const uint32_t* load_config_page(
     return reinterpret_cast<const uint32_t*>(get_read_ptr(cb_config));
 }
 
-template <ttwv::BoundaryMode Boundary, bool TileNative, typename InputAccessor>
+// The host writes the plan's halo entries once per executable; the reader
+// keeps every page resident for the launch.
+template <typename ExtensionAccessor>
+ALWI const uint32_t* load_extension_table(
+    const ExtensionAccessor& extension,
+    const uint32_t extension_addr,
+    const uint32_t cb_extension,
+    const uint32_t page_count) {
+    const auto page_accessor =
+        TensorAccessor(extension, extension_addr, ttwv::device_protocol::kExtensionConfigPageBytes);
+    cb_reserve_back(cb_extension, page_count);
+    const uint32_t table_addr = get_write_ptr(cb_extension);
+    for (uint32_t page = 0; page < page_count; ++page) {
+        noc_async_read(
+            page_accessor.get_noc_addr(page),
+            table_addr + page * ttwv::device_protocol::kExtensionConfigPageBytes,
+            ttwv::device_protocol::kExtensionConfigPageBytes);
+    }
+    noc_async_read_barrier();
+    cb_push_back(cb_extension, page_count);
+    cb_wait_front(cb_extension, page_count);
+    return reinterpret_cast<const uint32_t*>(get_read_ptr(cb_extension));
+}
+
+// Interior chunks read only signal samples, so their variant reads the stick
+// cache directly and never consults the extension table.
+template <bool Interior, typename InputAccessor>
+ALWI float read_initial_value(
+    const InputAccessor& input,
+    ttwv::kernels::primitives::StickReadCache& cache,
+    const uint32_t input_length,
+    const uint32_t left_pad,
+    const uint32_t* extension_table,
+    const uint32_t padded_index) {
+    if constexpr (Interior) {
+        return ttwv::kernels::primitives::read_source_value(input, cache, padded_index - left_pad, input_length);
+    } else {
+        return ttwv::kernels::primitives::read_padded_value(
+            input, cache, input_length, left_pad, extension_table, padded_index);
+    }
+}
+
+template <bool Interior, bool TileNative, typename InputAccessor>
 ALWI void initialize_lwt_streams(
     const InputAccessor& input,
     const uint32_t even_addr,
@@ -162,6 +203,7 @@ ALWI void initialize_lwt_streams(
     const uint32_t cb_input_cache,
     const uint32_t input_length,
     const uint32_t left_pad,
+    const uint32_t* extension_table,
     const uint32_t even_begin,
     const uint32_t even_length,
     const uint32_t odd_begin,
@@ -193,8 +235,8 @@ ALWI void initialize_lwt_streams(
     for (uint32_t split_index = split_begin; split_index < split_end; ++split_index) {
         if (split_index >= even_begin && split_index < even_end) {
             const uint32_t padded_index = 2U * split_index;
-            const float value = ttwv::kernels::primitives::read_padded_value<Boundary>(
-                input, input_cache, input_length, left_pad, padded_index);
+            const float value =
+                read_initial_value<Interior>(input, input_cache, input_length, left_pad, extension_table, padded_index);
             if constexpr (TileNative) {
                 even_dst[even_cursor.physical] = value;
                 even_cursor.advance();
@@ -204,8 +246,8 @@ ALWI void initialize_lwt_streams(
         }
         if (split_index >= odd_begin && split_index < odd_end) {
             const uint32_t padded_index = 2U * split_index + 1U;
-            const float value = ttwv::kernels::primitives::read_padded_value<Boundary>(
-                input, input_cache, input_length, left_pad, padded_index);
+            const float value =
+                read_initial_value<Interior>(input, input_cache, input_length, left_pad, extension_table, padded_index);
             if constexpr (TileNative) {
                 odd_dst[odd_cursor.physical] = value;
                 odd_cursor.advance();
@@ -241,9 +283,15 @@ ALWI void initialize_inverse_stream(
         input_page_size};
     auto* output = reinterpret_cast<volatile tt_l1_ptr float*>(output_addr);
     WorkspaceIndexCursor cursor(0);
+    // Periodization windows run past the band and wrap; the host passes the
+    // period as input_length and keeps input_begin below it.
+    uint32_t source_index = input_begin;
     for (uint32_t index = 0; index < output_length; ++index) {
         const float value =
-            ttwv::kernels::primitives::read_source_value(input, input_cache, input_begin + index, input_length);
+            ttwv::kernels::primitives::read_source_value(input, input_cache, source_index, input_length);
+        if (++source_index == input_length) {
+            source_index = 0;
+        }
         if constexpr (TileNative) {
             output[cursor.physical] = value;
             cursor.advance();
@@ -601,16 +649,24 @@ void kernel_main() {
     constexpr uint32_t cb_sync = get_compile_time_arg_val(5);
     constexpr bool tile_native_workspace = get_compile_time_arg_val(6) != 0;
     constexpr bool inverse = get_compile_time_arg_val(7) != 0;
-    constexpr auto boundary_mode = static_cast<ttwv::BoundaryMode>(get_compile_time_arg_val(8));
+    constexpr uint32_t cb_extension_table = get_compile_time_arg_val(8);
     constexpr uint32_t input_page_size = get_compile_time_arg_val(9);
     constexpr bool row_major_noc_staging = get_compile_time_arg_val(10) != 0;
     constexpr bool hybrid_tile_mirror = get_compile_time_arg_val(11) != 0;
-    static_assert(ttwv::is_supported_lwt_boundary_mode(boundary_mode), "Unsupported LWT boundary mode");
     constexpr auto config_args = TensorAccessorArgs<12>();
     constexpr auto input0_args = TensorAccessorArgs<config_args.next_compile_time_args_offset()>();
     constexpr auto input1_args = TensorAccessorArgs<input0_args.next_compile_time_args_offset()>();
+    constexpr auto extension_args = TensorAccessorArgs<input1_args.next_compile_time_args_offset()>();
 
     const auto input0 = TensorAccessor(input0_args, input0_addr, input_page_size);
+    // Inverse reads canonical coefficients and carries no extension table.
+    uint32_t extension_page_count = 0;
+    const uint32_t* extension_table = nullptr;
+    if constexpr (!inverse) {
+        extension_page_count = get_arg_val<uint32_t>(14);
+        extension_table =
+            load_extension_table(extension_args, get_arg_val<uint32_t>(13), cb_extension_table, extension_page_count);
+    }
 
     bool first_local_route = true;
     for (uint32_t local_chunk = 0; local_chunk < chunk_count; ++local_chunk) {
@@ -657,20 +713,30 @@ void kernel_main() {
             const uint32_t initial_even_length = chunk[ttwv::device_protocol::kLwtInitialEvenLength];
             const uint32_t initial_odd_begin = chunk[ttwv::device_protocol::kLwtInitialOddBegin];
             const uint32_t initial_odd_length = chunk[ttwv::device_protocol::kLwtInitialOddLength];
+            const bool interior =
+                (chunk[ttwv::device_protocol::kLwtChunkFlags] & ttwv::device_protocol::kLwtChunkFlagInterior) != 0;
             cb_pop_front(cb_config, 1);
-            initialize_lwt_streams<boundary_mode, tile_native_workspace>(
-                input0,
-                initial_even_addr,
-                initial_odd_addr,
-                cb_input_cache,
-                input_length,
-                left_pad,
-                initial_even_begin,
-                initial_even_length,
-                initial_odd_begin,
-                initial_odd_length,
-                input_page,
-                input_page_size);
+            const auto initialize = [&]<bool Interior>() {
+                initialize_lwt_streams<Interior, tile_native_workspace>(
+                    input0,
+                    initial_even_addr,
+                    initial_odd_addr,
+                    cb_input_cache,
+                    input_length,
+                    left_pad,
+                    extension_table,
+                    initial_even_begin,
+                    initial_even_length,
+                    initial_odd_begin,
+                    initial_odd_length,
+                    input_page,
+                    input_page_size);
+            };
+            if (interior) {
+                initialize.template operator()<true>();
+            } else {
+                initialize.template operator()<false>();
+            }
         }
 
         for (uint32_t route_index = 0; route_index < route_count; ++route_index) {
@@ -726,4 +792,7 @@ void kernel_main() {
             first_local_route = false;
         }
     }
+    if constexpr (!inverse) {
+        cb_pop_front(cb_extension_table, extension_page_count);
+    }
 }
@@ -3,14 +3,15 @@
 #include <cstdint>
 
 #include "../../tt_wavelet/include/common/signal_extension.hpp"
+#include "../../tt_wavelet/include/device_protocol/lwt_config.hpp"
 #include "api/dataflow/dataflow_api.h"
 #define ALWI inline __attribute__((always_inline))
 
 // Wormhole NCRISC has a 16 KiB instruction region, so keep the cache refill
-// path out of line there. Blackhole keeps that hot path inline. Boundary
-// extension is a cold path on both architectures; keeping it out of line also
-// prevents smooth/antireflect cloning from overflowing Blackhole's aggregate
-// fast-dispatch program-config buffer in profiler builds.
+// path out of line there. Blackhole keeps that hot path inline. Halo
+// evaluation is a cold path on both architectures; keeping it out of line
+// also keeps Blackhole profiler builds within the aggregate fast-dispatch
+// program-config buffer.
 #if defined(ARCH_WORMHOLE)
 #define TTWV_CACHE_REFILL_CALLABLE __attribute__((noinline))
 #define TTWV_BOUNDARY_CALLABLE __attribute__((noinline))
@@ -120,83 +121,65 @@ ALWI float read_source_value(
     return cached_values[cached_offset * cache.stick_width + source_lane];
 }
 
+/**
+ * Evaluate one entry of the extension table a forward reader keeps in L1, as
+ * evaluate_extension_gather_entry does on the host. The table replaces the
+ * per-mode index decomposition, so every boundary mode shares this path and
+ * reads no more than three signal samples per halo sample.
+ */
 template <typename SrcAccessor>
-TTWV_BOUNDARY_CALLABLE float read_extended_source_value(
-    const SrcAccessor& src, StickReadCache& cache, const uint32_t source_index, const uint32_t source_length) {
-    return read_source_value(src, cache, source_index, source_length);
-}
-
-template <typename SrcAccessor>
-struct CachedSourceReader {
-    const SrcAccessor& src;
-    StickReadCache& cache;
-    uint32_t source_length;
-
-    ALWI float operator()(const uint32_t source_index) const {
-        return read_extended_source_value(src, cache, source_index, source_length);
-    }
-};
-
-template <ttwv::BoundaryMode Mode, typename SrcAccessor>
-TTWV_BOUNDARY_CALLABLE float read_extended_value(
-    const SrcAccessor& src,
-    StickReadCache& cache,
-    const uint32_t input_length,
-    const uint32_t left_pad,
-    const uint32_t out_idx) {
-    static_assert(ttwv::is_supported_lwt_boundary_mode(Mode), "Unsupported compile-time boundary mode");
-#if defined(ARCH_WORMHOLE)
-    if constexpr (Mode == ttwv::BoundaryMode::kAntireflect) {
-        // Host planning bounds the padded signal to INT32_MAX.  Native 32-bit
-        // decomposition is therefore exactly equivalent on the supported
-        // domain and avoids linking 64-bit divide/modulo helpers into
-        // Wormhole's 16 KiB NCRISC text region.  Keep Blackhole on the proven
-        // canonical ExtendedIndex path below.
-        const int32_t logical = static_cast<int32_t>(out_idx) - static_cast<int32_t>(left_pad);
-        const ttwv::AntireflectIndexI32 extended = ttwv::make_antireflect_index_i32(logical, input_length);
-        return ttwv::evaluate_antireflect_index_i32(
-            extended,
-            input_length,
-            CachedSourceReader<SrcAccessor>{
-                .src = src,
-                .cache = cache,
-                .source_length = input_length,
-            });
-    } else
-#endif
-    {
-        const int64_t logical = static_cast<int64_t>(out_idx) - static_cast<int64_t>(left_pad);
-        const ttwv::ExtendedIndex extended = ttwv::make_extended_index<Mode>(logical, input_length);
-        return ttwv::evaluate_extended_index<Mode>(
-            extended,
-            input_length,
-            CachedSourceReader<SrcAccessor>{
-                .src = src,
-                .cache = cache,
-                .source_length = input_length,
-            });
+TTWV_BOUNDARY_CALLABLE float read_halo_value(
+    const SrcAccessor& src, StickReadCache& cache, const uint32_t input_length, const uint32_t* entry) {
+    const uint32_t operation_word = entry[ttwv::device_protocol::kExtensionOperation];
+    const auto operation =
+        static_cast<ttwv::ExtensionOperation>(operation_word & ttwv::device_protocol::kExtensionOperationMask);
+    const uint32_t source_index = entry[ttwv::device_protocol::kExtensionSourceIndex];
+    const float scale = __builtin_bit_cast(float, entry[ttwv::device_protocol::kExtensionScale]);
+    switch (operation) {
+        case ttwv::ExtensionOperation::kZero: return 0.0F;
+        case ttwv::ExtensionOperation::kSample: return read_source_value(src, cache, source_index, input_length);
+        case ttwv::ExtensionOperation::kNegatedSample:
+            return -read_source_value(src, cache, source_index, input_length);
+        case ttwv::ExtensionOperation::kSmooth: {
+            const float edge = read_source_value(src, cache, source_index, input_length);
+            const uint32_t auxiliary_index = entry[ttwv::device_protocol::kExtensionAuxiliaryIndex];
+            return edge + scale * (edge - read_source_value(src, cache, auxiliary_index, input_length));
+        }
+        case ttwv::ExtensionOperation::kAntireflect: {
+            const float source = read_source_value(src, cache, source_index, input_length);
+            const float first = read_source_value(src, cache, 0, input_length);
+            const float last = read_source_value(src, cache, input_length - 1U, input_length);
+            const bool reflected = (operation_word & ttwv::device_protocol::kExtensionFlagReflected) != 0;
+            const float base = reflected ? 2.0F * last - source : source;
+            return base + scale * (last - first);
+        }
     }
+    return 0.0F;
 }
 
-template <ttwv::BoundaryMode Mode, typename SrcAccessor>
+/**
+ * Sample `out_idx` of the padded signal. Halo samples before the signal use
+ * table entry `out_idx`; those after it follow the left halo, at entry
+ * `out_idx - input_length`.
+ */
+template <typename SrcAccessor>
 ALWI float read_padded_value(
     const SrcAccessor& src,
     StickReadCache& cache,
     const uint32_t input_length,
     const uint32_t left_pad,
+    const uint32_t* extension_table,
     const uint32_t out_idx) {
-    static_assert(ttwv::is_supported_lwt_boundary_mode(Mode), "Unsupported compile-time boundary mode");
-
-    // All supported modes share this direct interior path.  On Wormhole the
-    // bounded prefix/suffix calls one out-of-line specialization so its larger
-    // extension arithmetic is not duplicated in the reader binary.
+    uint32_t entry_index = out_idx;
     if (out_idx >= left_pad) {
         const uint32_t source_index = out_idx - left_pad;
         if (source_index < input_length) {
             return read_source_value(src, cache, source_index, input_length);
         }
+        entry_index = out_idx - input_length;
     }
-    return read_extended_value<Mode>(src, cache, input_length, left_pad, out_idx);
+    return read_halo_value(
+        src, cache, input_length, extension_table + entry_index * ttwv::device_protocol::kExtensionEntryWordCount);
 }
 
 ALWI void release_cache(StickReadCache& cache) {
@@ -94,7 +94,7 @@ struct InverseOutput {
            "[--batch-count B] "
            "[--layout-sweep] "
            "[--output-prefix PATH] "
-           "[--boundary-mode symmetric|zero|constant|periodic|antisymmetric|smooth|reflect|antireflect] "
+           "[--boundary-mode symmetric|zero|constant|periodic|antisymmetric|smooth|reflect|antireflect|periodization] "
            "[--length N --signal-start X --signal-step X | <signal_file>] <scheme|scheme_path>\n"
            "\n"
            "  --inverse  Run 1D ILWT from coefficients produced by an untimed forward transform;\n"
@@ -178,7 +178,7 @@ struct InverseOutput {
             if (!ttwv::parse_boundary_mode(mode, options.boundary_mode)) {
                 throw std::runtime_error(
                     "--boundary-mode must be 'symmetric', 'zero', 'constant', 'periodic', "
-                    "'antisymmetric', 'smooth', 'reflect', or 'antireflect'.");
+                    "'antisymmetric', 'smooth', 'reflect', 'antireflect', or 'periodization'.");
             }
         } else if (arg.starts_with("--")) {
             throw std::runtime_error("Unknown option: " + arg + "\n" + usage());
@@ -527,6 +527,9 @@ void print_scheduler_telemetry(const char* prefix, const ttwv::LiftingSchedulerT
               << prefix << "_max_work_items_per_core: " << scheduler.max_work_items_per_core << '\n'
               << prefix << "_max_group_count: " << scheduler.max_group_count << '\n'
               << prefix << "_active_core_count: " << scheduler.active_core_count << '\n'
+              << prefix << "_modeled_dram_hops: " << scheduler.modeled_dram_hops << '\n'
+              << prefix << "_first_n_modeled_dram_hops: " << scheduler.first_n_modeled_dram_hops << '\n'
+              << prefix << "_dram_bank_chunk_placement: " << (scheduler.dram_bank_chunk_placement ? 1 : 0) << '\n'
               << prefix << "_chunk_count: " << scheduler.chunk_count << '\n'
               << prefix << "_route_count: " << scheduler.route_count << '\n'
               << prefix << "_groups_per_chunk: " << scheduler.groups_per_chunk << '\n'
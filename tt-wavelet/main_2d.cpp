@@ -62,7 +62,7 @@ struct DeviceBands {
 
 [[nodiscard]] std::string usage() {
     return "Usage: lwt_2d "
-           "[--boundary-mode zero|constant|symmetric|reflect|periodic|smooth|antisymmetric|antireflect] "
+           "[--boundary-mode zero|constant|symmetric|reflect|periodic|smooth|antisymmetric|antireflect|periodization] "
            "[--binary-input] [--cores N] [--batch-count B] [--output-prefix PATH] [--quiet] "
            "[--benchmark [--include-transfers] [--repeats N] [--warmup-runs N]] "
            "WAVELET HEIGHT WIDTH INPUT_FILE";
@@ -89,7 +89,7 @@ struct DeviceBands {
             if (++index >= argc || !ttwv::parse_boundary_mode(argv[index], options.boundary_mode)) {
                 throw std::runtime_error(
                     "--boundary-mode requires zero, constant, symmetric, reflect, periodic, smooth, "
-                    "antisymmetric, or antireflect");
+                    "antisymmetric, antireflect, or periodization");
             }
         } else if (argument == "--binary-input") {
             options.binary_input = true;
@@ -312,6 +312,9 @@ void print_telemetry(const ttwv::Lwt2DSchedulerTelemetry& telemetry) {
               << "lwt_2d_boundary_mode: " << ttwv::boundary_mode_name(telemetry.boundary_mode) << '\n'
               << "lwt_2d_available_worker_core_count: " << telemetry.available_worker_core_count << '\n'
               << "lwt_2d_active_core_count: " << telemetry.active_core_count << '\n'
+              << "lwt_2d_modeled_dram_hops: " << telemetry.modeled_dram_hops << '\n'
+              << "lwt_2d_first_n_modeled_dram_hops: " << telemetry.first_n_modeled_dram_hops << '\n'
+              << "lwt_2d_dram_bank_chunk_placement: " << (telemetry.dram_bank_chunk_placement ? 1 : 0) << '\n'
               << "lwt_2d_batch_count: " << telemetry.batch_count << '\n'
               << "lwt_2d_chunks_per_sample: " << telemetry.chunks_per_sample << '\n'
               << "lwt_2d_total_work_items: " << telemetry.total_work_items << '\n'
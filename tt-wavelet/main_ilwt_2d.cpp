@@ -15,6 +15,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -64,7 +65,7 @@ struct Options {
             if (++index >= argc || !ttwv::parse_boundary_mode(argv[index], options.boundary_mode)) {
                 throw std::runtime_error(
                     "--boundary-mode requires zero, constant, symmetric, reflect, periodic, smooth, "
-                    "antisymmetric, or antireflect");
+                    "antisymmetric, antireflect, or periodization");
             }
         } else if (argument == "--cores") {
             if (++index >= argc) {
@@ -332,13 +333,12 @@ int run(const Options& options) {
     print_timings("sync_wait", std::move(sync_times));
     print_timings("host_api_total", std::move(host_total_times));
     const size_t route_count = executable.plan.chunks.empty() ? 0 : executable.plan.chunks.front().routes.size();
-    const size_t scale_routes_removed =
-        executable.plan.chunks.empty()
-            ? 0
-            : static_cast<size_t>(std::count_if(
-                  executable.plan.chunks.front().routes.begin(),
-                  executable.plan.chunks.front().routes.end(),
-                  [](const ttwv::Lwt2DRoutePlan& route) { return ttwv::is_scale_step(route.type); }));
+    const ttwv::Lwt2DRouteTable& route_table = executable.plan.route_table;
+    const std::span<const ttwv::StepType> route_types =
+        executable.plan.chunks.empty() ? std::span<const ttwv::StepType>{}
+                                       : route_table.rows_of(route_table.type, executable.plan.chunks.front().routes);
+    const size_t scale_routes_removed = static_cast<size_t>(std::count_if(
+        route_types.begin(), route_types.end(), [](const ttwv::StepType type) { return ttwv::is_scale_step(type); }));
     std::cerr << "ilwt_2d_architecture: " << tt::arch_to_str(executable.buffers.scheduler.architecture) << '\n'
               << "ilwt_2d_boundary_mode: " << ttwv::boundary_mode_name(options.boundary_mode) << '\n'
               << "ilwt_2d_available_worker_core_count: " << executable.buffers.scheduler.available_worker_core_count
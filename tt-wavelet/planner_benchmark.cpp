@@ -0,0 +1,1968 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent USA, Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Host-only planner benchmark.  Every request line selects one benchmark and
+// the runner prints one JSON result per line; no device is opened.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "tt_wavelet/include/common/boundary_parse.hpp"
+#include "tt_wavelet/include/common/sample_format.hpp"
+#include "tt_wavelet/include/lifting/banded_gemm.hpp"
+#include "tt_wavelet/include/lifting/bucket_plan.hpp"
+#include "tt_wavelet/include/lifting/cascade_plan.hpp"
+#include "tt_wavelet/include/lifting/chunk_placement.hpp"
+#include "tt_wavelet/include/lifting/config_words.hpp"
+#include "tt_wavelet/include/lifting/core_selection.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/host_executor.hpp"
+#include "tt_wavelet/include/lifting/incremental_plan.hpp"
+#include "tt_wavelet/include/lifting/integer_executor.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan_2d.hpp"
+#include "tt_wavelet/include/lifting/mixed_batch_plan.hpp"
+#include "tt_wavelet/include/lifting/multi_scheme_plan.hpp"
+#include "tt_wavelet/include/lifting/page_emulator.hpp"
+#include "tt_wavelet/include/lifting/page_geometry.hpp"
+#include "tt_wavelet/include/lifting/plan_2d.hpp"
+#include "tt_wavelet/include/lifting/polyphase_fir.hpp"
+#include "tt_wavelet/include/lifting/segmented_plan.hpp"
+#include "tt_wavelet/include/lifting/static_plan.hpp"
+#include "tt_wavelet/include/schemes/generated/registry.hpp"
+#include "tt_wavelet/include/schemes/integer/legall5_3.hpp"
+
+namespace {
+
+std::atomic<uint64_t> g_allocation_count{0};
+std::atomic<uint64_t> g_allocated_bytes{0};
+
+// Every replaced operator new/delete below goes through these two, so each
+// allocation function has its matching deallocation function. They stay out
+// of line: GCC would otherwise see `free` inlined against `operator new` and
+// warn with -Wmismatched-new-delete.
+[[gnu::noinline]] void* counted_allocate(const std::size_t size, const std::size_t alignment) noexcept {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    const std::size_t bytes = size == 0 ? 1 : size;
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return std::malloc(bytes);
+    }
+    // aligned_alloc wants the size to be a multiple of the alignment.
+    return std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);
+}
+
+[[gnu::noinline]] void counted_free(void* pointer) noexcept { std::free(pointer); }
+
+void* counted_allocate_or_throw(const std::size_t size, const std::size_t alignment) {
+    if (void* pointer = counted_allocate(size, alignment)) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+}  // namespace
+
+void* operator new(const std::size_t size) { return counted_allocate_or_throw(size, 0); }
+void* operator new[](const std::size_t size) { return counted_allocate_or_throw(size, 0); }
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    return counted_allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](const std::size_t size, const std::align_val_t alignment) {
+    return counted_allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept { return counted_allocate(size, 0); }
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept { return counted_allocate(size, 0); }
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return counted_allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return counted_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { counted_free(pointer); }
+void operator delete[](void* pointer) noexcept { counted_free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { counted_free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { counted_free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { counted_free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { counted_free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { counted_free(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { counted_free(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { counted_free(pointer); }
+
+namespace {
+
+using Json = nlohmann::json;
+
+constexpr uint32_t kDefaultL1SignalBudgetBytes = 768 * 1024;
+constexpr uint32_t kDefaultCoreLimit = 64;
+
+struct AllocationSample {
+    uint64_t allocations{0};
+    uint64_t bytes{0};
+    double elapsed_ms{0.0};
+};
+
+template <typename Body>
+[[nodiscard]] AllocationSample measure_allocations(const uint32_t repeats, Body&& body) {
+    const uint64_t allocations = g_allocation_count.load(std::memory_order_relaxed);
+    const uint64_t bytes = g_allocated_bytes.load(std::memory_order_relaxed);
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t repeat = 0; repeat < repeats; ++repeat) {
+        body();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return AllocationSample{
+        .allocations = g_allocation_count.load(std::memory_order_relaxed) - allocations,
+        .bytes = g_allocated_bytes.load(std::memory_order_relaxed) - bytes,
+        .elapsed_ms = std::chrono::duration<double, std::milli>(stop - start).count(),
+    };
+}
+
+void add_allocation_sample(Json& result, const std::string_view prefix, const AllocationSample& sample) {
+    result[std::string{prefix} + "_allocations"] = sample.allocations;
+    result[std::string{prefix} + "_allocated_bytes"] = sample.bytes;
+    result[std::string{prefix} + "_host_ms"] = sample.elapsed_ms;
+}
+
+// Min, median and max of per-repeat host times, for comparisons that sit
+// close to run-to-run noise.
+void add_host_ms_spread(Json& result, const std::string_view prefix, std::vector<double> times_ms) {
+    std::ranges::sort(times_ms);
+    result[std::string{prefix} + "_min_host_ms"] = times_ms.front();
+    result[std::string{prefix} + "_median_host_ms"] = times_ms[times_ms.size() / 2];
+    result[std::string{prefix} + "_max_host_ms"] = times_ms.back();
+}
+
+// Compares the allocating vector builders against the span writers that
+// stream into one reused staging buffer, as `prepare_*` does on device.
+template <typename Scheme>
+[[nodiscard]] Json run_config_words(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const uint32_t dimension = request.value("dimension", 1U);
+    const uint32_t repeats = request.value("repeats", 16U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const std::string transform = request.value("transform", "lwt");
+
+    std::vector<uint32_t> staging;
+    size_t word_count = 0;
+    size_t chunk_count = 0;
+    AllocationSample vector_sample;
+    AllocationSample span_sample;
+    bool identical = false;
+
+    const auto compare = [&](const auto& build_all, const auto& write_all) {
+        vector_sample = measure_allocations(repeats, [&]() { static_cast<void>(build_all()); });
+        staging.resize(word_count);
+        span_sample = measure_allocations(repeats, [&]() { write_all(std::span<uint32_t>{staging}); });
+        identical = build_all() == staging;
+    };
+
+    if (dimension == 1) {
+        const size_t length = request.at("length").get<size_t>();
+        if (transform == "lwt") {
+            const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+                ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+                core_limit,
+                kDefaultL1SignalBudgetBytes);
+            const ttwv::LwtConfigAddresses addresses{
+                .slots = {0x1000, 0x2000, 0x3000}, .final_even = 0x4000, .final_odd = 0x5000};
+            const ttwv::ExtensionGatherTable extension_table =
+                ttwv::make_extension_gather_table(ttwv::lwt_extension_table_key(plan));
+            word_count = ttwv::lwt_config_upload_word_count(plan);
+            chunk_count = plan.chunks.size();
+            compare(
+                [&]() {
+                    std::vector<uint32_t> words = ttwv::build_lwt_chunk_config_words(plan);
+                    const std::vector<uint32_t> routes = ttwv::build_lwt_route_config_words(plan, addresses);
+                    const std::vector<uint32_t> extension = ttwv::build_extension_config_words(extension_table);
+                    words.insert(words.end(), routes.begin(), routes.end());
+                    words.insert(words.end(), extension.begin(), extension.end());
+                    return words;
+                },
+                [&](const std::span<uint32_t> words) {
+                    const std::span<uint32_t> chunks = ttwv::write_lwt_chunk_config_words(plan, words);
+                    const std::span<uint32_t> routes =
+                        ttwv::write_lwt_route_config_words(plan, addresses, words.subspan(chunks.size()));
+                    ttwv::write_extension_config_words(extension_table, words.subspan(chunks.size() + routes.size()));
+                });
+        } else {
+            const size_t coefficient_length =
+                ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode)
+                    .output_length;
+            ttwv::LiftingInversePlan full_plan =
+                ttwv::make_inverse_lifting_plan<Scheme>(length, coefficient_length, boundary_mode);
+            const ttwv::IlwtExecutionPlan plan = ttwv::make_ilwt_execution_plan(
+                std::move(full_plan), core_limit, kDefaultL1SignalBudgetBytes, ttwv::WorkspaceLayout::kRowMajor, false);
+            const ttwv::IlwtConfigAddresses addresses{.slots = {0x1000, 0x2000, 0x3000}};
+            word_count = ttwv::ilwt_config_upload_word_count(plan);
+            chunk_count = plan.chunks.size();
+            compare(
+                [&]() {
+                    std::vector<uint32_t> words = ttwv::build_ilwt_chunk_config_words(plan, addresses);
+                    const std::vector<uint32_t> routes = ttwv::build_ilwt_route_config_words(plan, addresses);
+                    words.insert(words.end(), routes.begin(), routes.end());
+                    return words;
+                },
+                [&](const std::span<uint32_t> words) {
+                    const std::span<uint32_t> chunks = ttwv::write_ilwt_chunk_config_words(plan, addresses, words);
+                    ttwv::write_ilwt_route_config_words(plan, addresses, words.subspan(chunks.size()));
+                });
+        }
+    } else {
+        const size_t height = request.at("height").get<size_t>();
+        const size_t width = request.at("width").get<size_t>();
+        if (transform == "lwt") {
+            const ttwv::Lwt2DExecutionPlan plan = ttwv::make_lwt_2d_execution_plan<Scheme>(
+                height, width, core_limit, kDefaultL1SignalBudgetBytes, boundary_mode, true, true);
+            word_count = ttwv::lwt_2d_config_upload_word_count(plan);
+            chunk_count = plan.chunks.size();
+            compare(
+                [&]() {
+                    std::vector<uint32_t> words = ttwv::build_lwt_2d_chunk_config_words(plan);
+                    const std::vector<uint32_t> routes = ttwv::build_lwt_2d_route_config_words(plan);
+                    const std::vector<uint32_t> bands = ttwv::build_lwt_2d_band_config_words(plan);
+                    words.insert(words.end(), routes.begin(), routes.end());
+                    words.insert(words.end(), bands.begin(), bands.end());
+                    return words;
+                },
+                [&](const std::span<uint32_t> words) {
+                    const std::span<uint32_t> chunks = ttwv::write_lwt_2d_chunk_config_words(plan, words);
+                    const std::span<uint32_t> routes =
+                        ttwv::write_lwt_2d_route_config_words(plan, words.subspan(chunks.size()));
+                    ttwv::write_lwt_2d_band_config_words(plan, words.subspan(chunks.size() + routes.size()));
+                });
+        } else {
+            const ttwv::Ilwt2DExecutionPlan plan = ttwv::make_ilwt_2d_execution_plan<Scheme>(
+                height, width, core_limit, kDefaultL1SignalBudgetBytes, boundary_mode);
+            word_count = ttwv::ilwt_2d_config_upload_word_count(plan);
+            chunk_count = plan.chunks.size();
+            compare(
+                [&]() {
+                    std::vector<uint32_t> words = ttwv::build_ilwt_2d_chunk_config_words(plan);
+                    const std::vector<uint32_t> routes = ttwv::build_ilwt_2d_route_config_words(plan);
+                    const std::vector<uint32_t> bands = ttwv::build_ilwt_2d_band_config_words(plan);
+                    words.insert(words.end(), routes.begin(), routes.end());
+                    words.insert(words.end(), bands.begin(), bands.end());
+                    return words;
+                },
+                [&](const std::span<uint32_t> words) {
+                    const std::span<uint32_t> chunks = ttwv::write_ilwt_2d_chunk_config_words(plan, words);
+                    const std::span<uint32_t> routes =
+                        ttwv::write_ilwt_2d_route_config_words(plan, words.subspan(chunks.size()));
+                    ttwv::write_ilwt_2d_band_config_words(plan, words.subspan(chunks.size() + routes.size()));
+                });
+        }
+    }
+
+    Json result;
+    result["chunk_count"] = chunk_count;
+    result["config_words"] = word_count;
+    result["config_bytes"] = word_count * sizeof(uint32_t);
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "vector", vector_sample);
+    add_allocation_sample(result, "span", span_sample);
+    result["identical_words"] = identical;
+    return result;
+}
+
+[[nodiscard]] std::vector<float> make_host_signal(const size_t length) {
+    std::vector<float> signal(length);
+    for (size_t index = 0; index < length; ++index) {
+        signal[index] = std::sin(0.37F * static_cast<float>(index)) + 0.01F * static_cast<float>(index % 977);
+    }
+    return signal;
+}
+
+[[nodiscard]] float max_abs_difference(const std::span<const float> lhs, const std::span<const float> rhs) {
+    float difference = 0.0F;
+    for (size_t index = 0; index < std::min(lhs.size(), rhs.size()); ++index) {
+        difference = std::max(difference, std::abs(lhs[index] - rhs[index]));
+    }
+    return difference;
+}
+
+// Serves evenly spaced lengths of one bucket from a single bucket plan and
+// compares against replanning every length, both on the host executor.
+template <typename Scheme>
+[[nodiscard]] Json run_bucket(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.at("length").get<size_t>();
+    const uint32_t groups_per_bucket = request.value("groups_per_bucket", 1U);
+    const uint32_t sample_count = std::max(request.value("samples", 8U), 2U);
+    const uint32_t repeats = request.value("repeats", 4U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    const ttwv::LengthBucket bucket = ttwv::make_lwt_length_bucket<Scheme>(length, groups_per_bucket, boundary_mode);
+    ttwv::LwtBucketedExecutionPlan bucketed;
+    const AllocationSample bucket_plan_sample = measure_allocations(1, [&]() {
+        bucketed = ttwv::make_bucketed_lwt_execution_plan<Scheme>(
+            bucket, core_limit, kDefaultL1SignalBudgetBytes, boundary_mode);
+    });
+    const std::vector<ttwv::HostRouteCoefficients> bucket_coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(bucketed.plan.full_plan);
+
+    std::vector<size_t> lengths(sample_count);
+    for (uint32_t sample = 0; sample < sample_count; ++sample) {
+        lengths[sample] = bucket.min_length + (bucket.size() - 1) * sample / (sample_count - 1);
+    }
+    const std::vector<float> signal = make_host_signal(bucket.max_length);
+    std::vector<float> replan_approximation(bucketed.plan.full_plan.output_length);
+    std::vector<float> replan_detail(replan_approximation.size());
+    std::vector<float> bucket_approximation(replan_approximation.size());
+    std::vector<float> bucket_detail(replan_approximation.size());
+    ttwv::HostLwtWorkspace workspace;
+
+    AllocationSample replan_sample;
+    AllocationSample bucket_sample;
+    float max_difference = 0.0F;
+    uint64_t required_outputs = 0;
+    uint64_t computed_outputs = 0;
+    for (const size_t sample_length : lengths) {
+        const std::span<const float> input{signal.data(), sample_length};
+        const size_t output_length = ttwv::forward_lifting_output_length<Scheme>(sample_length, boundary_mode);
+        const std::span<float> replan_a{replan_approximation.data(), output_length};
+        const std::span<float> replan_d{replan_detail.data(), output_length};
+        const AllocationSample replan = measure_allocations(repeats, [&]() {
+            const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+                ttwv::make_forward_lifting_plan<Scheme>(
+                    ttwv::SignalBuffer{.length = sample_length}, 0, 0, boundary_mode),
+                core_limit,
+                kDefaultL1SignalBudgetBytes);
+            const std::vector<ttwv::HostRouteCoefficients> coefficients =
+                ttwv::make_host_lwt_route_coefficients<Scheme>(plan.full_plan);
+            ttwv::execute_lwt_on_host(plan, coefficients, input, replan_a, replan_d, workspace, plan.chunks.size());
+        });
+
+        const ttwv::LwtBucketRuntime runtime = ttwv::bind_lwt_bucket_runtime<Scheme>(bucketed, sample_length);
+        const std::span<float> bucket_a{bucket_approximation.data(), runtime.output_length};
+        const std::span<float> bucket_d{bucket_detail.data(), runtime.output_length};
+        const AllocationSample bucketed_run = measure_allocations(repeats, [&]() {
+            ttwv::execute_lwt_on_host(
+                bucketed.plan, bucket_coefficients, input, bucket_a, bucket_d, workspace, runtime.active_chunk_count);
+        });
+
+        replan_sample.allocations += replan.allocations;
+        replan_sample.bytes += replan.bytes;
+        replan_sample.elapsed_ms += replan.elapsed_ms;
+        bucket_sample.allocations += bucketed_run.allocations;
+        bucket_sample.bytes += bucketed_run.bytes;
+        bucket_sample.elapsed_ms += bucketed_run.elapsed_ms;
+        max_difference = std::max(
+            {max_difference, max_abs_difference(replan_a, bucket_a), max_abs_difference(replan_d, bucket_d)});
+        required_outputs += output_length;
+        computed_outputs += std::min<uint64_t>(
+            uint64_t{runtime.active_chunk_count} * bucketed.plan.groups_per_chunk *
+                ttwv::device_protocol::kLwtGroupOutputElements,
+            bucketed.plan.full_plan.output_length);
+    }
+
+    Json result;
+    result["bucket_min_length"] = bucket.min_length;
+    result["bucket_max_length"] = bucket.max_length;
+    result["validated_length_count"] = bucketed.validated_length_count;
+    result["chunk_count"] = bucketed.plan.chunks.size();
+    result["min_active_chunk_count"] = bucketed.min_active_chunk_count;
+    result["sampled_lengths"] = lengths;
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "bucket_plan", bucket_plan_sample);
+    add_allocation_sample(result, "replan", replan_sample);
+    add_allocation_sample(result, "bucket", bucket_sample);
+    result["bucket_output_overcompute"] =
+        required_outputs == 0 ? 0.0
+                              : static_cast<double>(computed_outputs - std::min(computed_outputs, required_outputs)) /
+                                    static_cast<double>(required_outputs);
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] = max_difference == 0.0F;
+    return result;
+}
+
+// Replans a `length`-sample plan for `length + length_step` samples and
+// compares it with planning the new length from scratch: planner time, the
+// config pages left to upload, and the host outputs of both plans.
+template <typename Scheme>
+[[nodiscard]] Json run_incremental_replan(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.at("length").get<size_t>();
+    const int64_t length_step = request.value("length_step", int64_t{1});
+    const uint32_t repeats = request.value("repeats", 8U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    if (length_step < 0 && static_cast<size_t>(-length_step) >= length) {
+        throw std::runtime_error("incremental_replan length_step must leave a non-empty signal");
+    }
+    const size_t new_length = static_cast<size_t>(static_cast<int64_t>(length) + length_step);
+    const auto make_forward = [&](const size_t forward_length) {
+        return ttwv::make_forward_lifting_plan<Scheme>(
+            ttwv::SignalBuffer{.length = forward_length}, 0, 0, boundary_mode);
+    };
+
+    const ttwv::LwtExecutionPlan previous =
+        ttwv::make_lwt_execution_plan(make_forward(length), core_limit, kDefaultL1SignalBudgetBytes);
+    ttwv::LwtExecutionPlan fresh;
+    const AllocationSample full_sample = measure_allocations(repeats, [&]() {
+        fresh = ttwv::make_lwt_execution_plan(make_forward(new_length), core_limit, kDefaultL1SignalBudgetBytes);
+    });
+    ttwv::LwtReplan replanned;
+    const AllocationSample replan_sample = measure_allocations(repeats, [&]() {
+        replanned = ttwv::replan_lwt_execution_plan(
+            previous, make_forward(new_length), core_limit, kDefaultL1SignalBudgetBytes);
+    });
+
+    const ttwv::LwtConfigAddresses addresses{
+        .slots = {0x1000, 0x2000, 0x3000},
+        .final_even = 0x4000,
+        .final_odd = 0x5000,
+    };
+    std::vector<uint32_t> chunk_words = ttwv::build_lwt_chunk_config_words(previous);
+    std::vector<uint32_t> route_words = ttwv::build_lwt_route_config_words(previous, addresses);
+    chunk_words.resize(std::max(chunk_words.size(), ttwv::lwt_chunk_config_word_count(replanned.plan)));
+    route_words.resize(std::max(route_words.size(), ttwv::lwt_route_config_word_count(replanned.plan)));
+    const auto [changed_chunk_words, changed_route_words] =
+        ttwv::write_lwt_config_delta_words(replanned.plan, replanned.delta, addresses, chunk_words, route_words);
+    const std::vector<uint32_t> expected_chunk_words = ttwv::build_lwt_chunk_config_words(replanned.plan);
+    const std::vector<uint32_t> expected_route_words = ttwv::build_lwt_route_config_words(replanned.plan, addresses);
+    const bool identical_words =
+        std::equal(expected_chunk_words.begin(), expected_chunk_words.end(), chunk_words.begin()) &&
+        std::equal(expected_route_words.begin(), expected_route_words.end(), route_words.begin());
+
+    const std::vector<float> signal = make_host_signal(new_length);
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(fresh.full_plan);
+    std::vector<float> fresh_approximation(fresh.full_plan.output_length);
+    std::vector<float> fresh_detail(fresh_approximation.size());
+    std::vector<float> replan_approximation(fresh_approximation.size());
+    std::vector<float> replan_detail(fresh_approximation.size());
+    ttwv::execute_lwt_on_host(fresh, coefficients, signal, fresh_approximation, fresh_detail);
+    ttwv::execute_lwt_on_host(replanned.plan, coefficients, signal, replan_approximation, replan_detail);
+    const float max_difference = std::max(
+        max_abs_difference(fresh_approximation, replan_approximation),
+        max_abs_difference(fresh_detail, replan_detail));
+
+    const ttwv::LwtPlanDelta& delta = replanned.delta;
+    Json result;
+    result["new_length"] = new_length;
+    result["previous_chunk_count"] = delta.previous_chunk_count;
+    result["chunk_count"] = delta.chunk_count;
+    result["fresh_chunk_count"] = fresh.chunks.size();
+    result["reused_chunk_count"] = delta.reused_chunk_count();
+    result["changed_chunk_count"] = delta.changed_chunk_count();
+    result["full_rebuild"] = delta.full_rebuild;
+    result["chunk_count_changed"] = delta.chunk_count_changed;
+    result["workspace_changed"] = delta.workspace_changed;
+    result["workspace_elements"] = replanned.plan.workspace_elements;
+    result["fresh_workspace_elements"] = fresh.workspace_elements;
+    result["config_words"] = expected_chunk_words.size() + expected_route_words.size();
+    result["changed_config_words"] = changed_chunk_words.size() + changed_route_words.size();
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "full_plan", full_sample);
+    add_allocation_sample(result, "replan", replan_sample);
+    result["replan_speedup"] =
+        replan_sample.elapsed_ms > 0.0 ? full_sample.elapsed_ms / replan_sample.elapsed_ms : 0.0;
+    result["identical_config_words"] = identical_words;
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] = max_difference == 0.0F;
+    return result;
+}
+
+// Runs a `levels`-level cascade fused under the L1 budget and level by level
+// on the host executor, and reports the chosen stages and per-level halos.
+template <typename Scheme>
+[[nodiscard]] Json run_cascade(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.at("length").get<size_t>();
+    const uint32_t level_count = request.value("levels", 3U);
+    const uint32_t max_fused_levels = request.value("max_fused_levels", level_count);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const uint32_t l1_budget = request.value("l1_signal_budget_bytes", kDefaultL1SignalBudgetBytes);
+
+    ttwv::LwtCascadePlan cascade;
+    const AllocationSample plan_sample = measure_allocations(1, [&]() {
+        cascade = ttwv::make_lwt_cascade_plan<Scheme>(
+            length, level_count, core_limit, l1_budget, boundary_mode, max_fused_levels);
+    });
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(cascade.levels.front());
+    const std::vector<float> signal = make_host_signal(length);
+
+    std::vector<std::vector<float>> fused_details(level_count);
+    std::vector<std::span<float>> fused_detail_spans;
+    for (uint32_t level = 0; level < level_count; ++level) {
+        fused_details[level].resize(cascade.levels[level].output_length);
+        fused_detail_spans.emplace_back(fused_details[level]);
+    }
+    std::vector<float> fused_approximation(cascade.levels.back().output_length);
+    const AllocationSample fused_sample = measure_allocations(1, [&]() {
+        ttwv::execute_lwt_cascade_on_host(cascade, coefficients, signal, fused_approximation, fused_detail_spans);
+    });
+
+    std::vector<std::vector<float>> level_details(level_count);
+    std::vector<float> level_approximation;
+    const AllocationSample level_sample = measure_allocations(1, [&]() {
+        std::vector<float> level_input = signal;
+        for (uint32_t level = 0; level < level_count; ++level) {
+            const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+                ttwv::make_forward_lifting_plan<Scheme>(
+                    ttwv::SignalBuffer{.length = level_input.size()}, 0, 0, boundary_mode),
+                core_limit,
+                l1_budget);
+            level_approximation.resize(plan.full_plan.output_length);
+            level_details[level].resize(plan.full_plan.output_length);
+            ttwv::execute_lwt_on_host(plan, coefficients, level_input, level_approximation, level_details[level]);
+            level_input = level_approximation;
+        }
+    });
+
+    float max_difference = max_abs_difference(fused_approximation, level_approximation);
+    for (uint32_t level = 0; level < level_count; ++level) {
+        max_difference = std::max(max_difference, max_abs_difference(fused_details[level], level_details[level]));
+    }
+
+    Json stages = Json::array();
+    for (const ttwv::LwtCascadeStage& stage : cascade.stages) {
+        stages.push_back({
+            {"first_level", stage.first_level + 1},
+            {"fused_levels", stage.level_count},
+            {"chunk_count", stage.chunk_count()},
+            {"workspace_elements", stage.workspace_elements},
+            {"level_buffer_elements", stage.level_buffer_elements},
+            {"l1_bytes_per_core", stage.l1_bytes_per_core},
+        });
+    }
+    Json levels = Json::array();
+    for (const ttwv::LwtCascadeLevelReport& report : cascade.level_reports) {
+        levels.push_back({
+            {"level", report.level},
+            {"stage", report.stage},
+            {"output_length", report.output_length},
+            {"computed_elements", report.computed_elements},
+            {"max_halo_elements", report.max_halo_elements},
+            {"halo_overhead", report.halo_overhead},
+        });
+    }
+
+    Json result;
+    result["level_count"] = level_count;
+    result["stage_count"] = cascade.stages.size();
+    result["stages"] = std::move(stages);
+    result["levels"] = std::move(levels);
+    result["dram_elements_avoided"] = cascade.dram_elements_avoided;
+    add_allocation_sample(result, "cascade_plan", plan_sample);
+    add_allocation_sample(result, "fused", fused_sample);
+    add_allocation_sample(result, "level_by_level", level_sample);
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] = max_difference == 0.0F;
+    return result;
+}
+
+// Plans one length for each stick width in `stick_widths` and runs it through
+// the paged host emulator, reporting chunk geometry, config words and DRAM
+// pages moved against the device-native plan on the host executor.
+template <typename Scheme>
+[[nodiscard]] Json run_page_size(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.at("length").get<size_t>();
+    const std::vector<uint32_t> stick_widths =
+        request.value("stick_widths", std::vector<uint32_t>{ttwv::kStickWidth, 64, 128});
+    const uint32_t alignment_bytes = request.value("alignment_bytes", ttwv::kNocAlignmentBytes);
+    const uint32_t repeats = request.value("repeats", 4U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const uint32_t l1_budget = request.value("l1_signal_budget_bytes", kDefaultL1SignalBudgetBytes);
+    const auto make_forward = [&]() {
+        return ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode);
+    };
+
+    const ttwv::LwtExecutionPlan reference = ttwv::make_lwt_execution_plan(make_forward(), core_limit, l1_budget);
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(reference.full_plan);
+    const std::vector<float> signal = make_host_signal(length);
+    std::vector<float> reference_approximation(reference.full_plan.output_length);
+    std::vector<float> reference_detail(reference_approximation.size());
+    ttwv::execute_lwt_on_host(reference, coefficients, signal, reference_approximation, reference_detail);
+
+    const ttwv::LwtConfigAddresses addresses{
+        .slots = {0x1000, 0x2000, 0x3000},
+        .final_even = 0x4000,
+        .final_odd = 0x5000,
+    };
+    std::vector<float> approximation(reference_approximation.size());
+    std::vector<float> detail(reference_approximation.size());
+    Json geometries = Json::array();
+    bool all_identical = true;
+    for (const uint32_t stick_width : stick_widths) {
+        const ttwv::LwtPageGeometry geometry{.stick_width = stick_width, .alignment_bytes = alignment_bytes};
+        ttwv::LwtExecutionPlan plan;
+        const AllocationSample plan_sample = measure_allocations(repeats, [&]() {
+            plan = ttwv::make_lwt_execution_plan(
+                make_forward(), core_limit, l1_budget, ttwv::WorkspaceLayout::kRowMajor, geometry);
+        });
+        const std::vector<uint32_t> chunk_words = ttwv::build_lwt_chunk_config_words(plan);
+        const std::vector<uint32_t> route_words = ttwv::build_lwt_route_config_words(plan, addresses);
+        std::fill(approximation.begin(), approximation.end(), 0.0F);
+        std::fill(detail.begin(), detail.end(), 0.0F);
+        const ttwv::LwtPageTraffic traffic =
+            ttwv::emulate_paged_lwt_on_host(plan, coefficients, signal, approximation, detail);
+        const float max_difference = std::max(
+            max_abs_difference(reference_approximation, approximation),
+            max_abs_difference(reference_detail, detail));
+        all_identical = all_identical && max_difference == 0.0F;
+
+        Json entry;
+        entry["stick_width"] = stick_width;
+        entry["page_bytes"] = geometry.page_bytes();
+        entry["group_output_elements"] = geometry.group_output_elements();
+        entry["chunk_count"] = plan.chunks.size();
+        entry["groups_per_chunk"] = plan.groups_per_chunk;
+        entry["workspace_elements"] = plan.workspace_elements;
+        entry["max_dependency_overhead"] = plan.max_dependency_overhead;
+        entry["config_words"] = chunk_words.size() + route_words.size();
+        entry["input_pages"] = traffic.input_pages;
+        entry["input_page_reads"] = traffic.input_page_reads;
+        entry["max_chunk_input_pages"] = traffic.max_chunk_input_pages;
+        entry["output_page_writes"] = traffic.output_page_writes;
+        entry["bytes_read"] = traffic.bytes_read();
+        entry["bytes_written"] = traffic.bytes_written();
+        entry["read_amplification"] = traffic.read_amplification();
+        add_allocation_sample(entry, "plan", plan_sample);
+        entry["max_abs_difference"] = max_difference;
+        geometries.push_back(std::move(entry));
+    }
+
+    Json result;
+    result["output_length"] = reference.full_plan.output_length;
+    result["repeat_count"] = repeats;
+    result["geometries"] = std::move(geometries);
+    result["identical_outputs"] = all_identical;
+    return result;
+}
+
+// Runs one length through segmented windows of `segment_length` samples and
+// through a single unsegmented plan, both on the host executor.
+template <typename Scheme>
+[[nodiscard]] Json run_segmented(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.at("length").get<size_t>();
+    const size_t segment_length = request.value("segment_length", ttwv::max_lwt_segment_length<Scheme>());
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    ttwv::SegmentedLwtPlan segmented;
+    const AllocationSample plan_sample = measure_allocations(1, [&]() {
+        segmented = ttwv::make_segmented_lwt_plan<Scheme>(
+            length, core_limit, kDefaultL1SignalBudgetBytes, boundary_mode, segment_length);
+    });
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(segmented.plans.front().full_plan);
+    const std::vector<float> signal = make_host_signal(length);
+    std::vector<float> segmented_approximation(segmented.output_length);
+    std::vector<float> segmented_detail(segmented_approximation.size());
+    const AllocationSample segmented_sample = measure_allocations(1, [&]() {
+        ttwv::execute_segmented_lwt_on_host(segmented, coefficients, signal, segmented_approximation, segmented_detail);
+    });
+
+    const ttwv::LwtExecutionPlan reference = ttwv::make_lwt_execution_plan(
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes);
+    std::vector<float> reference_approximation(reference.full_plan.output_length);
+    std::vector<float> reference_detail(reference_approximation.size());
+    const AllocationSample reference_sample = measure_allocations(1, [&]() {
+        ttwv::execute_lwt_on_host(
+            reference,
+            ttwv::make_host_lwt_route_coefficients<Scheme>(reference.full_plan),
+            signal,
+            reference_approximation,
+            reference_detail);
+    });
+
+    uint64_t window_samples = 0;
+    for (const ttwv::LwtSegment& segment : segmented.segments) {
+        window_samples += segment.window_length;
+    }
+    const float max_difference = std::max(
+        max_abs_difference(reference_approximation, segmented_approximation),
+        max_abs_difference(reference_detail, segmented_detail));
+
+    Json result;
+    result["output_length"] = segmented.output_length;
+    result["segment_count"] = segmented.segments.size();
+    result["segment_plan_count"] = segmented.plans.size();
+    result["left_halo_outputs"] = segmented.left_halo_outputs;
+    result["window_overlap_samples"] = segmented.window_overlap_samples;
+    result["input_read_overhead"] =
+        static_cast<double>(window_samples - std::min<uint64_t>(window_samples, length)) / static_cast<double>(length);
+    add_allocation_sample(result, "segmented_plan", plan_sample);
+    add_allocation_sample(result, "segmented", segmented_sample);
+    add_allocation_sample(result, "unsegmented", reference_sample);
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] =
+        reference_approximation.size() == segmented_approximation.size() && max_difference == 0.0F;
+    return result;
+}
+
+// Planner allocations and host time for one transform. Plans keep their routes
+// in one LwtRouteTable or Lwt2DRouteTable; 2D plans evaluate tile shapes in a
+// scratch arena.
+template <typename Scheme>
+[[nodiscard]] Json run_planner_allocations(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const uint32_t dimension = request.value("dimension", 1U);
+    const uint32_t repeats = request.value("repeats", 4U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const std::string transform = request.value("transform", "lwt");
+
+    Json result;
+    AllocationSample sample;
+    if (dimension == 1) {
+        const size_t length = request.at("length").get<size_t>();
+        const auto make_forward = [&]() {
+            return ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode);
+        };
+        if (transform == "lwt") {
+            ttwv::LwtExecutionPlan plan;
+            sample = measure_allocations(repeats, [&]() {
+                plan = ttwv::make_lwt_execution_plan(make_forward(), core_limit, kDefaultL1SignalBudgetBytes);
+            });
+            result["chunk_count"] = plan.chunks.size();
+            result["route_rows"] = plan.route_table.rows;
+        } else {
+            const size_t coefficient_length = make_forward().output_length;
+            ttwv::IlwtExecutionPlan plan;
+            sample = measure_allocations(repeats, [&]() {
+                plan = ttwv::make_ilwt_execution_plan(
+                    ttwv::make_inverse_lifting_plan<Scheme>(length, coefficient_length, boundary_mode),
+                    core_limit,
+                    kDefaultL1SignalBudgetBytes,
+                    ttwv::WorkspaceLayout::kRowMajor,
+                    false);
+            });
+            result["chunk_count"] = plan.chunks.size();
+            result["route_rows"] = plan.route_table.rows;
+        }
+    } else {
+        const size_t height = request.at("height").get<size_t>();
+        const size_t width = request.at("width").get<size_t>();
+        if (transform == "lwt") {
+            ttwv::Lwt2DExecutionPlan plan;
+            sample = measure_allocations(repeats, [&]() {
+                plan = ttwv::make_lwt_2d_execution_plan<Scheme>(
+                    height, width, core_limit, kDefaultL1SignalBudgetBytes, boundary_mode, true, true);
+            });
+            result["chunk_count"] = plan.chunks.size();
+        } else {
+            ttwv::Ilwt2DExecutionPlan plan;
+            sample = measure_allocations(repeats, [&]() {
+                plan = ttwv::make_ilwt_2d_execution_plan<Scheme>(
+                    height, width, core_limit, kDefaultL1SignalBudgetBytes, boundary_mode);
+            });
+            result["chunk_count"] = plan.chunks.size();
+        }
+    }
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "planner", sample);
+    result["allocations_per_plan"] = sample.allocations / std::max(repeats, 1U);
+    result["host_ms_per_plan"] = sample.elapsed_ms / std::max(repeats, 1U);
+    return result;
+}
+
+// Lengths with a compile-time plan in the `static_plan` benchmark, kept short
+// so the per-scheme instantiations stay cheap; symmetric extension only.
+constexpr std::array<size_t, 3> kStaticPlanLengths{1024, 4096, 48000};
+
+// Compares runtime planning plus execute_lwt_on_host against the constexpr
+// plan and the length-specialized host executor.
+template <typename Scheme, size_t Length>
+[[nodiscard]] Json run_static_plan_length(const Json& request) {
+    const uint32_t repeats = request.value("repeats", 16U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    constexpr ttwv::BoundaryMode kMode = ttwv::BoundaryMode::kSymmetric;
+
+    ttwv::LwtExecutionPlan plan;
+    const AllocationSample plan_sample = measure_allocations(repeats, [&]() {
+        plan = ttwv::make_lwt_execution_plan(
+            ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = Length}, 0, 0, kMode),
+            core_limit,
+            kDefaultL1SignalBudgetBytes);
+    });
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(plan.full_plan);
+    const std::vector<float> signal = make_host_signal(Length);
+    constexpr size_t kOutputLength = ttwv::kStaticForwardLiftingPlan<Scheme, Length, kMode>.output_length;
+
+    std::vector<float> runtime_approximation(kOutputLength);
+    std::vector<float> runtime_detail(kOutputLength);
+    ttwv::HostLwtWorkspace runtime_workspace;
+    const AllocationSample runtime_sample = measure_allocations(repeats, [&]() {
+        ttwv::execute_lwt_on_host(
+            plan,
+            coefficients,
+            signal,
+            runtime_approximation,
+            runtime_detail,
+            runtime_workspace,
+            plan.chunks.size());
+    });
+
+    std::vector<float> static_approximation(kOutputLength);
+    std::vector<float> static_detail(kOutputLength);
+    ttwv::HostLwtWorkspace static_workspace;
+    const AllocationSample static_sample = measure_allocations(repeats, [&]() {
+        ttwv::execute_static_lwt_on_host<Scheme, Length, kMode>(
+            std::span<const float, Length>{signal.data(), Length},
+            static_approximation,
+            static_detail,
+            static_workspace);
+    });
+
+    const float max_difference = std::max(
+        max_abs_difference(runtime_approximation, static_approximation),
+        max_abs_difference(runtime_detail, static_detail));
+
+    Json result;
+    result["length"] = Length;
+    result["output_length"] = kOutputLength;
+    result["route_count"] = Scheme::num_steps;
+    result["repeats"] = repeats;
+    add_allocation_sample(result, "runtime_plan", plan_sample);
+    add_allocation_sample(result, "runtime_execute", runtime_sample);
+    add_allocation_sample(result, "static_execute", static_sample);
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] = max_difference == 0.0F;
+    return result;
+}
+
+template <typename Scheme>
+[[nodiscard]] Json run_static_plan(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    if (boundary_mode != ttwv::BoundaryMode::kSymmetric) {
+        throw std::runtime_error("static_plan benchmark is compiled for symmetric extension only");
+    }
+    const size_t length = request.at("length").get<size_t>();
+    Json result;
+    const bool matched = [&]<size_t... Lengths>(std::index_sequence<Lengths...>) {
+        return ((length == kStaticPlanLengths[Lengths] &&
+                 (result = run_static_plan_length<Scheme, kStaticPlanLengths[Lengths]>(request), true)) ||
+                ...);
+    }(std::make_index_sequence<kStaticPlanLengths.size()>{});
+    if (!matched) {
+        throw std::runtime_error("static_plan benchmark has no compile-time plan for length " + std::to_string(length));
+    }
+    return result;
+}
+
+[[nodiscard]] ttwv::WorkerGridTopology make_topology(const Json& request) {
+    const std::string architecture = request.value("architecture", "wormhole_b0");
+    const uint32_t harvested_mask = request.value("harvested_mask", 0U);
+    if (architecture == "wormhole_b0") {
+        return ttwv::make_wormhole_b0_topology(harvested_mask);
+    }
+    if (architecture == "blackhole") {
+        return ttwv::make_blackhole_topology(harvested_mask);
+    }
+    throw std::runtime_error("Unsupported worker grid architecture: " + architecture);
+}
+
+// Compares topology-aware core selection with the first-N row-major grid
+// under the DRAM hop model for one batched 1D or 2D forward plan.
+template <typename Scheme>
+[[nodiscard]] Json run_core_selection(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const uint32_t dimension = request.value("dimension", 1U);
+    const uint32_t batch_count = request.value("batch", 1U);
+    const uint32_t repeats = request.value("repeats", 4U);
+    const ttwv::WorkerGridTopology topology = make_topology(request);
+    const uint32_t worker_count = topology.logical_width() * topology.logical_height();
+    const uint32_t core_limit = std::min(request.value("core_limit", worker_count), worker_count);
+
+    std::vector<ttwv::DramBankHistogram> demand;
+    if (dimension == 1) {
+        const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+            ttwv::make_forward_lifting_plan<Scheme>(
+                ttwv::SignalBuffer{.length = request.at("length").get<size_t>()}, 0, 0, boundary_mode),
+            core_limit,
+            kDefaultL1SignalBudgetBytes);
+        const uint32_t work_items = static_cast<uint32_t>(plan.chunks.size()) * batch_count;
+        demand =
+            ttwv::make_lwt_core_slot_demand(plan, batch_count, std::min(core_limit, work_items), topology.bank_count());
+    } else {
+        const ttwv::Lwt2DExecutionPlan plan = ttwv::make_lwt_2d_execution_plan<Scheme>(
+            request.at("height").get<size_t>(),
+            request.at("width").get<size_t>(),
+            core_limit,
+            kDefaultL1SignalBudgetBytes,
+            boundary_mode);
+        const uint32_t work_items = static_cast<uint32_t>(plan.chunks.size()) * batch_count;
+        demand = ttwv::make_lwt_2d_core_slot_demand(
+            plan, batch_count, std::min(core_limit, work_items), topology.bank_count());
+    }
+
+    ttwv::CoreSelection selection;
+    const AllocationSample selection_sample =
+        measure_allocations(repeats, [&]() { selection = ttwv::select_worker_cores(topology, demand); });
+    uint64_t total_pages = 0;
+    for (const ttwv::DramBankHistogram& slot : demand) {
+        total_pages += slot.total_pages();
+    }
+    Json cores = Json::array();
+    for (const ttwv::NocCoordinate core : selection.cores) {
+        cores.push_back({core.x, core.y});
+    }
+
+    Json result;
+    result["topology"] = topology.name;
+    result["worker_grid"] = {topology.logical_width(), topology.logical_height()};
+    result["dram_bank_count"] = topology.bank_count();
+    result["active_core_count"] = selection.cores.size();
+    result["dram_pages"] = total_pages;
+    result["modeled_hops"] = selection.modeled_hops;
+    result["first_n_modeled_hops"] = selection.first_n_modeled_hops;
+    result["modeled_hops_per_page"] =
+        total_pages == 0 ? 0.0 : static_cast<double>(selection.modeled_hops) / static_cast<double>(total_pages);
+    result["first_n_modeled_hops_per_page"] =
+        total_pages == 0 ? 0.0
+                         : static_cast<double>(selection.first_n_modeled_hops) / static_cast<double>(total_pages);
+    result["cores"] = std::move(cores);
+    add_allocation_sample(result, "selection", selection_sample);
+    return result;
+}
+
+// Placement leaves the plan in chunk order and permutes only the uploaded
+// pages: block p of `placed` must be block chunk_order[p] of `plan_order`,
+// where a block is the pages of one chunk.
+[[nodiscard]] bool pages_follow_order(
+    const std::vector<uint32_t>& plan_order,
+    const std::vector<uint32_t>& placed,
+    const std::vector<uint32_t>& chunk_order) {
+    if (placed.size() != plan_order.size() || plan_order.size() % chunk_order.size() != 0) {
+        return false;
+    }
+    const size_t block_words = plan_order.size() / chunk_order.size();
+    for (size_t page = 0; page < chunk_order.size(); ++page) {
+        const auto source = plan_order.begin() + static_cast<std::ptrdiff_t>(chunk_order[page] * block_words);
+        if (!std::equal(
+                source,
+                source + static_cast<std::ptrdiff_t>(block_words),
+                placed.begin() + static_cast<std::ptrdiff_t>(page * block_words))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]] Json traffic_report_json(const ttwv::DramTrafficReport& report) {
+    Json result;
+    result["bank_pages"] = report.bank_pages;
+    result["total_bytes"] = report.total_pages * report.page_bytes;
+    result["modeled_hops"] = report.modeled_hops;
+    result["max_core_pages"] = report.max_core_pages;
+    result["max_core_bytes"] = report.max_core_pages * report.page_bytes;
+    result["max_core_hops"] = report.max_core_hops;
+    return result;
+}
+
+// Predicted DRAM traffic of planner order versus bank-aware chunk placement
+// for one 1D or 2D forward plan, and a check that the placed config pages are
+// the planner-order pages permuted by the placement.
+template <typename Scheme>
+[[nodiscard]] Json run_chunk_placement(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const uint32_t dimension = request.value("dimension", 1U);
+    const uint32_t repeats = request.value("repeats", 4U);
+    const ttwv::WorkerGridTopology topology = make_topology(request);
+    const uint32_t worker_count = topology.logical_width() * topology.logical_height();
+    const uint32_t core_limit = std::min(request.value("core_limit", worker_count), worker_count);
+
+    ttwv::ChunkPlacement placement;
+    Json result;
+    if (dimension == 1) {
+        const size_t length = request.at("length").get<size_t>();
+        const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+            ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+            core_limit,
+            kDefaultL1SignalBudgetBytes);
+        const std::vector<ttwv::DramBankHistogram> histograms =
+            ttwv::make_lwt_chunk_bank_histograms(plan, topology.bank_count());
+        const uint32_t active_cores = std::min(core_limit, static_cast<uint32_t>(plan.chunks.size()));
+        const AllocationSample placement_sample = measure_allocations(repeats, [&]() {
+            placement = ttwv::place_chunks_near_dram_banks(
+                topology,
+                histograms,
+                active_cores,
+                plan.full_plan.preprocess_layout.input.aligned_stick_bytes());
+        });
+        add_allocation_sample(result, "placement", placement_sample);
+
+        const ttwv::LwtConfigAddresses addresses{};
+        std::vector<uint32_t> chunk_words(ttwv::lwt_chunk_config_word_count(plan));
+        std::vector<uint32_t> route_words(ttwv::lwt_route_config_word_count(plan));
+        std::vector<uint32_t> placed_chunk_words(chunk_words.size());
+        std::vector<uint32_t> placed_route_words(route_words.size());
+        ttwv::write_lwt_chunk_config_words(plan, chunk_words);
+        ttwv::write_lwt_route_config_words(plan, addresses, route_words);
+        ttwv::write_lwt_chunk_config_words(plan, placed_chunk_words, placement.chunk_order);
+        ttwv::write_lwt_route_config_words(plan, addresses, placed_route_words, placement.chunk_order);
+        result["chunk_count"] = plan.chunks.size();
+        result["config_pages_permuted"] =
+            pages_follow_order(chunk_words, placed_chunk_words, placement.chunk_order) &&
+            pages_follow_order(route_words, placed_route_words, placement.chunk_order);
+    } else {
+        const ttwv::Lwt2DExecutionPlan plan = ttwv::make_lwt_2d_execution_plan<Scheme>(
+            request.at("height").get<size_t>(),
+            request.at("width").get<size_t>(),
+            core_limit,
+            kDefaultL1SignalBudgetBytes,
+            boundary_mode);
+        const std::vector<ttwv::DramBankHistogram> histograms =
+            ttwv::make_lwt_2d_chunk_bank_histograms(plan, topology.bank_count());
+        const uint32_t active_cores = std::min(core_limit, static_cast<uint32_t>(plan.chunks.size()));
+        const AllocationSample placement_sample = measure_allocations(repeats, [&]() {
+            placement = ttwv::place_chunks_near_dram_banks(
+                topology, histograms, active_cores, ttwv::device_protocol::kLwt2DFullTileBytes);
+        });
+        add_allocation_sample(result, "placement", placement_sample);
+        std::vector<uint32_t> placed_chunk_words(ttwv::lwt_2d_chunk_config_word_count(plan));
+        std::vector<uint32_t> placed_route_words(ttwv::lwt_2d_route_config_word_count(plan));
+        ttwv::write_lwt_2d_chunk_config_words(plan, placed_chunk_words, placement.chunk_order);
+        ttwv::write_lwt_2d_route_config_words(plan, placed_route_words, placement.chunk_order);
+        result["chunk_count"] = plan.chunks.size();
+        result["config_pages_permuted"] =
+            pages_follow_order(ttwv::build_lwt_2d_chunk_config_words(plan), placed_chunk_words, placement.chunk_order) &&
+            pages_follow_order(ttwv::build_lwt_2d_route_config_words(plan), placed_route_words, placement.chunk_order);
+    }
+
+    result["topology"] = topology.name;
+    result["active_core_count"] = placement.cores.cores.size();
+    result["reordered"] = placement.reordered();
+    result["plan_order"] = traffic_report_json(placement.plan_order);
+    result["placed"] = traffic_report_json(placement.placed);
+    result["max_core_hops_reduction"] =
+        placement.plan_order.max_core_hops == 0
+            ? 0.0
+            : 1.0 - static_cast<double>(placement.placed.max_core_hops) /
+                        static_cast<double>(placement.plan_order.max_core_hops);
+    return result;
+}
+
+[[nodiscard]] ttwv::BoundaryMode parse_request_boundary_mode(const Json& request) {
+    const std::string mode_name = request.value("boundary_mode", "symmetric");
+    ttwv::BoundaryMode boundary_mode{};
+    if (!ttwv::parse_boundary_mode(mode_name, boundary_mode)) {
+        throw std::runtime_error("Unsupported boundary mode: " + mode_name);
+    }
+    return boundary_mode;
+}
+
+[[nodiscard]] ttwv::LwtBatchItem make_batch_item(
+    const std::string& wavelet, const size_t length, const ttwv::BoundaryMode boundary_mode) {
+    return ttwv::dispatch_scheme(
+        wavelet, [&]<typename Scheme>() { return ttwv::make_lwt_batch_item<Scheme>(length, boundary_mode); });
+}
+
+// Packs items of different schemes, lengths and boundary modes into one
+// schedule and runs it on the host, against one launch per item on the host
+// executor. `sequential_cost` sums each item's busiest core as if the items
+// were launched one after another.
+[[nodiscard]] Json run_mixed_batch(const Json& request) {
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const uint32_t l1_budget = request.value("l1_signal_budget_bytes", kDefaultL1SignalBudgetBytes);
+    const auto make_items = [&]() {
+        std::vector<ttwv::LwtBatchItem> items;
+        for (const Json& entry : request.at("items")) {
+            items.push_back(make_batch_item(
+                entry.at("wavelet").get<std::string>(),
+                entry.at("length").get<size_t>(),
+                parse_request_boundary_mode(entry)));
+        }
+        return items;
+    };
+
+    ttwv::LwtMixedBatchPlan batch;
+    const AllocationSample plan_sample = measure_allocations(
+        1, [&]() { batch = ttwv::make_lwt_mixed_batch_plan(make_items(), core_limit, l1_budget); });
+    uint64_t sequential_cost = 0;
+    for (ttwv::LwtBatchItem& item : make_items()) {
+        std::vector<ttwv::LwtBatchItem> single;
+        single.push_back(std::move(item));
+        sequential_cost += ttwv::make_lwt_mixed_batch_plan(std::move(single), core_limit, l1_budget).max_slot_cost();
+    }
+
+    std::vector<uint32_t> coefficient_words(ttwv::lwt_batch_coefficient_config_word_count(batch));
+    static_cast<void>(ttwv::write_lwt_batch_coefficient_config_words(batch, coefficient_words));
+    bool coefficients_round_trip = true;
+    std::vector<std::vector<float>> signals;
+    std::vector<std::vector<float>> batch_outputs;
+    std::vector<std::vector<float>> item_outputs;
+    for (size_t item = 0; item < batch.item_count(); ++item) {
+        const ttwv::LwtExecutionPlan& plan = batch.plans[item];
+        const std::vector<ttwv::HostRouteCoefficients> decoded = ttwv::read_lwt_coefficient_config_words(
+            coefficient_words, batch.coefficient_page_begin[item], batch.coefficients[item].size());
+        for (size_t route = 0; route < decoded.size(); ++route) {
+            const ttwv::HostRouteCoefficients& expected = batch.coefficients[item][route];
+            coefficients_round_trip = coefficients_round_trip && decoded[route].type == expected.type &&
+                                      decoded[route].k == expected.k &&
+                                      decoded[route].coefficients == expected.coefficients &&
+                                      decoded[route].output_scale == expected.output_scale &&
+                                      decoded[route].palindromic == expected.palindromic;
+        }
+        signals.push_back(make_host_signal(plan.full_plan.preprocess_layout.input.length));
+        for (std::vector<std::vector<float>>* outputs : {&batch_outputs, &item_outputs}) {
+            outputs->emplace_back(plan.full_plan.output_length, 0.0F);
+            outputs->emplace_back(plan.full_plan.output_length, 0.0F);
+        }
+    }
+    std::vector<std::span<const float>> inputs(signals.begin(), signals.end());
+    std::vector<std::span<float>> approximations;
+    std::vector<std::span<float>> details;
+    for (size_t item = 0; item < batch.item_count(); ++item) {
+        approximations.emplace_back(batch_outputs[2 * item]);
+        details.emplace_back(batch_outputs[2 * item + 1]);
+    }
+
+    const AllocationSample batch_sample = measure_allocations(
+        1, [&]() { ttwv::execute_lwt_mixed_batch_on_host(batch, inputs, approximations, details); });
+    const AllocationSample item_sample = measure_allocations(1, [&]() {
+        for (size_t item = 0; item < batch.item_count(); ++item) {
+            ttwv::execute_lwt_on_host(
+                batch.plans[item],
+                batch.coefficients[item],
+                signals[item],
+                item_outputs[2 * item],
+                item_outputs[2 * item + 1]);
+        }
+    });
+    float max_difference = 0.0F;
+    for (size_t output = 0; output < batch_outputs.size(); ++output) {
+        for (size_t i = 0; i < batch_outputs[output].size(); ++i) {
+            max_difference = std::max(max_difference, std::abs(batch_outputs[output][i] - item_outputs[output][i]));
+        }
+    }
+
+    Json result;
+    result["item_count"] = batch.item_count();
+    result["chunk_count"] = batch.work.size();
+    result["slot_count"] = batch.slots.size();
+    result["workspace_elements"] = batch.workspace_elements;
+    result["total_cost"] = batch.total_cost;
+    result["max_slot_cost"] = batch.max_slot_cost();
+    result["sequential_cost"] = sequential_cost;
+    result["imbalance"] = batch.imbalance();
+    result["work_config_words"] = ttwv::lwt_batch_work_config_word_count(batch);
+    result["chunk_config_words"] = ttwv::lwt_batch_chunk_config_word_count(batch);
+    result["route_config_words"] = ttwv::lwt_batch_route_config_word_count(batch);
+    result["coefficient_config_words"] = coefficient_words.size();
+    result["coefficients_round_trip"] = coefficients_round_trip;
+    add_allocation_sample(result, "plan", plan_sample);
+    add_allocation_sample(result, "batch", batch_sample);
+    add_allocation_sample(result, "per_item", item_sample);
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] = max_difference == 0.0F;
+    return result;
+}
+
+// Runs `wavelets` over one signal with a shared input load per chunk and as
+// separate forward LWTs, reporting per-chunk input samples loaded by both.
+[[nodiscard]] Json run_multi_scheme(const Json& request) {
+    const size_t length = request.at("length").get<size_t>();
+    const ttwv::BoundaryMode boundary_mode = parse_request_boundary_mode(request);
+    const uint32_t repeats = request.value("repeats", 4U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const uint32_t l1_budget = request.value("l1_signal_budget_bytes", kDefaultL1SignalBudgetBytes);
+    std::vector<ttwv::LwtBatchItem> items;
+    for (const Json& wavelet : request.at("wavelets")) {
+        items.push_back(make_batch_item(wavelet.get<std::string>(), length, boundary_mode));
+    }
+
+    std::vector<ttwv::LwtExecutionPlan> separate_plans;
+    for (const ttwv::LwtBatchItem& item : items) {
+        separate_plans.push_back(
+            ttwv::make_lwt_execution_plan(ttwv::LiftingForwardPlan{item.forward_plan}, core_limit, l1_budget));
+    }
+    ttwv::LwtMultiSchemePlan plan;
+    const AllocationSample plan_sample = measure_allocations(
+        1, [&]() { plan = ttwv::make_lwt_multi_scheme_plan(items, core_limit, l1_budget); });
+
+    const std::vector<float> signal = make_host_signal(length);
+    std::vector<std::vector<float>> fused_outputs;
+    std::vector<std::vector<float>> separate_outputs;
+    for (const ttwv::LwtExecutionPlan& separate_plan : separate_plans) {
+        for (std::vector<std::vector<float>>* outputs : {&fused_outputs, &separate_outputs}) {
+            outputs->emplace_back(separate_plan.full_plan.output_length, 0.0F);
+            outputs->emplace_back(separate_plan.full_plan.output_length, 0.0F);
+        }
+    }
+    std::vector<std::span<float>> approximations;
+    std::vector<std::span<float>> details;
+    for (size_t scheme = 0; scheme < items.size(); ++scheme) {
+        approximations.emplace_back(fused_outputs[2 * scheme]);
+        details.emplace_back(fused_outputs[2 * scheme + 1]);
+    }
+
+    const AllocationSample fused_sample = measure_allocations(
+        repeats, [&]() { ttwv::execute_lwt_multi_scheme_on_host(plan, signal, approximations, details); });
+    ttwv::HostLwtWorkspace workspace;
+    const AllocationSample separate_sample = measure_allocations(repeats, [&]() {
+        for (size_t scheme = 0; scheme < items.size(); ++scheme) {
+            ttwv::execute_lwt_on_host(
+                separate_plans[scheme],
+                items[scheme].coefficients,
+                signal,
+                separate_outputs[2 * scheme],
+                separate_outputs[2 * scheme + 1],
+                workspace,
+                separate_plans[scheme].chunks.size());
+        }
+    });
+    float max_difference = 0.0F;
+    for (size_t output = 0; output < fused_outputs.size(); ++output) {
+        for (size_t i = 0; i < fused_outputs[output].size(); ++i) {
+            max_difference = std::max(max_difference, std::abs(fused_outputs[output][i] - separate_outputs[output][i]));
+        }
+    }
+
+    Json chunks = Json::array();
+    for (const ttwv::LwtSharedChunk& chunk : plan.chunks) {
+        chunks.push_back({
+            {"output_begin", chunk.outputs.begin},
+            {"output_end", chunk.outputs.end},
+            {"shared_input_elements", chunk.hull_length},
+            {"separate_input_elements", chunk.separate_input_elements},
+            {"input_reduction", chunk.input_reduction()},
+        });
+    }
+    uint64_t separate_plan_input_elements = 0;
+    for (const ttwv::LwtExecutionPlan& separate_plan : separate_plans) {
+        for (const ttwv::LwtChunkPlan& chunk : separate_plan.chunks) {
+            separate_plan_input_elements += chunk.initial_even.length() + chunk.initial_odd.length();
+        }
+    }
+
+    Json result;
+    result["scheme_count"] = plan.scheme_count();
+    result["chunk_count"] = plan.chunks.size();
+    result["workspace_elements"] = plan.workspace_elements;
+    result["shared_elements"] = plan.shared_elements;
+    result["chunks"] = std::move(chunks);
+    result["shared_input_elements"] = plan.shared_input_elements();
+    result["separate_input_elements"] = plan.separate_input_elements();
+    result["separate_plan_input_elements"] = separate_plan_input_elements;
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "plan", plan_sample);
+    add_allocation_sample(result, "fused", fused_sample);
+    add_allocation_sample(result, "separate", separate_sample);
+    result["host_speedup"] = fused_sample.elapsed_ms > 0.0 ? separate_sample.elapsed_ms / fused_sample.elapsed_ms : 0.0;
+    result["max_abs_difference"] = max_difference;
+    result["identical_outputs"] = max_difference == 0.0F;
+    return result;
+}
+
+// Runs 16-bit sensor samples through the paged host emulator in FP32 and in
+// each 16-bit storage format of `formats`, for every scheme in `wavelets`
+// (all registered schemes by default). Reports per scheme and format the
+// chunk geometry, L1 workspace bytes, DRAM bytes moved and the error against
+// the FP32 run.
+[[nodiscard]] Json run_reduced_precision(const Json& request) {
+    const size_t length = request.value("length", size_t{1} << 20);
+    const ttwv::BoundaryMode boundary_mode = parse_request_boundary_mode(request);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+    const uint32_t l1_budget = request.value("l1_signal_budget_bytes", kDefaultL1SignalBudgetBytes);
+    std::vector<ttwv::SampleFormat> formats;
+    for (const Json& name : request.value("formats", Json::array({"bf16", "fp16"}))) {
+        const std::string format_name = name.get<std::string>();
+        ttwv::SampleFormat format{};
+        if (!ttwv::parse_sample_format(format_name, format) || format == ttwv::SampleFormat::kFloat32) {
+            throw std::runtime_error("Unsupported reduced-precision format: " + format_name);
+        }
+        formats.push_back(format);
+    }
+    std::vector<std::string> wavelets;
+    if (request.contains("wavelets")) {
+        wavelets = request.at("wavelets").get<std::vector<std::string>>();
+    } else {
+        for (const ttwv::SchemeInfo& info : ttwv::available_wavelets()) {
+            wavelets.emplace_back(info.name);
+        }
+    }
+
+    // A signed 16-bit ADC trace: every sample is an integer within int16.
+    const std::vector<float> host_signal = make_host_signal(length);
+    std::vector<float> signal(length);
+    for (size_t index = 0; index < length; ++index) {
+        signal[index] = static_cast<float>(std::lround(host_signal[index] * 3000.0F));
+    }
+
+    const auto run_scheme = [&]<typename Scheme>() {
+        const auto plan_for = [&](const ttwv::SampleFormat format) {
+            const ttwv::LwtPageGeometry geometry{.sample_format = format};
+            return ttwv::make_lwt_execution_plan(
+                ttwv::make_forward_lifting_plan<Scheme>(geometry.signal(length), 0, 0, boundary_mode),
+                core_limit,
+                l1_budget,
+                ttwv::WorkspaceLayout::kRowMajor,
+                geometry);
+        };
+        const ttwv::LwtExecutionPlan reference = plan_for(ttwv::SampleFormat::kFloat32);
+        const std::vector<ttwv::HostRouteCoefficients> coefficients =
+            ttwv::make_host_lwt_route_coefficients<Scheme>(reference.full_plan);
+        const size_t output_length = reference.full_plan.output_length;
+        std::vector<float> reference_approximation(output_length);
+        std::vector<float> reference_detail(output_length);
+        const ttwv::LwtPageTraffic reference_traffic = ttwv::emulate_paged_lwt_on_host(
+            reference, coefficients, signal, reference_approximation, reference_detail);
+        float peak = 0.0F;
+        for (size_t index = 0; index < output_length; ++index) {
+            peak = std::max({peak, std::abs(reference_approximation[index]), std::abs(reference_detail[index])});
+        }
+
+        const auto describe = [&](const ttwv::LwtExecutionPlan& plan, const ttwv::LwtPageTraffic& traffic) {
+            Json entry;
+            entry["format"] = std::string{ttwv::sample_format_name(plan.page_geometry.sample_format)};
+            entry["element_bytes"] = plan.page_geometry.element_bytes();
+            entry["chunk_count"] = plan.chunks.size();
+            entry["groups_per_chunk"] = plan.groups_per_chunk;
+            entry["workspace_elements"] = plan.workspace_elements;
+            entry["workspace_bytes_per_core"] = plan.page_geometry.workspace_bytes(plan.workspace_elements);
+            entry["bytes_read"] = traffic.bytes_read();
+            entry["bytes_written"] = traffic.bytes_written();
+            return entry;
+        };
+
+        std::vector<float> approximation(output_length);
+        std::vector<float> detail(output_length);
+        Json entries = Json::array({describe(reference, reference_traffic)});
+        for (const ttwv::SampleFormat format : formats) {
+            const ttwv::LwtExecutionPlan plan = plan_for(format);
+            const ttwv::LwtPageTraffic traffic =
+                ttwv::emulate_paged_lwt_on_host(plan, coefficients, signal, approximation, detail);
+            double squared_error = 0.0;
+            size_t non_finite_outputs = 0;
+            for (size_t index = 0; index < output_length; ++index) {
+                const double approximation_error = approximation[index] - reference_approximation[index];
+                const double detail_error = detail[index] - reference_detail[index];
+                squared_error += approximation_error * approximation_error + detail_error * detail_error;
+                non_finite_outputs +=
+                    (std::isfinite(approximation[index]) ? 0 : 1) + (std::isfinite(detail[index]) ? 0 : 1);
+            }
+            const float max_error = std::max(
+                max_abs_difference(reference_approximation, approximation),
+                max_abs_difference(reference_detail, detail));
+
+            Json entry = describe(plan, traffic);
+            entry["max_abs_error"] = max_error;
+            entry["max_relative_error"] = peak > 0.0F ? max_error / peak : 0.0F;
+            // FP16 saturates above 65504, which large output coefficients can reach.
+            entry["non_finite_outputs"] = non_finite_outputs;
+            entry["rms_error"] = std::sqrt(squared_error / static_cast<double>(2 * std::max<size_t>(output_length, 1)));
+            const uint64_t reference_bytes = reference_traffic.bytes_read() + reference_traffic.bytes_written();
+            entry["dram_bytes_ratio"] = static_cast<double>(traffic.bytes_read() + traffic.bytes_written()) /
+                                        static_cast<double>(std::max<uint64_t>(reference_bytes, 1));
+            entries.push_back(std::move(entry));
+        }
+
+        Json scheme;
+        scheme["wavelet"] = Scheme::name;
+        scheme["output_length"] = output_length;
+        scheme["peak_abs_output"] = peak;
+        scheme["formats"] = std::move(entries);
+        return scheme;
+    };
+
+    Json schemes = Json::array();
+    for (const std::string& wavelet : wavelets) {
+        schemes.push_back(ttwv::dispatch_scheme(wavelet, run_scheme));
+    }
+
+    Json result;
+    result["length"] = length;
+    result["schemes"] = std::move(schemes);
+    return result;
+}
+
+// Gathers `length` samples with a `halo` on each side under every boundary
+// mode, sample by sample, as extension runs and from a precomputed halo
+// table, and reports the run count and the table's one-off build cost.
+[[nodiscard]] Json run_extension_runs(const Json& request) {
+    const size_t length = request.value("length", size_t{4096});
+    const size_t halo = request.value("halo", size_t{4096});
+    const uint32_t repeats = request.value("repeats", 64U);
+    const std::vector<float> signal = make_host_signal(length);
+    const int64_t first = -static_cast<int64_t>(halo);
+    std::vector<float> per_sample(length + 2 * halo, 0.0F);
+    std::vector<float> gathered(per_sample.size(), 0.0F);
+    std::vector<float> tabled(per_sample.size(), 0.0F);
+
+    Json modes = Json::array();
+    for (uint8_t value = 0; value <= static_cast<uint8_t>(ttwv::BoundaryMode::kPeriodization); ++value) {
+        const auto mode = static_cast<ttwv::BoundaryMode>(value);
+        const int64_t end = first + static_cast<int64_t>(per_sample.size());
+        size_t run_count = 0;
+        ttwv::for_each_extension_run(mode, first, end, length, [&](const ttwv::ExtensionRun&) { ++run_count; });
+        const AllocationSample sample_sample = measure_allocations(repeats, [&]() {
+            for (size_t i = 0; i < per_sample.size(); ++i) {
+                const int64_t index = first + static_cast<int64_t>(i);
+                per_sample[i] = ttwv::host_executor_detail::read_extended_sample(signal, mode, index);
+            }
+        });
+        const AllocationSample run_sample = measure_allocations(
+            repeats, [&]() { ttwv::host_executor_detail::gather_extended(signal, mode, first, 1, gathered); });
+        ttwv::ExtensionTableCache cache;
+        const ttwv::ExtensionTableKey key{
+            .mode = mode,
+            .length = static_cast<uint32_t>(length),
+            .left = static_cast<uint32_t>(halo),
+            .right = static_cast<uint32_t>(halo)};
+        const AllocationSample table_build_sample = measure_allocations(1, [&]() { (void)cache.at(key); });
+        const AllocationSample table_sample = measure_allocations(repeats, [&]() {
+            ttwv::gather_from_extension_table(cache.at(key), signal, first, 1, tabled);
+        });
+        const float max_difference =
+            std::max(max_abs_difference(per_sample, gathered), max_abs_difference(per_sample, tabled));
+
+        Json entry;
+        entry["boundary_mode"] = ttwv::boundary_mode_name(mode);
+        entry["run_count"] = run_count;
+        add_allocation_sample(entry, "per_sample", sample_sample);
+        add_allocation_sample(entry, "runs", run_sample);
+        add_allocation_sample(entry, "table_build", table_build_sample);
+        add_allocation_sample(entry, "table", table_sample);
+        entry["host_speedup"] = run_sample.elapsed_ms > 0.0 ? sample_sample.elapsed_ms / run_sample.elapsed_ms : 0.0;
+        entry["table_host_speedup"] =
+            table_sample.elapsed_ms > 0.0 ? sample_sample.elapsed_ms / table_sample.elapsed_ms : 0.0;
+        entry["max_abs_difference"] = max_difference;
+        entry["identical_outputs"] = max_difference == 0.0F;
+        modes.push_back(std::move(entry));
+    }
+
+    Json result;
+    result["length"] = length;
+    result["halo"] = halo;
+    result["repeat_count"] = repeats;
+    result["modes"] = std::move(modes);
+    return result;
+}
+
+// Times the host executor with and without the folded stencil of
+// palindromic predict/update steps over one plan, one repeat at a time.
+template <typename Scheme>
+[[nodiscard]] Json run_symmetric_folding(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.value("length", size_t{1} << 20);
+    const uint32_t repeats = request.value("repeats", 8U);
+    if (repeats == 0) {
+        throw std::runtime_error("symmetric_folding needs at least one repeat");
+    }
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes);
+    const std::vector<ttwv::HostRouteCoefficients> folded =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(plan.full_plan);
+    std::vector<ttwv::HostRouteCoefficients> unfolded = folded;
+    uint64_t multiplies = 0;
+    uint64_t folded_multiplies = 0;
+    for (ttwv::HostRouteCoefficients& route : unfolded) {
+        if (ttwv::is_predict_update_step(route.type)) {
+            multiplies += route.k;
+            folded_multiplies += route.palindromic ? (route.k + 1) / 2 : route.k;
+        }
+        route.palindromic = false;
+    }
+
+    const std::vector<float> signal = make_host_signal(length);
+    const size_t output_length = plan.full_plan.output_length;
+    std::vector<float> folded_approximation(output_length);
+    std::vector<float> folded_detail(output_length);
+    std::vector<float> unfolded_approximation(output_length);
+    std::vector<float> unfolded_detail(output_length);
+    ttwv::HostLwtWorkspace workspace;
+    // One untimed run sizes the workspace and warms the caches for both.
+    ttwv::execute_lwt_on_host(
+        plan, unfolded, signal, unfolded_approximation, unfolded_detail, workspace, plan.chunks.size());
+    // The two variants alternate so clock and cache drift reach both alike.
+    std::vector<double> folded_ms;
+    std::vector<double> unfolded_ms;
+    uint64_t allocations = 0;
+    for (uint32_t repeat = 0; repeat < repeats; ++repeat) {
+        const AllocationSample folded_sample = measure_allocations(1, [&]() {
+            ttwv::execute_lwt_on_host(
+                plan, folded, signal, folded_approximation, folded_detail, workspace, plan.chunks.size());
+        });
+        const AllocationSample unfolded_sample = measure_allocations(1, [&]() {
+            ttwv::execute_lwt_on_host(
+                plan, unfolded, signal, unfolded_approximation, unfolded_detail, workspace, plan.chunks.size());
+        });
+        folded_ms.push_back(folded_sample.elapsed_ms);
+        unfolded_ms.push_back(unfolded_sample.elapsed_ms);
+        allocations += folded_sample.allocations + unfolded_sample.allocations;
+    }
+
+    Json result;
+    result["length"] = length;
+    result["palindromic_steps"] = ttwv::palindromic_step_count<Scheme>();
+    result["predict_update_multiplies"] = multiplies;
+    result["folded_multiplies"] = folded_multiplies;
+    result["repeat_count"] = repeats;
+    result["timed_allocations"] = allocations;
+    add_host_ms_spread(result, "folded", std::move(folded_ms));
+    add_host_ms_spread(result, "unfolded", std::move(unfolded_ms));
+    result["max_abs_difference"] = std::max(
+        max_abs_difference(folded_approximation, unfolded_approximation),
+        max_abs_difference(folded_detail, unfolded_detail));
+    return result;
+}
+
+// Times the banded GEMM engine against the per-signal stencil executor for
+// each batch size in `batches`; the stencil runs unfolded coefficients so
+// both engines add the same taps in the same order.
+template <typename Scheme>
+[[nodiscard]] Json run_banded_gemm(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.value("length", size_t{4096});
+    const std::vector<uint32_t> batches = request.value("batches", std::vector<uint32_t>{1, 8, 64, 256});
+    const uint32_t repeats = request.value("repeats", 8U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    const ttwv::LiftingForwardPlan forward_plan =
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode);
+    const ttwv::LwtExecutionPlan plan =
+        ttwv::make_lwt_execution_plan(forward_plan, core_limit, kDefaultL1SignalBudgetBytes);
+    std::vector<ttwv::HostRouteCoefficients> stencil = ttwv::make_host_lwt_route_coefficients<Scheme>(plan.full_plan);
+    for (ttwv::HostRouteCoefficients& route : stencil) {
+        route.palindromic = false;
+    }
+    const std::vector<ttwv::HostRouteCoefficients> banded = ttwv::make_banded_gemm_coefficients<Scheme>();
+    uint32_t max_k = 0;
+    for (const ttwv::HostRouteCoefficients& step : banded) {
+        max_k = ttwv::is_predict_update_step(step.type) ? std::max(max_k, step.k) : max_k;
+    }
+
+    const std::vector<float> signal = make_host_signal(length);
+    const size_t output_length = forward_plan.output_length;
+    Json runs = Json::array();
+    for (const uint32_t batch : batches) {
+        std::vector<std::vector<float>> stencil_outputs(2 * batch, std::vector<float>(output_length));
+        std::vector<std::vector<float>> banded_outputs(2 * batch, std::vector<float>(output_length));
+        const std::vector<std::span<const float>> inputs(batch, signal);
+        std::vector<std::span<float>> approximations;
+        std::vector<std::span<float>> details;
+        for (uint32_t item = 0; item < batch; ++item) {
+            approximations.emplace_back(banded_outputs[2 * item]);
+            details.emplace_back(banded_outputs[2 * item + 1]);
+        }
+        ttwv::HostLwtWorkspace stencil_workspace;
+        ttwv::HostLwtWorkspace banded_workspace;
+        const auto run_stencil = [&]() {
+            for (uint32_t item = 0; item < batch; ++item) {
+                ttwv::execute_lwt_on_host(
+                    plan,
+                    stencil,
+                    signal,
+                    stencil_outputs[2 * item],
+                    stencil_outputs[2 * item + 1],
+                    stencil_workspace,
+                    plan.chunks.size());
+            }
+        };
+        const auto run_banded = [&]() {
+            ttwv::execute_banded_gemm_lwt_on_host(
+                forward_plan, banded, inputs, approximations, details, banded_workspace);
+        };
+        // One untimed run of each sizes the workspaces and warms the caches.
+        run_stencil();
+        run_banded();
+        const AllocationSample stencil_sample = measure_allocations(repeats, run_stencil);
+        const AllocationSample banded_sample = measure_allocations(repeats, run_banded);
+
+        float difference = 0.0F;
+        for (size_t index = 0; index < stencil_outputs.size(); ++index) {
+            difference = std::max(difference, max_abs_difference(stencil_outputs[index], banded_outputs[index]));
+        }
+        Json run;
+        run["batch_count"] = batch;
+        add_allocation_sample(run, "stencil", stencil_sample);
+        add_allocation_sample(run, "banded_gemm", banded_sample);
+        run["host_speedup"] =
+            banded_sample.elapsed_ms > 0.0 ? stencil_sample.elapsed_ms / banded_sample.elapsed_ms : 0.0;
+        run["max_abs_difference"] = difference;
+        runs.push_back(std::move(run));
+    }
+
+    Json result;
+    result["length"] = length;
+    result["max_k"] = max_k;
+    result["panel_columns"] = ttwv::banded_gemm_panel_columns(forward_plan);
+    result["repeat_count"] = repeats;
+    result["batches"] = std::move(runs);
+    return result;
+}
+
+// Times both host engines over a batch of one length and reports which one
+// the cost model selects, with the modeled costs as telemetry.
+template <typename Scheme>
+[[nodiscard]] Json run_engine_selection(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.value("length", size_t{1} << 16);
+    const uint32_t batch = request.value("batch", 1U);
+    const uint32_t repeats = request.value("repeats", 8U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes);
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(plan.full_plan);
+    const std::vector<float> signal = make_host_signal(length);
+    const size_t output_length = plan.full_plan.output_length;
+    std::vector<float> lifting_approximation(output_length);
+    std::vector<float> lifting_detail(output_length);
+    std::vector<float> fir_approximation(output_length);
+    std::vector<float> fir_detail(output_length);
+    ttwv::HostLwtWorkspace workspace;
+    ttwv::execute_lwt_on_host(
+        plan, coefficients, signal, lifting_approximation, lifting_detail, workspace, plan.chunks.size());
+
+    // Each repeat composes the bank once and runs the whole batch, which is
+    // the work the cost model charges the FIR engine.
+    ttwv::PolyphaseFirBank bank = ttwv::make_polyphase_fir_bank<Scheme>();
+    const AllocationSample lifting_sample = measure_allocations(repeats, [&]() {
+        for (uint32_t item = 0; item < batch; ++item) {
+            ttwv::execute_lwt_on_host(
+                plan, coefficients, signal, lifting_approximation, lifting_detail, workspace, plan.chunks.size());
+        }
+    });
+    const AllocationSample fir_sample = measure_allocations(repeats, [&]() {
+        bank = ttwv::make_polyphase_fir_bank<Scheme>();
+        for (uint32_t item = 0; item < batch; ++item) {
+            ttwv::execute_polyphase_fir_on_host(bank, signal, boundary_mode, fir_approximation, fir_detail);
+        }
+    });
+    const ttwv::LwtEngineSelection selection = ttwv::select_lwt_engine(plan, coefficients, bank, batch);
+    const ttwv::LwtEngine measured =
+        fir_sample.elapsed_ms < lifting_sample.elapsed_ms ? ttwv::LwtEngine::kPolyphaseFir : ttwv::LwtEngine::kLifting;
+
+    Json result;
+    result["length"] = length;
+    result["batch_count"] = selection.batch_count;
+    result["repeat_count"] = repeats;
+    result["selected_engine"] = ttwv::lwt_engine_name(selection.engine);
+    result["measured_engine"] = ttwv::lwt_engine_name(measured);
+    result["lifting_route_count"] = selection.lifting_route_count;
+    result["lifting_taps"] = selection.lifting_taps;
+    result["polyphase_fir_taps"] = selection.polyphase_fir_taps;
+    result["polyphase_fir_edge_outputs"] = selection.polyphase_fir_edge_outputs;
+    result["lifting_cost"] = selection.lifting_cost;
+    result["polyphase_fir_cost"] = selection.polyphase_fir_cost;
+    result["polyphase_fir_deviation"] = selection.polyphase_fir_deviation;
+    add_allocation_sample(result, "lifting", lifting_sample);
+    add_allocation_sample(result, "polyphase_fir", fir_sample);
+    result["max_abs_difference"] = std::max(
+        max_abs_difference(fir_approximation, lifting_approximation), max_abs_difference(fir_detail, lifting_detail));
+    return result;
+}
+
+// Plans `length` into chunks, splits them into interior and edge chunks, and
+// times the interior chunks' initial stream loads and the whole host run with
+// the extension-free path against the same plan with every chunk marked edge.
+template <typename Scheme>
+[[nodiscard]] Json run_interior_chunks(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const size_t length = request.value("length", size_t{1} << 20);
+    const uint32_t repeats = request.value("repeats", 8U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes);
+    ttwv::LwtExecutionPlan edge_plan = plan;
+    size_t interior_chunks = 0;
+    for (ttwv::LwtChunkPlan& chunk : edge_plan.chunks) {
+        interior_chunks += chunk.interior ? 1 : 0;
+        chunk.interior = false;
+    }
+    const std::vector<ttwv::HostRouteCoefficients> coefficients =
+        ttwv::make_host_lwt_route_coefficients<Scheme>(plan.full_plan);
+    const std::vector<float> signal = make_host_signal(length);
+    ttwv::HostLwtWorkspace workspace;
+    const ttwv::ExtensionGatherTable& table =
+        workspace.extension_tables.at(ttwv::extension_table_key(plan.full_plan, length));
+    const auto load_interior_chunks = [&](const bool interior) {
+        for (const ttwv::LwtChunkPlan& chunk : plan.chunks) {
+            if (!chunk.interior) {
+                continue;
+            }
+            ttwv::host_executor_detail::load_initial_stream(
+                workspace.at(ttwv::StorageSlot::kA), chunk.initial_even, 0, signal, table, interior);
+            ttwv::host_executor_detail::load_initial_stream(
+                workspace.at(ttwv::StorageSlot::kB), chunk.initial_odd, 1, signal, table, interior);
+        }
+    };
+
+    const size_t output_length = plan.full_plan.output_length;
+    std::vector<float> approximation(output_length);
+    std::vector<float> detail(output_length);
+    std::vector<float> edge_approximation(output_length);
+    std::vector<float> edge_detail(output_length);
+    // Untimed passes size the workspace and fault in the outputs of both paths.
+    ttwv::execute_lwt_on_host(plan, coefficients, signal, approximation, detail, workspace, plan.chunks.size());
+    ttwv::execute_lwt_on_host(
+        edge_plan, coefficients, signal, edge_approximation, edge_detail, workspace, plan.chunks.size());
+    load_interior_chunks(true);
+    load_interior_chunks(false);
+    const AllocationSample interior_load_sample = measure_allocations(repeats, [&]() { load_interior_chunks(true); });
+    const AllocationSample edge_load_sample = measure_allocations(repeats, [&]() { load_interior_chunks(false); });
+    const AllocationSample interior_sample = measure_allocations(repeats, [&]() {
+        ttwv::execute_lwt_on_host(plan, coefficients, signal, approximation, detail, workspace, plan.chunks.size());
+    });
+    const AllocationSample edge_sample = measure_allocations(repeats, [&]() {
+        ttwv::execute_lwt_on_host(
+            edge_plan, coefficients, signal, edge_approximation, edge_detail, workspace, plan.chunks.size());
+    });
+
+    Json result;
+    result["length"] = length;
+    result["chunk_count"] = plan.chunks.size();
+    result["interior_chunk_count"] = interior_chunks;
+    result["edge_chunk_count"] = plan.chunks.size() - interior_chunks;
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "interior_load", interior_load_sample);
+    add_allocation_sample(result, "edge_load", edge_load_sample);
+    add_allocation_sample(result, "interior", interior_sample);
+    add_allocation_sample(result, "all_edge", edge_sample);
+    result["load_speedup"] =
+        interior_load_sample.elapsed_ms > 0.0 ? edge_load_sample.elapsed_ms / interior_load_sample.elapsed_ms : 0.0;
+    result["host_speedup"] =
+        interior_sample.elapsed_ms > 0.0 ? edge_sample.elapsed_ms / interior_sample.elapsed_ms : 0.0;
+    result["identical_outputs"] = approximation == edge_approximation && detail == edge_detail;
+    return result;
+}
+
+// Runs the reversible integer 5/3 forward and inverse transforms over 16-bit
+// samples, checks that the round trip is lossless, and times the forward run
+// against the float bior2.2 transform followed by a rounding quantizer.
+[[nodiscard]] Json run_integer_lifting(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    using IntegerScheme = ttwv::schemes::integer::legall5_3;
+    using FloatScheme = ttwv::schemes::bior2_2;
+    const size_t length = request.value("length", size_t{1} << 20);
+    const uint32_t repeats = request.value("repeats", 8U);
+    const uint32_t core_limit = request.value("core_limit", kDefaultCoreLimit);
+
+    const ttwv::SignalBuffer input{.length = length};
+    const ttwv::LwtExecutionPlan plan = ttwv::make_lwt_execution_plan(
+        ttwv::make_forward_lifting_plan<IntegerScheme>(input, 0, 0, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes);
+    const ttwv::IlwtExecutionPlan inverse_plan = ttwv::make_ilwt_execution_plan(
+        ttwv::make_inverse_lifting_plan<IntegerScheme>(length, plan.full_plan.output_length, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes,
+        ttwv::WorkspaceLayout::kRowMajor,
+        false);
+    const ttwv::LwtExecutionPlan float_plan = ttwv::make_lwt_execution_plan(
+        ttwv::make_forward_lifting_plan<FloatScheme>(input, 0, 0, boundary_mode),
+        core_limit,
+        kDefaultL1SignalBudgetBytes);
+    const std::vector<ttwv::HostIntegerRouteCoefficients> coefficients =
+        ttwv::make_host_integer_lwt_route_coefficients<IntegerScheme>(plan.full_plan);
+    const ttwv::HostIntegerIlwtCoefficients inverse_coefficients =
+        ttwv::make_host_integer_ilwt_coefficients<IntegerScheme>(inverse_plan);
+    const std::vector<ttwv::HostRouteCoefficients> float_coefficients =
+        ttwv::make_host_lwt_route_coefficients<FloatScheme>(float_plan.full_plan);
+
+    const std::vector<float> float_signal = make_host_signal(length);
+    std::vector<int32_t> signal(length);
+    for (size_t index = 0; index < length; ++index) {
+        signal[index] = static_cast<int32_t>(std::lround(float_signal[index] * 8192.0F));
+    }
+    const std::vector<float> quantized_signal(signal.begin(), signal.end());
+
+    const size_t output_length = plan.full_plan.output_length;
+    std::vector<int32_t> approximation(output_length);
+    std::vector<int32_t> detail(output_length);
+    std::vector<int32_t> reconstructed(length);
+    std::vector<float> float_approximation(output_length);
+    std::vector<float> float_detail(output_length);
+    std::vector<int32_t> quantized_approximation(output_length);
+    std::vector<int32_t> quantized_detail(output_length);
+    ttwv::HostIntegerLwtWorkspace workspace;
+    ttwv::HostLwtWorkspace float_workspace;
+    // bior2.2 carries the sqrt(2) normalisation the integer scheme leaves out.
+    const float approximation_scale = 1.0F / std::sqrt(2.0F);
+    const float detail_scale = std::sqrt(2.0F);
+    const auto run_float = [&]() {
+        ttwv::execute_lwt_on_host(
+            float_plan,
+            float_coefficients,
+            quantized_signal,
+            float_approximation,
+            float_detail,
+            float_workspace,
+            float_plan.chunks.size());
+        for (size_t index = 0; index < output_length; ++index) {
+            quantized_approximation[index] =
+                static_cast<int32_t>(std::lround(float_approximation[index] * approximation_scale));
+            quantized_detail[index] = static_cast<int32_t>(std::lround(float_detail[index] * detail_scale));
+        }
+    };
+    // Untimed passes size the workspaces and fault in every output.
+    ttwv::execute_integer_lwt_on_host(plan, coefficients, signal, approximation, detail, workspace);
+    ttwv::execute_integer_ilwt_on_host(
+        inverse_plan, inverse_coefficients, approximation, detail, reconstructed, workspace);
+    run_float();
+    const AllocationSample forward_sample = measure_allocations(repeats, [&]() {
+        ttwv::execute_integer_lwt_on_host(plan, coefficients, signal, approximation, detail, workspace);
+    });
+    const AllocationSample inverse_sample = measure_allocations(repeats, [&]() {
+        ttwv::execute_integer_ilwt_on_host(
+            inverse_plan, inverse_coefficients, approximation, detail, reconstructed, workspace);
+    });
+    const AllocationSample float_sample = measure_allocations(repeats, run_float);
+
+    int64_t float_difference = 0;
+    for (size_t index = 0; index < output_length; ++index) {
+        float_difference = std::max<int64_t>(
+            float_difference,
+            std::max(
+                std::abs(int64_t{approximation[index]} - quantized_approximation[index]),
+                std::abs(int64_t{detail[index]} - quantized_detail[index])));
+    }
+
+    Json result;
+    result["wavelet"] = IntegerScheme::name;
+    result["length"] = length;
+    result["chunk_count"] = plan.chunks.size();
+    result["inverse_chunk_count"] = inverse_plan.chunks.size();
+    result["repeat_count"] = repeats;
+    add_allocation_sample(result, "integer_forward", forward_sample);
+    add_allocation_sample(result, "integer_inverse", inverse_sample);
+    add_allocation_sample(result, "float_quantized", float_sample);
+    result["forward_speedup"] =
+        forward_sample.elapsed_ms > 0.0 ? float_sample.elapsed_ms / forward_sample.elapsed_ms : 0.0;
+    result["max_quantized_float_difference"] = float_difference;
+    result["lossless"] = reconstructed == signal;
+    return result;
+}
+
+template <typename Scheme>
+[[nodiscard]] Json run_benchmark(const Json& request, const ttwv::BoundaryMode boundary_mode) {
+    const std::string benchmark = request.at("benchmark").get<std::string>();
+    if (benchmark == "config_words") {
+        return run_config_words<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "banded_gemm") {
+        return run_banded_gemm<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "bucket") {
+        return run_bucket<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "cascade") {
+        return run_cascade<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "chunk_placement") {
+        return run_chunk_placement<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "core_selection") {
+        return run_core_selection<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "engine_selection") {
+        return run_engine_selection<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "incremental_replan") {
+        return run_incremental_replan<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "interior_chunks") {
+        return run_interior_chunks<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "page_size") {
+        return run_page_size<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "planner_allocations") {
+        return run_planner_allocations<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "segmented") {
+        return run_segmented<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "static_plan") {
+        return run_static_plan<Scheme>(request, boundary_mode);
+    }
+    if (benchmark == "symmetric_folding") {
+        return run_symmetric_folding<Scheme>(request, boundary_mode);
+    }
+    throw std::runtime_error("Unsupported planner benchmark: " + benchmark);
+}
+
+// Mixed batches, multi-scheme and reduced-precision runs name several
+// wavelets, extension runs name none and integer lifting runs its own
+// scheme; every other benchmark dispatches on the request's wavelet.
+[[nodiscard]] Json run_benchmark(const Json& request) {
+    const std::string benchmark = request.at("benchmark").get<std::string>();
+    if (benchmark == "extension_runs") {
+        return run_extension_runs(request);
+    }
+    if (benchmark == "integer_lifting") {
+        return run_integer_lifting(request, parse_request_boundary_mode(request));
+    }
+    if (benchmark == "mixed_batch") {
+        return run_mixed_batch(request);
+    }
+    if (benchmark == "multi_scheme") {
+        return run_multi_scheme(request);
+    }
+    if (benchmark == "reduced_precision") {
+        return run_reduced_precision(request);
+    }
+    const std::string wavelet = request.at("wavelet").get<std::string>();
+    const ttwv::BoundaryMode boundary_mode = parse_request_boundary_mode(request);
+    return ttwv::dispatch_scheme(
+        wavelet, [&]<typename Scheme>() { return run_benchmark<Scheme>(request, boundary_mode); });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::cerr << "Usage: tt_wavelet_planner_benchmark REQUESTS.jsonl|-\n";
+        return EXIT_FAILURE;
+    }
+    std::ifstream request_file;
+    std::istream* requests = &std::cin;
+    if (std::string_view{argv[1]} != "-") {
+        request_file.open(argv[1]);
+        if (!request_file.good()) {
+            std::cerr << "Failed to open request file: " << argv[1] << '\n';
+            return EXIT_FAILURE;
+        }
+        requests = &request_file;
+    }
+
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(*requests, line)) {
+        ++line_number;
+        if (line.empty()) {
+            continue;
+        }
+        Json request;
+        Json response;
+        try {
+            request = Json::parse(line);
+            response["case_id"] = request.value("case_id", "line-" + std::to_string(line_number));
+            response["benchmark"] = request.at("benchmark");
+            response.update(run_benchmark(request));
+            response["status"] = "ok";
+        } catch (const std::exception& error) {
+            response["case_id"] = request.value("case_id", "line-" + std::to_string(line_number));
+            response["status"] = "error";
+            response["error_message"] = error.what();
+        }
+        std::cout << response.dump() << '\n' << std::flush;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,574 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent USA, Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Offline what-if planner.  Reads one JSON sweep description, runs the same
+// host-side planners the device factories use for every combination of
+// architecture, wavelet, transform, shape, batch count and boundary mode, and
+// prints one row per combination as JSON lines or CSV.  No device is opened.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "tt_wavelet/include/common/boundary_parse.hpp"
+#include "tt_wavelet/include/lifting/config_words.hpp"
+#include "tt_wavelet/include/lifting/core_selection.hpp"
+#include "tt_wavelet/include/lifting/device_planning.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan_2d.hpp"
+#include "tt_wavelet/include/lifting/plan_2d.hpp"
+#include "tt_wavelet/include/lifting/policy.hpp"
+#include "tt_wavelet/include/schemes/generated/registry.hpp"
+
+namespace {
+
+using Json = nlohmann::json;
+
+// Matches the fixed budget the 2D device factories pass to their planners.
+constexpr uint64_t k2DL1BudgetBytes = 768 * 1024;
+// Per-core dispatch cost of the 2D latency model, reused for 1D rows.
+constexpr uint64_t kCoreLaunchCycles = 30'000;
+
+struct WhatIfArchitecture {
+    std::string name;
+    ttwv::ArchitecturePolicy policy{};
+    uint32_t core_limit{0};
+    uint32_t l1_size_per_core{0};
+    double clock_mhz{0.0};
+};
+
+[[nodiscard]] ttwv::WorkspaceLayout parse_workspace_layout(const std::string& name) {
+    if (name == "row-major") {
+        return ttwv::WorkspaceLayout::kRowMajor;
+    }
+    if (name == "tile-native") {
+        return ttwv::WorkspaceLayout::kTileNative;
+    }
+    throw std::runtime_error("Unsupported workspace layout: " + name);
+}
+
+[[nodiscard]] const char* workspace_layout_name(const ttwv::WorkspaceLayout layout) {
+    return layout == ttwv::WorkspaceLayout::kTileNative ? "tile-native" : "row-major";
+}
+
+// Defaults describe a single unharvested card of each architecture: the
+// worker grid comes from the NoC topology model and L1 from the Tensix SRAM
+// size less the firmware reservation.
+[[nodiscard]] WhatIfArchitecture parse_architecture(const Json& description) {
+    const std::string architecture = description.value("architecture", "wormhole_b0");
+    WhatIfArchitecture result{.name = description.value("name", architecture)};
+    ttwv::WorkerGridTopology topology;
+    std::optional<ttwv::WorkspaceLayout> ilwt_layout;
+    if (description.contains("policy") && description.at("policy").contains("ilwt_layout")) {
+        ilwt_layout = parse_workspace_layout(description.at("policy").at("ilwt_layout").get<std::string>());
+    }
+    if (architecture == "wormhole_b0") {
+        result.policy = ttwv::make_architecture_policy(tt::ARCH::WORMHOLE_B0, ilwt_layout);
+        topology = ttwv::make_wormhole_b0_topology(description.value("harvested_mask", 0U));
+        result.l1_size_per_core = 1464 * 1024;
+        result.clock_mhz = 1000.0;
+    } else if (architecture == "blackhole") {
+        result.policy = ttwv::make_architecture_policy(tt::ARCH::BLACKHOLE, ilwt_layout);
+        topology = ttwv::make_blackhole_topology(description.value("harvested_mask", 0U));
+        result.l1_size_per_core = 1536 * 1024;
+        result.clock_mhz = 1350.0;
+    } else {
+        throw std::runtime_error("Unsupported architecture: " + architecture);
+    }
+    if (description.contains("policy")) {
+        const Json& policy = description.at("policy");
+        result.policy.inverse_scale_inline = policy.value("inverse_scale_inline", result.policy.inverse_scale_inline);
+        result.policy.final_interleave_direct =
+            policy.value("final_interleave_direct", result.policy.final_interleave_direct);
+        result.policy.compact_2d_reader = policy.value("compact_2d_reader", result.policy.compact_2d_reader);
+        result.policy.inverse_2d_coordination_penalty_cycles_per_core = policy.value(
+            "inverse_2d_coordination_penalty_cycles_per_core",
+            result.policy.inverse_2d_coordination_penalty_cycles_per_core);
+        result.policy.l1_scratch_bytes = policy.value("l1_scratch_bytes", result.policy.l1_scratch_bytes);
+    }
+    const std::vector<uint32_t> grid =
+        description.value("grid", std::vector<uint32_t>{topology.logical_width(), topology.logical_height()});
+    if (grid.size() != 2 || grid[0] == 0 || grid[1] == 0) {
+        throw std::runtime_error("Architecture grid must be two positive extents");
+    }
+    result.core_limit = std::min(description.value("core_limit", grid[0] * grid[1]), grid[0] * grid[1]);
+    result.l1_size_per_core = description.value("l1_size_per_core", result.l1_size_per_core);
+    result.clock_mhz = description.value("clock_mhz", result.clock_mhz);
+    if (result.core_limit == 0 || result.clock_mhz <= 0.0) {
+        throw std::runtime_error("Architecture core limit and clock must be positive");
+    }
+    return result;
+}
+
+// Slowest core when `batch_count` copies of the per-chunk costs are split
+// into the contiguous work ranges the device factories assign.
+[[nodiscard]] uint64_t partitioned_latency_cycles(
+    const std::span<const uint64_t> chunk_cycles, const uint32_t batch_count, const uint32_t active_core_count) {
+    const uint32_t total_items = static_cast<uint32_t>(chunk_cycles.size() * batch_count);
+    uint64_t maximum = 0;
+    for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+        const ttwv::CoreSlotWork work = ttwv::partition_core_slot_work(total_items, active_core_count, slot);
+        uint64_t core_cycles = kCoreLaunchCycles;
+        for (uint32_t item = work.begin; item < work.begin + work.count; ++item) {
+            core_cycles += chunk_cycles[item % chunk_cycles.size()];
+        }
+        maximum = std::max(maximum, core_cycles);
+    }
+    return maximum;
+}
+
+// The 1D planners carry no calibrated latency model.  Reuse the 2D model's
+// horizontal route weights per 32x32 group so 1D rows rank candidates on the
+// same relative scale; absolute numbers are planner weights, not timings.
+[[nodiscard]] uint64_t estimate_1d_chunk_cycles(
+    const ttwv::LiftingForwardPlan& plan, const size_t initial_elements, const uint32_t groups_per_chunk) {
+    constexpr uint64_t route_config_and_sync_cycles = 3'700;
+    constexpr uint64_t group_persistence_cycles = 1'200;
+    uint64_t cycles = static_cast<uint64_t>(initial_elements) * 12;
+    for (const ttwv::LiftingStepRoute& route : plan.routes) {
+        const uint64_t group_cycles = ttwv::is_predict_update_step(route.type)
+                                          ? 12'000 + 1'800 * ttwv::execution_detail::coefficient_count(route)
+                                          : 8'000;
+        cycles += route_config_and_sync_cycles + groups_per_chunk * (group_cycles + group_persistence_cycles);
+    }
+    return cycles + 2 * groups_per_chunk * group_persistence_cycles;
+}
+
+void add_l1_accounting(Json& row, const ttwv::L1Accounting& accounting) {
+    row["l1_workspace_bytes"] = accounting.slots_bytes + accounting.padding_bytes;
+    row["l1_workspace_mirror_bytes"] = accounting.workspace_mirror_bytes;
+    row["l1_circular_buffer_bytes"] = accounting.circular_buffers_bytes;
+    row["l1_cache_bytes"] = accounting.cache_bytes;
+    row["l1_output_bytes"] = accounting.output_bytes;
+    row["l1_synchronization_bytes"] = accounting.synchronization_bytes;
+    row["l1_metadata_bytes"] = accounting.metadata_bytes;
+    row["l1_architecture_scratch_bytes"] = accounting.architecture_scratch_bytes;
+    row["l1_total_bytes"] = accounting.total_bytes;
+    row["l1_capacity_bytes"] = accounting.capacity_bytes;
+    row["l1_headroom_bytes"] = accounting.headroom_bytes;
+}
+
+void add_2d_l1_accounting(
+    Json& row, const uint64_t workspace_bytes, const uint64_t total_bytes, const uint64_t capacity) {
+    if (total_bytes > capacity) {
+        throw std::runtime_error(
+            "2D allocation requires " + std::to_string(total_bytes) + " L1 bytes but the architecture exposes " +
+            std::to_string(capacity));
+    }
+    row["l1_workspace_bytes"] = workspace_bytes;
+    row["l1_workspace_mirror_bytes"] = 0;
+    row["l1_circular_buffer_bytes"] = ttwv::plan_2d_detail::kCircularBufferBytes;
+    row["l1_cache_bytes"] = 0;
+    row["l1_output_bytes"] = 0;
+    row["l1_synchronization_bytes"] = ttwv::plan_2d_detail::kSynchronizationBytes;
+    row["l1_metadata_bytes"] = ttwv::plan_2d_detail::kMetadataBytes;
+    row["l1_architecture_scratch_bytes"] = 0;
+    row["l1_total_bytes"] = total_bytes;
+    row["l1_capacity_bytes"] = capacity;
+    row["l1_headroom_bytes"] = capacity - total_bytes;
+}
+
+void add_schedule(
+    Json& row,
+    const WhatIfArchitecture& architecture,
+    const size_t chunks_per_sample,
+    const uint32_t batch_count,
+    const std::vector<uint64_t>& chunk_cycles,
+    const uint64_t coordination_penalty_cycles_per_core) {
+    const size_t total_work_items = chunks_per_sample * batch_count;
+    const uint32_t active_core_count =
+        static_cast<uint32_t>(std::min<size_t>(architecture.core_limit, total_work_items));
+    uint64_t latency_cycles = partitioned_latency_cycles(chunk_cycles, batch_count, active_core_count);
+    if (coordination_penalty_cycles_per_core > 0 && active_core_count > 64) {
+        latency_cycles += static_cast<uint64_t>(active_core_count - 64) * coordination_penalty_cycles_per_core;
+    }
+    const double latency_seconds = static_cast<double>(latency_cycles) / (architecture.clock_mhz * 1.0e6);
+    row["chunks_per_sample"] = chunks_per_sample;
+    row["total_work_items"] = total_work_items;
+    row["active_core_count"] = active_core_count;
+    row["max_work_items_per_core"] = (total_work_items + active_core_count - 1) / active_core_count;
+    row["modeled_latency_cycles"] = latency_cycles;
+    row["modeled_latency_us"] = latency_seconds * 1.0e6;
+    row["modeled_samples_per_second"] = static_cast<double>(batch_count) / latency_seconds;
+}
+
+template <typename Scheme>
+[[nodiscard]] Json plan_lwt(
+    const WhatIfArchitecture& architecture,
+    const size_t length,
+    const uint32_t batch_count,
+    const ttwv::BoundaryMode boundary_mode,
+    const uint32_t signal_budget_bytes) {
+    const ttwv::LwtDevicePlan device_plan = ttwv::select_lwt_device_plan(
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode),
+        architecture.policy,
+        architecture.core_limit,
+        architecture.l1_size_per_core,
+        signal_budget_bytes);
+    const ttwv::LwtExecutionPlan& plan = device_plan.plan;
+    Json row;
+    row["groups_per_chunk"] = plan.groups_per_chunk;
+    row["chunk_output_elements"] = plan.groups_per_chunk * ttwv::device_protocol::kLwtGroupOutputElements;
+    row["workspace_elements"] = plan.workspace_elements;
+    row["workspace_layout"] = workspace_layout_name(plan.workspace_layout);
+    row["hybrid_tile_mirror"] = device_plan.hybrid_tile_mirror;
+    row["route_count"] = plan.chunks.front().routes.size();
+    row["max_dependency_overhead"] = plan.max_dependency_overhead;
+    row["config_bytes"] = ttwv::lwt_config_upload_word_count(plan) * sizeof(uint32_t);
+    add_l1_accounting(
+        row,
+        ttwv::make_device_l1_accounting(
+            plan, architecture.policy, device_plan.hybrid_tile_mirror, 1U, architecture.l1_size_per_core));
+    std::vector<uint64_t> chunk_cycles;
+    chunk_cycles.reserve(plan.chunks.size());
+    for (const ttwv::LwtChunkPlan& chunk : plan.chunks) {
+        chunk_cycles.push_back(estimate_1d_chunk_cycles(
+            plan.full_plan, chunk.initial_even.length() + chunk.initial_odd.length(), plan.groups_per_chunk));
+    }
+    add_schedule(row, architecture, plan.chunks.size(), batch_count, chunk_cycles, 0);
+    return row;
+}
+
+template <typename Scheme>
+[[nodiscard]] Json plan_ilwt(
+    const WhatIfArchitecture& architecture,
+    const size_t length,
+    const uint32_t batch_count,
+    const ttwv::BoundaryMode boundary_mode,
+    const uint32_t signal_budget_bytes) {
+    const ttwv::LiftingForwardPlan trace =
+        ttwv::make_forward_lifting_plan<Scheme>(ttwv::SignalBuffer{.length = length}, 0, 0, boundary_mode);
+    const ttwv::IlwtDevicePlan device_plan = ttwv::select_ilwt_device_plan(
+        ttwv::make_inverse_lifting_plan<Scheme>(length, trace.output_length, boundary_mode),
+        architecture.policy,
+        architecture.core_limit,
+        architecture.l1_size_per_core,
+        signal_budget_bytes);
+    const ttwv::IlwtExecutionPlan& plan = device_plan.plan;
+    Json row;
+    row["groups_per_chunk"] = plan.output_groups_per_chunk;
+    row["chunk_output_elements"] = plan.output_groups_per_chunk * ttwv::device_protocol::kIlwtGroupOutputElements;
+    row["workspace_elements"] = plan.workspace_elements;
+    row["workspace_layout"] = workspace_layout_name(plan.workspace_layout);
+    row["hybrid_tile_mirror"] = device_plan.hybrid_tile_mirror;
+    row["route_count"] = plan.chunks.front().routes.size();
+    row["max_dependency_overhead"] = plan.max_dependency_overhead;
+    row["config_bytes"] = ttwv::ilwt_config_upload_word_count(plan) * sizeof(uint32_t);
+    add_l1_accounting(
+        row,
+        ttwv::make_device_l1_accounting(
+            plan,
+            architecture.policy,
+            device_plan.hybrid_tile_mirror,
+            device_plan.interleave_batch_sticks,
+            architecture.l1_size_per_core));
+    std::vector<uint64_t> chunk_cycles;
+    chunk_cycles.reserve(plan.chunks.size());
+    for (const ttwv::IlwtChunkPlan& chunk : plan.chunks) {
+        chunk_cycles.push_back(estimate_1d_chunk_cycles(
+            plan.full_plan.forward_trace,
+            chunk.canonical_approximation.length() + chunk.canonical_detail.length(),
+            plan.output_groups_per_chunk));
+    }
+    add_schedule(row, architecture, plan.chunks.size(), batch_count, chunk_cycles, 0);
+    return row;
+}
+
+template <typename Scheme>
+[[nodiscard]] Json plan_lwt_2d(
+    const WhatIfArchitecture& architecture,
+    const size_t height,
+    const size_t width,
+    const uint32_t batch_count,
+    const ttwv::BoundaryMode boundary_mode) {
+    // Same arguments as create_lwt_2d_executable.
+    const ttwv::Lwt2DExecutionPlan plan = ttwv::make_lwt_2d_execution_plan<Scheme>(
+        height,
+        width,
+        architecture.core_limit,
+        k2DL1BudgetBytes,
+        boundary_mode,
+        true,
+        true,
+        ttwv::Lwt2DRouteDomainPolicy::kExact);
+    Json row;
+    row["chunk_tiles_y"] = plan.chunk_tiles_y;
+    row["chunk_tiles_x"] = plan.chunk_tiles_x;
+    row["band_height"] = plan.band_height;
+    row["band_width"] = plan.band_width;
+    row["route_count"] = plan.chunks.front().routes.size();
+    row["executable_route_count"] = plan.executable_route_count;
+    row["max_dependency_overhead"] = plan.max_dependency_overhead;
+    row["config_bytes"] = ttwv::lwt_2d_config_upload_word_count(plan) * sizeof(uint32_t);
+    add_2d_l1_accounting(row, plan.allocated_workspace_bytes, plan.allocated_l1_bytes, architecture.l1_size_per_core);
+    std::vector<uint64_t> chunk_cycles;
+    chunk_cycles.reserve(plan.chunks.size());
+    for (const ttwv::Lwt2DChunkPlan& chunk : plan.chunks) {
+        chunk_cycles.push_back(ttwv::plan_2d_detail::estimate_chunk_latency_cycles(
+            chunk, plan.route_table, plan.y_plan, plan.x_plan));
+    }
+    add_schedule(row, architecture, plan.chunks.size(), batch_count, chunk_cycles, 0);
+    return row;
+}
+
+template <typename Scheme>
+[[nodiscard]] Json plan_ilwt_2d(
+    const WhatIfArchitecture& architecture,
+    const size_t height,
+    const size_t width,
+    const uint32_t batch_count,
+    const ttwv::BoundaryMode boundary_mode) {
+    const uint64_t penalty = architecture.policy.inverse_2d_coordination_penalty_cycles_per_core;
+    const ttwv::Ilwt2DExecutionPlan plan = ttwv::make_ilwt_2d_execution_plan<Scheme>(
+        height, width, architecture.core_limit, k2DL1BudgetBytes, boundary_mode, penalty);
+    Json row;
+    row["chunk_tiles_y"] = plan.chunk_tiles_y;
+    row["chunk_tiles_x"] = plan.chunk_tiles_x;
+    row["band_height"] = plan.band_height;
+    row["band_width"] = plan.band_width;
+    row["route_count"] = plan.chunks.front().routes.size();
+    row["executable_route_count"] = plan.executable_route_count;
+    row["max_dependency_overhead"] = plan.max_dependency_overhead;
+    row["config_bytes"] = ttwv::ilwt_2d_config_upload_word_count(plan) * sizeof(uint32_t);
+    add_2d_l1_accounting(row, plan.allocated_workspace_bytes, plan.allocated_l1_bytes, architecture.l1_size_per_core);
+    std::vector<uint64_t> chunk_cycles;
+    chunk_cycles.reserve(plan.chunks.size());
+    for (const ttwv::Lwt2DChunkPlan& chunk : plan.chunks) {
+        chunk_cycles.push_back(ttwv::plan_2d_detail::estimate_chunk_latency_cycles(
+            chunk, plan.route_table, plan.y_plan.forward_trace, plan.x_plan.forward_trace, true));
+    }
+    add_schedule(row, architecture, plan.chunks.size(), batch_count, chunk_cycles, penalty);
+    return row;
+}
+
+// 1D rows use `width` as the signal length.
+struct Shape {
+    size_t height{1};
+    size_t width{0};
+};
+
+[[nodiscard]] Json plan_row(
+    const WhatIfArchitecture& architecture,
+    const std::string& wavelet,
+    const std::string& transform,
+    const Shape shape,
+    const uint32_t batch_count,
+    const ttwv::BoundaryMode boundary_mode,
+    const uint32_t signal_budget_bytes) {
+    return ttwv::dispatch_scheme(wavelet, [&]<typename Scheme>() {
+        if (transform == "lwt") {
+            return plan_lwt<Scheme>(architecture, shape.width, batch_count, boundary_mode, signal_budget_bytes);
+        }
+        if (transform == "ilwt") {
+            return plan_ilwt<Scheme>(architecture, shape.width, batch_count, boundary_mode, signal_budget_bytes);
+        }
+        if (transform == "lwt_2d") {
+            return plan_lwt_2d<Scheme>(architecture, shape.height, shape.width, batch_count, boundary_mode);
+        }
+        if (transform == "ilwt_2d") {
+            return plan_ilwt_2d<Scheme>(architecture, shape.height, shape.width, batch_count, boundary_mode);
+        }
+        throw std::runtime_error("Unsupported transform: " + transform);
+    });
+}
+
+// Column order of the CSV output; JSON rows carry the same keys.
+constexpr std::string_view kCsvColumns[] = {
+    "architecture",
+    "wavelet",
+    "transform",
+    "boundary_mode",
+    "length",
+    "height",
+    "width",
+    "batch_count",
+    "status",
+    "error_message",
+    "active_core_count",
+    "chunks_per_sample",
+    "total_work_items",
+    "max_work_items_per_core",
+    "groups_per_chunk",
+    "chunk_output_elements",
+    "chunk_tiles_y",
+    "chunk_tiles_x",
+    "band_height",
+    "band_width",
+    "workspace_elements",
+    "workspace_layout",
+    "hybrid_tile_mirror",
+    "route_count",
+    "executable_route_count",
+    "max_dependency_overhead",
+    "config_bytes",
+    "l1_workspace_bytes",
+    "l1_workspace_mirror_bytes",
+    "l1_circular_buffer_bytes",
+    "l1_cache_bytes",
+    "l1_output_bytes",
+    "l1_synchronization_bytes",
+    "l1_metadata_bytes",
+    "l1_architecture_scratch_bytes",
+    "l1_total_bytes",
+    "l1_capacity_bytes",
+    "l1_headroom_bytes",
+    "modeled_latency_cycles",
+    "modeled_latency_us",
+    "modeled_samples_per_second",
+    "cards_for_target",
+};
+
+[[nodiscard]] std::string csv_field(const Json& value) {
+    if (value.is_null()) {
+        return {};
+    }
+    std::string text = value.is_string() ? value.get<std::string>() : value.dump();
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        return text;
+    }
+    std::string quoted = "\"";
+    for (const char c : text) {
+        quoted += c == '"' ? std::string("\"\"") : std::string(1, c);
+    }
+    return quoted + '"';
+}
+
+void print_row(const Json& row, const bool csv) {
+    if (!csv) {
+        std::cout << row.dump() << '\n';
+        return;
+    }
+    for (size_t column = 0; column < std::size(kCsvColumns); ++column) {
+        const std::string key{kCsvColumns[column]};
+        std::cout << (column == 0 ? "" : ",") << csv_field(row.contains(key) ? row.at(key) : Json{});
+    }
+    std::cout << '\n';
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const bool csv = argc == 3 && std::string_view{argv[1]} == "--csv";
+    if (argc != 2 && !csv) {
+        std::cerr << "Usage: tt_wavelet_planner_what_if [--csv] SWEEP.json|-\n";
+        return EXIT_FAILURE;
+    }
+    const std::string_view path = argv[argc - 1];
+    Json sweep;
+    try {
+        if (path == "-") {
+            sweep = Json::parse(std::cin);
+        } else {
+            std::ifstream file{std::string{path}};
+            if (!file.good()) {
+                std::cerr << "Failed to open sweep file: " << path << '\n';
+                return EXIT_FAILURE;
+            }
+            sweep = Json::parse(file);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "Invalid sweep description: " << error.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::vector<WhatIfArchitecture> architectures;
+    std::vector<Shape> shapes_1d;
+    std::vector<Shape> shapes_2d;
+    try {
+        for (const Json& description : sweep.value("architectures", Json::array({Json::object()}))) {
+            architectures.push_back(parse_architecture(description));
+        }
+        for (const size_t length : sweep.value("lengths", std::vector<size_t>{})) {
+            shapes_1d.push_back(Shape{.width = length});
+        }
+        for (const Json& shape : sweep.value("shapes", Json::array())) {
+            shapes_2d.push_back(Shape{.height = shape.at(0).get<size_t>(), .width = shape.at(1).get<size_t>()});
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "Invalid sweep description: " << error.what() << '\n';
+        return EXIT_FAILURE;
+    }
+    const std::vector<std::string> wavelets = sweep.value("wavelets", std::vector<std::string>{"haar"});
+    const std::vector<std::string> transforms =
+        sweep.value("transforms", std::vector<std::string>{"lwt", "ilwt", "lwt_2d", "ilwt_2d"});
+    const std::vector<uint32_t> batch_counts = sweep.value("batch_counts", std::vector<uint32_t>{1});
+    const std::vector<std::string> boundary_modes =
+        sweep.value("boundary_modes", std::vector<std::string>{"symmetric"});
+    const uint32_t signal_budget_bytes = sweep.value("l1_signal_budget_bytes", ttwv::kDefaultL1SignalBudgetBytes);
+    // Optional sizing target: report how many cards sustain this rate.
+    const double target_samples_per_second = sweep.value("target_samples_per_second", 0.0);
+
+    if (csv) {
+        for (size_t column = 0; column < std::size(kCsvColumns); ++column) {
+            std::cout << (column == 0 ? "" : ",") << kCsvColumns[column];
+        }
+        std::cout << '\n';
+    }
+    for (const WhatIfArchitecture& architecture : architectures) {
+        for (const std::string& wavelet : wavelets) {
+            for (const std::string& transform : transforms) {
+                const bool two_dimensional = transform.ends_with("_2d");
+                for (const Shape shape : two_dimensional ? shapes_2d : shapes_1d) {
+                    for (const uint32_t batch_count : batch_counts) {
+                        for (const std::string& mode_name : boundary_modes) {
+                            Json row;
+                            try {
+                                ttwv::BoundaryMode boundary_mode{};
+                                if (!ttwv::parse_boundary_mode(mode_name, boundary_mode)) {
+                                    throw std::runtime_error("Unsupported boundary mode: " + mode_name);
+                                }
+                                if (batch_count == 0) {
+                                    throw std::runtime_error("Batch count must be positive");
+                                }
+                                row = plan_row(
+                                    architecture,
+                                    wavelet,
+                                    transform,
+                                    shape,
+                                    batch_count,
+                                    boundary_mode,
+                                    signal_budget_bytes);
+                                if (target_samples_per_second > 0.0) {
+                                    row["cards_for_target"] = static_cast<uint64_t>(std::ceil(
+                                        target_samples_per_second /
+                                        row.at("modeled_samples_per_second").get<double>()));
+                                }
+                                row["status"] = "ok";
+                            } catch (const std::exception& error) {
+                                row = Json::object();
+                                row["status"] = "error";
+                                row["error_message"] = error.what();
+                            }
+                            row["architecture"] = architecture.name;
+                            row["wavelet"] = wavelet;
+                            row["transform"] = transform;
+                            row["boundary_mode"] = mode_name;
+                            if (two_dimensional) {
+                                row["height"] = shape.height;
+                                row["width"] = shape.width;
+                            } else {
+                                row["length"] = shape.width;
+                            }
+                            row["batch_count"] = batch_count;
+                            print_row(row, csv);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
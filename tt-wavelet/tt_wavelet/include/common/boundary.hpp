@@ -10,7 +10,9 @@ namespace ttwv {
  * @note LWT maps the extension while loading each dependency-local chunk and
  *       never materializes a complete padded signal.
  *
- * Mirrors the non-periodization modes supported by PyWavelets.
+ * Mirrors the signal-extension modes supported by PyWavelets. kPeriodization
+ * is the one mode that also changes the transform's geometry: it yields
+ * ceil(N / 2) coefficients instead of floor((N + tap_size - 1) / 2).
  */
 enum class BoundaryMode : uint8_t {
     kZero = 0,           ///< Pad with zeros
@@ -21,6 +23,7 @@ enum class BoundaryMode : uint8_t {
     kSmooth = 5,         ///< Extrapolate the first edge difference as a straight line
     kAntireflect = 6,    ///< Whole-sample reflection, antisymmetric about each edge value
     kReflect = 7,        ///< Whole-sample symmetric reflection
+    kPeriodization = 8,  ///< Wrap with period N rounded up to even, repeating the last sample of odd N
 };
 
 [[nodiscard]] constexpr bool is_supported_lwt_boundary_mode(const BoundaryMode mode) noexcept {
@@ -32,7 +35,8 @@ enum class BoundaryMode : uint8_t {
         case BoundaryMode::kAntisymmetric:
         case BoundaryMode::kSmooth:
         case BoundaryMode::kAntireflect:
-        case BoundaryMode::kReflect: return true;
+        case BoundaryMode::kReflect:
+        case BoundaryMode::kPeriodization: return true;
     }
     return false;
 }
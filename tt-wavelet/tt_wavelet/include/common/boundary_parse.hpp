@@ -16,6 +16,7 @@ namespace ttwv {
         case BoundaryMode::kSmooth: return "smooth";
         case BoundaryMode::kAntireflect: return "antireflect";
         case BoundaryMode::kReflect: return "reflect";
+        case BoundaryMode::kPeriodization: return "periodization";
     }
     return "unsupported";
 }
@@ -37,6 +38,8 @@ namespace ttwv {
         mode = BoundaryMode::kAntireflect;
     } else if (name == "reflect") {
         mode = BoundaryMode::kReflect;
+    } else if (name == "periodization") {
+        mode = BoundaryMode::kPeriodization;
     } else {
         return false;
     }
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+namespace ttwv {
+
+/**
+ * @brief Storage format of signal samples in DRAM sticks.
+ *
+ * L1 workspace slots and the stencil stay FP32: 16-bit samples are widened
+ * on load and final outputs are rounded to nearest even on store.
+ */
+enum class SampleFormat : uint8_t {
+    kFloat32 = 0,   ///< IEEE binary32
+    kBFloat16 = 1,  ///< Upper half of binary32: 8-bit exponent, 7-bit mantissa
+    kFloat16 = 2,   ///< IEEE binary16: 5-bit exponent, 10-bit mantissa
+};
+
+[[nodiscard]] constexpr uint32_t sample_format_bytes(const SampleFormat format) noexcept {
+    return format == SampleFormat::kFloat32 ? 4U : 2U;
+}
+
+[[nodiscard]] constexpr std::string_view sample_format_name(const SampleFormat format) noexcept {
+    switch (format) {
+        case SampleFormat::kFloat32: return "fp32";
+        case SampleFormat::kBFloat16: return "bf16";
+        case SampleFormat::kFloat16: return "fp16";
+    }
+    return "unsupported";
+}
+
+[[nodiscard]] constexpr bool parse_sample_format(const std::string_view name, SampleFormat& format) noexcept {
+    if (name == "fp32") {
+        format = SampleFormat::kFloat32;
+    } else if (name == "bf16") {
+        format = SampleFormat::kBFloat16;
+    } else if (name == "fp16") {
+        format = SampleFormat::kFloat16;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+[[nodiscard]] constexpr uint16_t float_to_bfloat16_bits(const float value) noexcept {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    if ((bits & 0x7FFFFFFFU) > 0x7F800000U) {
+        // Keep NaNs quiet: truncation could clear every mantissa bit.
+        return static_cast<uint16_t>((bits >> 16) | 0x0040U);
+    }
+    return static_cast<uint16_t>((bits + 0x7FFFU + ((bits >> 16) & 1U)) >> 16);
+}
+
+[[nodiscard]] constexpr float bfloat16_bits_to_float(const uint16_t bits) noexcept {
+    return std::bit_cast<float>(static_cast<uint32_t>(bits) << 16);
+}
+
+[[nodiscard]] constexpr uint16_t float_to_half_bits(const float value) noexcept {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint32_t sign = (bits >> 16) & 0x8000U;
+    const uint32_t magnitude = bits & 0x7FFFFFFFU;
+    if (magnitude >= 0x7F800000U) {
+        return static_cast<uint16_t>(sign | 0x7C00U | (magnitude > 0x7F800000U ? 0x0200U : 0U));
+    }
+    // 65520 is the tie between the largest half, 65504, and the next power of two.
+    if (magnitude >= 0x477FF000U) {
+        return static_cast<uint16_t>(sign | 0x7C00U);
+    }
+    if (magnitude < 0x38800000U) {
+        // Below 2^-14 the result is a subnormal: a count of 2^-24 units.
+        const uint32_t exponent = magnitude >> 23;
+        if (exponent < 102) {
+            return static_cast<uint16_t>(sign);
+        }
+        const uint32_t mantissa = (magnitude & 0x007FFFFFU) | 0x00800000U;
+        const uint32_t shift = 126 - exponent;
+        const uint32_t truncated = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1U << shift) - 1U);
+        const uint32_t halfway = 1U << (shift - 1);
+        const bool round_up = remainder > halfway || (remainder == halfway && (truncated & 1U) != 0);
+        return static_cast<uint16_t>(sign | (truncated + (round_up ? 1U : 0U)));
+    }
+    // Rebias the exponent from 127 to 15; a mantissa carry bumps the exponent.
+    const uint32_t rounded = magnitude + 0x0FFFU + ((magnitude >> 13) & 1U);
+    return static_cast<uint16_t>(sign | ((rounded - 0x38000000U) >> 13));
+}
+
+[[nodiscard]] constexpr float half_bits_to_float(const uint16_t bits) noexcept {
+    const uint32_t sign = static_cast<uint32_t>(bits & 0x8000U) << 16;
+    const uint32_t exponent = (bits >> 10) & 0x1FU;
+    const uint32_t mantissa = bits & 0x03FFU;
+    if (exponent == 0x1FU) {
+        return std::bit_cast<float>(sign | 0x7F800000U | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        const float magnitude = static_cast<float>(mantissa) * 0x1p-24F;
+        return sign != 0 ? -magnitude : magnitude;
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112U) << 23) | (mantissa << 13));
+}
+
+/**
+ * @brief Round @p value to the nearest value representable in @p format.
+ *
+ * The result is the FP32 value a 16-bit store followed by a widening load
+ * produces, so host emulation can keep FP32 buffers.
+ */
+[[nodiscard]] constexpr float round_to_sample_format(const float value, const SampleFormat format) noexcept {
+    switch (format) {
+        case SampleFormat::kFloat32: return value;
+        case SampleFormat::kBFloat16: return bfloat16_bits_to_float(float_to_bfloat16_bits(value));
+        case SampleFormat::kFloat16: return half_bits_to_float(float_to_half_bits(value));
+    }
+    return value;
+}
+
+static_assert(bfloat16_bits_to_float(float_to_bfloat16_bits(1.0F)) == 1.0F);
+static_assert(float_to_bfloat16_bits(1.0F + 0x1p-8F) == 0x3F80U);
+static_assert(float_to_bfloat16_bits(1.0F + 0x1p-7F + 0x1p-8F) == 0x3F82U);
+static_assert(float_to_half_bits(65504.0F) == 0x7BFFU);
+static_assert(float_to_half_bits(65520.0F) == 0x7C00U);
+static_assert(float_to_half_bits(0x1p-24F) == 0x0001U);
+static_assert(float_to_half_bits(0x1p-25F) == 0x0000U);
+static_assert(half_bits_to_float(float_to_half_bits(-2047.0F)) == -2047.0F);
+static_assert(half_bits_to_float(0x0001U) == 0x1p-24F);
+
+}  // namespace ttwv
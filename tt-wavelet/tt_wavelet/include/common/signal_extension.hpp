@@ -138,6 +138,14 @@ make_extended_index(const int64_t index, const uint32_t length) noexcept {
             .source_index = extension_positive_mod(index, length),
             .operation = ExtensionOperation::kSample,
         };
+    } else if constexpr (Mode == BoundaryMode::kPeriodization) {
+        // Odd lengths wrap over N + 1 samples, the last one repeated.
+        const uint64_t period = static_cast<uint64_t>(length) + (length & 1U);
+        const uint64_t phase = decompose_extension_period(index, period).remainder;
+        return ExtendedIndex{
+            .source_index = phase < length ? static_cast<uint32_t>(phase) : length - 1U,
+            .operation = ExtensionOperation::kSample,
+        };
     } else if constexpr (Mode == BoundaryMode::kSymmetric) {
         const uint64_t period = 2U * static_cast<uint64_t>(length);
         const uint64_t phase = decompose_extension_period(index, period).remainder;
@@ -302,10 +310,209 @@ make_extended_index(const BoundaryMode mode, const int64_t index, const uint32_t
         case BoundaryMode::kSmooth: return make_extended_index<BoundaryMode::kSmooth>(index, length);
         case BoundaryMode::kAntireflect: return make_extended_index<BoundaryMode::kAntireflect>(index, length);
         case BoundaryMode::kReflect: return make_extended_index<BoundaryMode::kReflect>(index, length);
+        case BoundaryMode::kPeriodization: return make_extended_index<BoundaryMode::kPeriodization>(index, length);
     }
     return {};
 }
 
+/**
+ * One run of consecutive extended samples that share a single operation.
+ *
+ * A run covers extended indices [begin, begin + length). Sample t of the run
+ * reads source_index + step * t for kSample and kNegatedSample, where step
+ * is +1 for a forward copy, -1 for a reversed copy and 0 for a repeated
+ * edge. kSmooth keeps its edge/neighbour pair and moves distance by step;
+ * kAntireflect reads like kSample with one period_quotient and reflected
+ * flag for the whole run. kZero runs read nothing.
+ */
+struct ExtensionRun {
+    int64_t begin{0};
+    uint64_t length{0};
+    uint64_t source_index{0};
+    uint64_t auxiliary_index{0};
+    int64_t period_quotient{0};
+    uint64_t distance{0};
+    int32_t step{1};
+    ExtensionOperation operation{ExtensionOperation::kZero};
+    bool reflected{false};
+};
+
+/**
+ * Split the extended window [begin, end) of a `length`-sample signal into
+ * runs, and pass each to `consume` in index order.
+ *
+ * Runs end where the mode's index mapping turns: at the signal edges and at
+ * every period or half-period boundary. A window with a halo of H samples
+ * therefore yields O(H / length + 1) runs, each of which a caller can fill
+ * as a copy, reversed copy, fill or ramp instead of mapping every sample.
+ * The per-sample values agree with make_extended_index and
+ * evaluate_extended_index bit for bit.
+ */
+template <typename RunConsumer>
+TTWV_EXTENSION_ALWI void for_each_extension_run(
+    const BoundaryMode mode,
+    const int64_t begin,
+    const int64_t end,
+    const uint64_t length,
+    const RunConsumer& consume) {
+    if (length == 0 || begin >= end) {
+        return;
+    }
+    const int64_t signed_length = static_cast<int64_t>(length);
+    const uint64_t last = length - 1;
+    int64_t index = begin;
+    const auto emit = [&](uint64_t count, ExtensionRun run) {
+        const uint64_t remaining = static_cast<uint64_t>(end - index);
+        run.begin = index;
+        run.length = count < remaining ? count : remaining;
+        index += static_cast<int64_t>(run.length);
+        consume(run);
+    };
+    while (index < end) {
+        if (index >= 0 && index < signed_length) {
+            emit(length - static_cast<uint64_t>(index),
+                 ExtensionRun{.source_index = static_cast<uint64_t>(index), .operation = ExtensionOperation::kSample});
+            continue;
+        }
+        const bool left = index < 0;
+        // Runs that stop at the signal edge, or at the window end on the right.
+        const uint64_t to_edge = left ? static_cast<uint64_t>(-index) : static_cast<uint64_t>(end - index);
+        switch (mode) {
+            case BoundaryMode::kZero: emit(to_edge, ExtensionRun{}); break;
+            case BoundaryMode::kConstant:
+                emit(to_edge,
+                     ExtensionRun{
+                         .source_index = left ? 0 : last, .step = 0, .operation = ExtensionOperation::kSample});
+                break;
+            case BoundaryMode::kPeriodic: {
+                const uint64_t phase = decompose_extension_period(index, length).remainder;
+                emit(length - phase, ExtensionRun{.source_index = phase, .operation = ExtensionOperation::kSample});
+                break;
+            }
+            case BoundaryMode::kPeriodization: {
+                const uint64_t phase = decompose_extension_period(index, length + length % 2).remainder;
+                if (phase < length) {
+                    emit(length - phase, ExtensionRun{.source_index = phase, .operation = ExtensionOperation::kSample});
+                } else {
+                    emit(1, ExtensionRun{.source_index = last, .operation = ExtensionOperation::kSample});
+                }
+                break;
+            }
+            case BoundaryMode::kSymmetric: {
+                const uint64_t phase = decompose_extension_period(index, 2 * length).remainder;
+                if (phase < length) {
+                    emit(length - phase, ExtensionRun{.source_index = phase, .operation = ExtensionOperation::kSample});
+                } else {
+                    emit(2 * length - phase,
+                         ExtensionRun{
+                             .source_index = 2 * length - 1 - phase,
+                             .step = -1,
+                             .operation = ExtensionOperation::kSample});
+                }
+                break;
+            }
+            case BoundaryMode::kAntisymmetric: {
+                const uint64_t phase = decompose_extension_period(index, 4 * length).remainder;
+                const uint64_t quarter = phase / length;
+                const uint64_t offset = phase % length;
+                if (quarter % 2 == 0) {
+                    emit(length - offset,
+                         ExtensionRun{.source_index = offset, .operation = ExtensionOperation::kSample});
+                } else {
+                    emit(length - offset,
+                         ExtensionRun{
+                             .source_index = length - 1 - offset,
+                             .step = -1,
+                             .operation = ExtensionOperation::kNegatedSample});
+                }
+                break;
+            }
+            case BoundaryMode::kSmooth:
+                if (length == 1) {
+                    emit(to_edge, ExtensionRun{.source_index = 0, .step = 0, .operation = ExtensionOperation::kSample});
+                } else {
+                    emit(to_edge,
+                         ExtensionRun{
+                             .source_index = left ? 0 : last,
+                             .auxiliary_index = left ? 1 : last - 1,
+                             .distance = left ? static_cast<uint64_t>(-index) : static_cast<uint64_t>(index) - last,
+                             .step = left ? -1 : 1,
+                             .operation = ExtensionOperation::kSmooth});
+                }
+                break;
+            case BoundaryMode::kReflect:
+            case BoundaryMode::kAntireflect: {
+                if (length == 1) {
+                    emit(to_edge, ExtensionRun{.source_index = 0, .step = 0, .operation = ExtensionOperation::kSample});
+                    break;
+                }
+                const SignedExtensionPeriod mapped = decompose_extension_period(index, 2 * last);
+                const bool reflected = mapped.remainder > last;
+                const ExtensionOperation operation =
+                    mode == BoundaryMode::kReflect ? ExtensionOperation::kSample : ExtensionOperation::kAntireflect;
+                emit(reflected ? 2 * last - mapped.remainder : last + 1 - mapped.remainder,
+                     ExtensionRun{
+                         .source_index = reflected ? 2 * last - mapped.remainder : mapped.remainder,
+                         .period_quotient = mapped.quotient,
+                         .step = reflected ? -1 : 1,
+                         .operation = operation,
+                         .reflected = reflected});
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Write the extended samples of `run` to `store(t, value)`, t in
+ * [0, run.length), with the float expressions of evaluate_extended_index.
+ * `first` and `last` are the signal's edge samples, read once per run.
+ */
+template <typename SourceReader, typename SampleStore>
+TTWV_EXTENSION_ALWI void evaluate_extension_run(
+    const ExtensionRun& run,
+    const uint64_t length,
+    const SourceReader& read_source,
+    const SampleStore& store) noexcept {
+    switch (run.operation) {
+        case ExtensionOperation::kZero:
+            for (uint64_t t = 0; t < run.length; ++t) {
+                store(t, 0.0F);
+            }
+            return;
+        case ExtensionOperation::kSample:
+            for (uint64_t t = 0; t < run.length; ++t) {
+                store(t, read_source(run.source_index + static_cast<uint64_t>(run.step * static_cast<int64_t>(t))));
+            }
+            return;
+        case ExtensionOperation::kNegatedSample:
+            for (uint64_t t = 0; t < run.length; ++t) {
+                store(t, -read_source(run.source_index + static_cast<uint64_t>(run.step * static_cast<int64_t>(t))));
+            }
+            return;
+        case ExtensionOperation::kSmooth: {
+            const float edge = read_source(run.source_index);
+            const float slope = edge - read_source(run.auxiliary_index);
+            for (uint64_t t = 0; t < run.length; ++t) {
+                const uint64_t distance = run.distance + static_cast<uint64_t>(run.step * static_cast<int64_t>(t));
+                store(t, edge + static_cast<float>(distance) * slope);
+            }
+            return;
+        }
+        case ExtensionOperation::kAntireflect: {
+            const float first = read_source(0);
+            const float last = read_source(length - 1);
+            const float offset = (static_cast<float>(run.period_quotient) * 2.0F) * (last - first);
+            for (uint64_t t = 0; t < run.length; ++t) {
+                const float source =
+                    read_source(run.source_index + static_cast<uint64_t>(run.step * static_cast<int64_t>(t)));
+                store(t, (run.reflected ? 2.0F * last - source : source) + offset);
+            }
+            return;
+        }
+    }
+}
+
 template <typename SourceReader>
 [[nodiscard]] TTWV_EXTENSION_ALWI float evaluate_extended_index(
     const ExtendedIndex& extended, const uint32_t length, const SourceReader& read_source) noexcept {
@@ -345,7 +552,7 @@ template <BoundaryMode Mode, typename SourceReader>
         return extended.operation == ExtensionOperation::kZero ? 0.0F : read_source(extended.source_index);
     } else if constexpr (
         Mode == BoundaryMode::kConstant || Mode == BoundaryMode::kSymmetric || Mode == BoundaryMode::kReflect ||
-        Mode == BoundaryMode::kPeriodic) {
+        Mode == BoundaryMode::kPeriodic || Mode == BoundaryMode::kPeriodization) {
         return read_source(extended.source_index);
     } else if constexpr (Mode == BoundaryMode::kAntisymmetric) {
         const float source = read_source(extended.source_index);
@@ -57,6 +57,7 @@ enum LwtChunkConfigWord : uint32_t {
     kLwtInitialEvenLength = 1,
     kLwtInitialOddBegin = 2,
     kLwtInitialOddLength = 3,
+    kLwtChunkFlags = 4,
 
     // ILWT reuses the same 64-byte chunk page with a direction-specific
     // contract.  The first four words describe canonical coefficient inputs.
@@ -76,4 +77,65 @@ enum LwtChunkConfigWord : uint32_t {
     kIlwtOutputLength = 13,
 };
 
+// The chunk's initial cone lies inside the signal; its reader takes the
+// extension-free path.
+constexpr uint32_t kLwtChunkFlagInterior = 1U << 0;
+
+// Boundary chunks of a forward LWT take their halo samples from the plan's
+// extension table: left-halo entries, then right-halo entries, four to a
+// page. The reader keeps the whole table in L1 for the launch.
+constexpr uint32_t kExtensionEntryWordCount = 4;
+constexpr uint32_t kExtensionConfigWordCount = 16;
+constexpr uint32_t kExtensionConfigPageBytes = kExtensionConfigWordCount * sizeof(uint32_t);
+constexpr uint32_t kExtensionEntriesPerPage = kExtensionConfigWordCount / kExtensionEntryWordCount;
+
+enum ExtensionEntryWord : uint32_t {
+    kExtensionSourceIndex = 0,
+    kExtensionAuxiliaryIndex = 1,
+    kExtensionScale = 2,
+    kExtensionOperation = 3,
+};
+
+// kExtensionOperation holds the ExtensionOperation in its low byte.
+constexpr uint32_t kExtensionOperationMask = 0xFFU;
+constexpr uint32_t kExtensionFlagReflected = 1U << 8;
+
+// An empty table still occupies one zero page.
+[[nodiscard]] constexpr uint32_t extension_config_page_count(const uint32_t entry_count) noexcept {
+    const uint32_t page_count = (entry_count + kExtensionEntriesPerPage - 1) / kExtensionEntriesPerPage;
+    return page_count > 0 ? page_count : 1U;
+}
+
+// Mixed-scheme batches carry each route's coefficients as runtime data: one
+// coefficient page per (item, route) instead of a compiled scheme header.
+constexpr uint32_t kLwtCoefficientConfigWordCount = 32;
+constexpr uint32_t kLwtCoefficientConfigPageBytes = kLwtCoefficientConfigWordCount * sizeof(uint32_t);
+
+enum LwtCoefficientConfigWord : uint32_t {
+    kLwtCoefficientStepType = 0,
+    kLwtCoefficientTapCount = 1,
+    kLwtCoefficientOutputScale = 2,
+    kLwtCoefficientFirst = 3,
+};
+
+static_assert(kLwtCoefficientFirst + kStepCoeffCapacity <= kLwtCoefficientConfigWordCount);
+
+// One page per scheduled work item of a mixed-scheme batch, in core-slot
+// order. Page indices are absolute within the batch's config buffers.
+constexpr uint32_t kLwtBatchWorkConfigWordCount = 16;
+constexpr uint32_t kLwtBatchWorkConfigPageBytes = kLwtBatchWorkConfigWordCount * sizeof(uint32_t);
+
+enum LwtBatchWorkConfigWord : uint32_t {
+    kLwtBatchWorkItem = 0,
+    kLwtBatchWorkChunk = 1,
+    kLwtBatchWorkChunkPage = 2,
+    kLwtBatchWorkRoutePage = 3,
+    kLwtBatchWorkRouteCount = 4,
+    kLwtBatchWorkCoefficientPage = 5,
+    kLwtBatchWorkInputAddr = 6,
+    kLwtBatchWorkInputLength = 7,
+    kLwtBatchWorkBoundaryMode = 8,
+    kLwtBatchWorkInputLeftPad = 9,
+};
+
 }  // namespace ttwv::device_protocol
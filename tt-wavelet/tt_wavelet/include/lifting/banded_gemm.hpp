@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <vector>
+
+#include "tt_wavelet/include/lifting/host_executor.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/static_scheme.hpp"
+
+namespace ttwv {
+
+// Register tile of the banded GEMM: output rows (stream positions) by batch
+// columns. Each source row loaded into a tile feeds up to kRowTile outputs.
+inline constexpr size_t kBandedGemmRowTile = 4;
+inline constexpr size_t kBandedGemmColumnTile = 16;
+// Workspace bytes one panel of the batch may occupy across the three slots;
+// wider panels spill the streams out of the core's L2 between steps.
+inline constexpr size_t kBandedGemmPanelBytes = size_t{1} << 20;
+
+/**
+ * Coefficients of every executable step of `Scheme`, in step order.
+ *
+ * The banded GEMM engine runs the unchunked forward plan, so the terminal
+ * scales stay separate routes rather than folding into the last
+ * predict/update as make_host_lwt_route_coefficients does.
+ */
+template <typename Scheme>
+[[nodiscard]] std::vector<HostRouteCoefficients> make_banded_gemm_coefficients() {
+    std::vector<HostRouteCoefficients> steps;
+    steps.reserve(Scheme::num_steps);
+    host_executor_detail::append_scheme_coefficients<Scheme>(steps);
+    return steps;
+}
+
+namespace banded_gemm_detail {
+
+// Largest stream any route reads or writes, in samples per signal.
+[[nodiscard]] inline size_t stream_elements(const LiftingForwardPlan& plan) noexcept {
+    const PadSplit1DLayout& layout = plan.preprocess_layout;
+    size_t elements = std::max(layout.output.even.length, layout.output.odd.length);
+    for (const LiftingStepRoute& route : plan.routes) {
+        elements = std::max({elements, route.source_length, route.base_length, route.output_length});
+    }
+    return elements;
+}
+
+// Initial stream of `phase` as a position x batch matrix, batch contiguous.
+inline void pack_initial_stream(
+    float* slot,
+    const size_t stream_length,
+    const size_t phase,
+    const std::span<const std::span<const float>> inputs,
+    const Pad1DConfig& pad) {
+    const size_t batch = inputs.size();
+    for (size_t column = 0; column < batch; ++column) {
+        const std::span<const float> input = inputs[column];
+        for (size_t i = 0; i < stream_length; ++i) {
+            const int64_t index = static_cast<int64_t>(2 * i + phase) - static_cast<int64_t>(pad.left);
+            slot[i * batch + column] = host_executor_detail::read_extended_sample(input, pad.mode, index);
+        }
+    }
+}
+
+/**
+ * out[i, :] = base[i, :] + sum_j h[j] * source[i + k - 1 - j, :] over a
+ * (rows x batch) matrix: the banded Toeplitz product of one predict/update
+ * step applied to every signal of the batch.
+ *
+ * A full tile accumulates kRowTile x kColumnTile outputs in registers and
+ * walks the kRowTile + k - 1 source rows of its band once, newest first, so
+ * every output still adds its taps in the stencil's order.
+ */
+inline void banded_step(
+    const float* source,
+    const float* base,
+    float* output,
+    const size_t rows,
+    const size_t batch,
+    const HostRouteCoefficients& step) {
+    const size_t k = step.k;
+    const size_t full_columns = batch - batch % kBandedGemmColumnTile;
+    const size_t full_rows = rows - rows % kBandedGemmRowTile;
+    for (size_t column = 0; column < full_columns; column += kBandedGemmColumnTile) {
+        for (size_t row = 0; row < full_rows; row += kBandedGemmRowTile) {
+            std::array<std::array<float, kBandedGemmColumnTile>, kBandedGemmRowTile> tile;
+            for (size_t r = 0; r < kBandedGemmRowTile; ++r) {
+                const float* base_row = base + (row + r) * batch + column;
+                for (size_t c = 0; c < kBandedGemmColumnTile; ++c) {
+                    tile[r][c] = base_row[c];
+                }
+            }
+            for (size_t s = kBandedGemmRowTile + k - 1; s-- > 0;) {
+                const float* source_row = source + (row + s) * batch + column;
+                // Source row s meets output row r at tap r + k - 1 - s.
+                const size_t first = s >= k - 1 ? s - (k - 1) : 0;
+                const size_t last = std::min(s, kBandedGemmRowTile - 1);
+                for (size_t r = first; r <= last; ++r) {
+                    const float h = step.coefficients[r + k - 1 - s];
+                    for (size_t c = 0; c < kBandedGemmColumnTile; ++c) {
+                        tile[r][c] += h * source_row[c];
+                    }
+                }
+            }
+            for (size_t r = 0; r < kBandedGemmRowTile; ++r) {
+                float* output_row = output + (row + r) * batch + column;
+                for (size_t c = 0; c < kBandedGemmColumnTile; ++c) {
+                    output_row[c] = tile[r][c];
+                }
+            }
+        }
+    }
+
+    // Remainder rows and columns run as a plain stencil per element.
+    const auto element = [&](const size_t row, const size_t column) {
+        float value = base[row * batch + column];
+        for (size_t j = 0; j < k; ++j) {
+            value += step.coefficients[j] * source[(row + k - 1 - j) * batch + column];
+        }
+        output[row * batch + column] = value;
+    };
+    for (size_t row = 0; row < rows; ++row) {
+        const size_t column_begin = row < full_rows ? full_columns : 0;
+        for (size_t column = column_begin; column < batch; ++column) {
+            element(row, column);
+        }
+    }
+}
+
+}  // namespace banded_gemm_detail
+
+/**
+ * Signals per panel: as many whole column tiles as fit kBandedGemmPanelBytes
+ * of workspace for `plan`'s longest stream, and at least one tile.
+ */
+[[nodiscard]] inline size_t banded_gemm_panel_columns(const LiftingForwardPlan& plan) noexcept {
+    const size_t column_bytes = banded_gemm_detail::stream_elements(plan) * sizeof(float) * 3;
+    const size_t columns = kBandedGemmPanelBytes / std::max<size_t>(column_bytes, 1);
+    return std::max(kBandedGemmColumnTile, columns - columns % kBandedGemmColumnTile);
+}
+
+namespace banded_gemm_detail {
+
+inline void execute_panel(
+    const LiftingForwardPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const std::span<const float>> inputs,
+    const std::span<const std::span<float>> approximations,
+    const std::span<const std::span<float>> details,
+    HostLwtWorkspace& workspace) {
+    const size_t batch = inputs.size();
+    const PadSplit1DLayout& layout = plan.preprocess_layout;
+    pack_initial_stream(workspace.at(StorageSlot::kA).data(), layout.output.even.length, 0, inputs, layout.pad_config);
+    pack_initial_stream(workspace.at(StorageSlot::kB).data(), layout.output.odd.length, 1, inputs, layout.pad_config);
+
+    const int center = static_cast<int>(layout.pad_config.left + 1) / 2;
+    size_t step_index = 0;
+    for (const LiftingStepRoute& route : plan.routes) {
+        if (route.type == StepType::kSwap) {
+            continue;
+        }
+        TT_FATAL(
+            step_index < coefficients.size() && coefficients[step_index].type == route.type,
+            "Banded GEMM LWT coefficients do not match the plan's step order");
+        const HostRouteCoefficients& step = coefficients[step_index++];
+        const float* source = workspace.at(route.source.slot).data() + route.source_offset * batch;
+        if (is_predict_update_step(route.type)) {
+            banded_step(
+                source,
+                workspace.at(route.base.slot).data() + route.base_offset * batch,
+                workspace.at(route.output.slot).data(),
+                route.output_length,
+                batch,
+                step);
+        } else if (route.output.storage == RouteOutputStorage::kWorkspaceSlot) {
+            float* output = workspace.at(route.output.slot).data();
+            for (size_t i = 0; i < route.output_length * batch; ++i) {
+                output[i] = source[i] * step.coefficients[0];
+            }
+        } else {
+            // Terminal scales unpack the canonical window into each signal.
+            const bool even = route.output.storage == RouteOutputStorage::kFinalEvenDram;
+            const size_t origin = static_cast<size_t>(center - (even ? plan.final_even_shift : plan.final_odd_shift));
+            const std::span<const std::span<float>> outputs = even ? approximations : details;
+            for (size_t m = 0; m < plan.output_length; ++m) {
+                const float* row = source + (origin + m) * batch;
+                for (size_t column = 0; column < batch; ++column) {
+                    outputs[column][m] = row[column] * step.coefficients[0];
+                }
+            }
+        }
+    }
+    TT_FATAL(step_index == coefficients.size(), "Banded GEMM LWT plan does not consume every coefficient set");
+}
+
+}  // namespace banded_gemm_detail
+
+/**
+ * Execute the forward LWT of a batch of equal-length signals on the host as
+ * banded matrix products.
+ *
+ * Each workspace slot holds a stream as a (position x batch) matrix with the
+ * batch contiguous, so a predict/update step is one banded Toeplitz product
+ * over all signals of a panel at once; scales are elementwise. The batch
+ * runs in panels of banded_gemm_panel_columns signals, each through every
+ * step, so the streams stay cache resident. `plan` is the unchunked forward
+ * plan of the signal length and `coefficients` come from
+ * make_banded_gemm_coefficients. Signal b reads `inputs[b]` and writes the
+ * canonical prefix of `approximations[b]` and `details[b]`; the results
+ * match execute_lwt_on_host with unfolded coefficients bit for bit.
+ */
+inline void execute_banded_gemm_lwt_on_host(
+    const LiftingForwardPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const std::span<const float>> inputs,
+    const std::span<const std::span<float>> approximations,
+    const std::span<const std::span<float>> details,
+    HostLwtWorkspace& workspace) {
+    const size_t batch = inputs.size();
+    TT_FATAL(batch > 0, "Banded GEMM LWT requires at least one signal");
+    TT_FATAL(
+        approximations.size() == batch && details.size() == batch,
+        "Banded GEMM LWT of {} signals received {} approximations and {} details",
+        batch,
+        approximations.size(),
+        details.size());
+    for (size_t column = 0; column < batch; ++column) {
+        TT_FATAL(
+            inputs[column].size() == plan.preprocess_layout.input.length,
+            "Banded GEMM LWT signal {} has {} samples but the plan expects {}",
+            column,
+            inputs[column].size(),
+            plan.preprocess_layout.input.length);
+        TT_FATAL(
+            approximations[column].size() >= plan.output_length && details[column].size() >= plan.output_length,
+            "Banded GEMM LWT outputs must hold {} samples",
+            plan.output_length);
+    }
+
+    const size_t panel_columns = std::min(batch, banded_gemm_panel_columns(plan));
+    const size_t slot_elements = banded_gemm_detail::stream_elements(plan) * panel_columns;
+    for (std::vector<float>& slot : workspace.slots) {
+        if (slot.size() < slot_elements) {
+            slot.resize(slot_elements);
+        }
+    }
+    for (size_t first = 0; first < batch; first += panel_columns) {
+        const size_t columns = std::min(panel_columns, batch - first);
+        banded_gemm_detail::execute_panel(
+            plan,
+            coefficients,
+            inputs.subspan(first, columns),
+            approximations.subspan(first, columns),
+            details.subspan(first, columns),
+            workspace);
+    }
+}
+
+}  // namespace ttwv
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tt_stl/assert.hpp>
+#include <utility>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/plan_2d.hpp"
+
+namespace ttwv {
+
+/**
+ * Inclusive range of logical input lengths served by one executable.
+ */
+struct LengthBucket {
+    size_t min_length{1};
+    size_t max_length{1};
+
+    [[nodiscard]] constexpr bool contains(const size_t length) const noexcept {
+        return min_length <= length && length <= max_length;
+    }
+    [[nodiscard]] constexpr size_t size() const noexcept { return max_length - min_length + 1; }
+};
+
+/**
+ * A forward plan built once for `bucket.max_length` and proven to produce
+ * the canonical transform of every length in the bucket.
+ *
+ * Only the logical input length and the derived extension bounds change per
+ * call; chunk and route config pages are shared by the whole bucket.
+ *
+ * The host executor and the planner benchmark consume bucketed plans; the
+ * TTNN forward 1D factory applies the same bucketing with its own planner.
+ */
+struct LwtBucketedExecutionPlan {
+    LengthBucket bucket{};
+    LwtExecutionPlan plan{};
+    size_t min_output_length{0};
+    uint32_t min_active_chunk_count{0};
+    size_t validated_length_count{0};
+};
+
+/**
+ * Per-call values that replace the planned length of a bucketed executable.
+ */
+struct LwtBucketRuntime {
+    uint32_t input_length{0};
+    uint32_t left_pad{0};
+    size_t output_length{0};
+    uint32_t active_chunk_count{0};
+};
+
+struct Lwt2DBucketedExecutionPlan {
+    LengthBucket height_bucket{};
+    LengthBucket width_bucket{};
+    Lwt2DExecutionPlan plan{};
+    size_t validated_length_count{0};
+};
+
+struct Lwt2DBucketRuntime {
+    uint32_t input_height{0};
+    uint32_t input_width{0};
+    uint32_t y_left_pad{0};
+    uint32_t x_left_pad{0};
+    size_t band_height{0};
+    size_t band_width{0};
+    uint32_t active_chunk_count{0};
+};
+
+namespace bucket_detail {
+
+/**
+ * A shorter signal reuses the bucket plan when every route keeps the same
+ * stream shifts and local offsets. Then each stream of the shorter plan is
+ * a prefix of the bucket stream, computed by the same stencil from the same
+ * extended input samples, so the canonical output prefix is identical.
+ */
+inline void require_bucket_prefix(const LiftingForwardPlan& candidate, const LiftingForwardPlan& bucket) {
+    const size_t length = candidate.preprocess_layout.input.length;
+    const Pad1DConfig& candidate_pad = candidate.preprocess_layout.pad_config;
+    const Pad1DConfig& bucket_pad = bucket.preprocess_layout.pad_config;
+    TT_FATAL(
+        candidate_pad.mode == bucket_pad.mode && candidate_pad.left == bucket_pad.left &&
+            candidate_pad.right == bucket_pad.right,
+        "Length {} changes the boundary extension layout of its bucket",
+        length);
+    TT_FATAL(
+        candidate.final_even_shift == bucket.final_even_shift && candidate.final_odd_shift == bucket.final_odd_shift,
+        "Length {} changes the terminal stream shifts of its bucket",
+        length);
+    TT_FATAL(
+        candidate.routes.size() == bucket.routes.size(), "Length {} changes the route count of its bucket", length);
+    for (size_t route_index = 0; route_index < candidate.routes.size(); ++route_index) {
+        TT_FATAL(
+            same_route_geometry(candidate.routes[route_index], bucket.routes[route_index]),
+            "Length {} changes the geometry of bucket route {}",
+            length,
+            route_index);
+        TT_FATAL(
+            candidate.routes[route_index].output_length <= bucket.routes[route_index].output_length,
+            "Length {} produces a longer route {} than its bucket",
+            length,
+            route_index);
+    }
+    TT_FATAL(
+        candidate.output_length <= bucket.output_length &&
+            candidate.final_even_length <= bucket.final_even_length &&
+            candidate.final_odd_length <= bucket.final_odd_length,
+        "Length {} produces a longer output than its bucket",
+        length);
+}
+
+/**
+ * Number of leading chunks whose canonical output interval starts inside
+ * `output_length`. `build_chunks` orders chunks by output, so the active
+ * chunks always form a prefix.
+ */
+[[nodiscard]] inline uint32_t active_chunk_count(const LwtExecutionPlan& plan, const size_t output_length) {
+    const int64_t canonical_start = static_cast<int64_t>(plan.full_plan.preprocess_layout.pad_config.left + 1) / 2;
+    const size_t final_even_origin = static_cast<size_t>(canonical_start - plan.full_plan.final_even_shift);
+    uint32_t count = 0;
+    for (const LwtChunkPlan& chunk : plan.chunks) {
+        if (chunk.final_even.begin - final_even_origin >= output_length) {
+            break;
+        }
+        ++count;
+    }
+    return std::max<uint32_t>(count, 1);
+}
+
+template <typename Scheme>
+[[nodiscard]] size_t validate_axis_bucket(
+    const LengthBucket bucket, const LiftingForwardPlan& bucket_plan, const BoundaryMode boundary_mode) {
+    for (size_t length = bucket.min_length; length <= bucket.max_length; ++length) {
+        require_bucket_prefix(
+            make_forward_lifting_plan<Scheme>(SignalBuffer{.length = length}, 0, 0, boundary_mode), bucket_plan);
+    }
+    return bucket.size();
+}
+
+inline void validate_bucket_bounds(const LengthBucket bucket, const BoundaryMode boundary_mode, const char* label) {
+    TT_FATAL(bucket.min_length > 0, "{} length bucket must start at a positive length", label);
+    TT_FATAL(
+        bucket.min_length <= bucket.max_length,
+        "{} length bucket [{}, {}] is empty",
+        label,
+        bucket.min_length,
+        bucket.max_length);
+    TT_FATAL(
+        !boundary_mode_requires_multiple_samples(boundary_mode) || bucket.min_length > 1,
+        "{} reflect and antireflect buckets must exclude length one",
+        label);
+}
+
+}  // namespace bucket_detail
+
+/**
+ * Bucket containing `length` for scheme `Scheme`, `groups_per_bucket` final
+ * output groups wide.
+ *
+ * The upper bound is the longest input whose canonical output still fits
+ * the rounded group count, so the bucket executable computes no output
+ * group that the longest member does not need. Reflect and antireflect
+ * buckets start at two samples.
+ */
+template <typename Scheme>
+[[nodiscard]] LengthBucket make_lwt_length_bucket(
+    const size_t length,
+    const uint32_t groups_per_bucket = 1,
+    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric) {
+    TT_FATAL(length > 0, "LWT length bucket requires a positive length");
+    TT_FATAL(groups_per_bucket > 0, "LWT length bucket must span at least one output group");
+    constexpr size_t tap = Scheme::tap_size;
+    constexpr size_t group = device_protocol::kLwtGroupOutputElements;
+    static_assert(tap <= 2 * group, "Lifting tap exceeds one output group");
+
+    // A length with output (N + tap - 1) / 2 <= M satisfies N <= 2 * M + 2 - tap;
+    // with the periodization output (N + 1) / 2, N <= 2 * M.
+    const bool periodization = boundary_mode == BoundaryMode::kPeriodization;
+    const auto max_length_for_groups = [periodization](const size_t groups) {
+        return periodization ? 2 * groups * group : 2 * groups * group + 2 - tap;
+    };
+    const size_t output_length = forward_lifting_output_length<Scheme>(length, boundary_mode);
+    const size_t groups = round_up(std::max(ceil_div(output_length, group), size_t{1}), groups_per_bucket);
+    const size_t previous_groups = groups - groups_per_bucket;
+    const size_t shortest = boundary_mode_requires_multiple_samples(boundary_mode) ? 2 : 1;
+    return LengthBucket{
+        .min_length = previous_groups == 0 ? shortest : max_length_for_groups(previous_groups) + 1,
+        .max_length = max_length_for_groups(groups),
+    };
+}
+
+/**
+ * Plan `bucket.max_length` once and prove the plan for every member length.
+ *
+ * The proof is exhaustive: each member's forward plan must keep the bucket's
+ * extension layout, terminal shifts, and route offsets, and must not be
+ * longer anywhere. Chunk cones are derived from those offsets only, so the
+ * bucket's chunks cover every member's dependency cone.
+ */
+template <typename Scheme>
+[[nodiscard]] LwtBucketedExecutionPlan make_bucketed_lwt_execution_plan(
+    const LengthBucket bucket,
+    const uint32_t core_limit,
+    const uint32_t l1_signal_budget_bytes,
+    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
+    const WorkspaceLayout workspace_layout = WorkspaceLayout::kRowMajor) {
+    bucket_detail::validate_bucket_bounds(bucket, boundary_mode, "LWT");
+    LwtExecutionPlan plan = make_lwt_execution_plan(
+        make_forward_lifting_plan<Scheme>(SignalBuffer{.length = bucket.max_length}, 0, 0, boundary_mode),
+        core_limit,
+        l1_signal_budget_bytes,
+        workspace_layout);
+    TT_FATAL(
+        plan.full_plan.preprocess_layout.padded_length() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+        "LWT bucket upper bound {} exceeds the device signed-index range",
+        bucket.max_length);
+    const size_t validated = bucket_detail::validate_axis_bucket<Scheme>(bucket, plan.full_plan, boundary_mode);
+    // Members share the chunk pages and the left pad, so a chunk is interior
+    // for every member exactly when it is for the shortest one.
+    const LiftingForwardPlan shortest =
+        make_forward_lifting_plan<Scheme>(SignalBuffer{.length = bucket.min_length}, 0, 0, boundary_mode);
+    for (LwtChunkPlan& chunk : plan.chunks) {
+        chunk.interior = execution_detail::initial_cone_is_interior(shortest, chunk.initial_even, chunk.initial_odd);
+    }
+    const size_t min_output_length = forward_lifting_output_length<Scheme>(bucket.min_length, boundary_mode);
+    const uint32_t min_active_chunk_count = bucket_detail::active_chunk_count(plan, min_output_length);
+    return LwtBucketedExecutionPlan{
+        .bucket = bucket,
+        .plan = std::move(plan),
+        .min_output_length = min_output_length,
+        .min_active_chunk_count = min_active_chunk_count,
+        .validated_length_count = validated,
+    };
+}
+
+/**
+ * Bind one logical length to a bucketed plan for the host executor.
+ *
+ * These are the values a device bucket executable would take as runtime
+ * arguments; the LWT reader already reads length and left pad that way.
+ */
+template <typename Scheme>
+[[nodiscard]] LwtBucketRuntime bind_lwt_bucket_runtime(
+    const LwtBucketedExecutionPlan& bucketed, const size_t input_length) {
+    TT_FATAL(
+        bucketed.bucket.contains(input_length),
+        "LWT length {} is outside bucket [{}, {}]",
+        input_length,
+        bucketed.bucket.min_length,
+        bucketed.bucket.max_length);
+    const LiftingForwardPlan& full_plan = bucketed.plan.full_plan;
+    const Pad1DConfig& pad = full_plan.preprocess_layout.pad_config;
+    const size_t output_length = forward_lifting_output_length<Scheme>(input_length, pad.mode);
+    return LwtBucketRuntime{
+        .input_length = static_cast<uint32_t>(input_length),
+        .left_pad = pad.left,
+        .output_length = output_length,
+        .active_chunk_count = bucket_detail::active_chunk_count(bucketed.plan, output_length),
+    };
+}
+
+/**
+ * Two-dimensional counterpart of `make_bucketed_lwt_execution_plan`.
+ *
+ * The separable planner builds independent axis plans, so each axis bucket
+ * is proven with the one-dimensional prefix argument.
+ */
+template <typename Scheme>
+[[nodiscard]] Lwt2DBucketedExecutionPlan make_bucketed_lwt_2d_execution_plan(
+    const LengthBucket height_bucket,
+    const LengthBucket width_bucket,
+    const uint32_t core_limit,
+    const uint64_t l1_budget_bytes,
+    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
+    const bool fuse_terminal_scale = false,
+    const bool latency_oriented_planner = false,
+    const Lwt2DRouteDomainPolicy route_domain = Lwt2DRouteDomainPolicy::kExact) {
+    bucket_detail::validate_bucket_bounds(height_bucket, boundary_mode, "2D LWT height");
+    bucket_detail::validate_bucket_bounds(width_bucket, boundary_mode, "2D LWT width");
+    TT_FATAL(
+        height_bucket.max_length <= static_cast<size_t>(std::numeric_limits<int32_t>::max() / 2) &&
+            width_bucket.max_length <= static_cast<size_t>(std::numeric_limits<int32_t>::max() / 2),
+        "2D LWT bucket upper bounds exceed the device signed-index range");
+    Lwt2DExecutionPlan plan = make_lwt_2d_execution_plan<Scheme>(
+        height_bucket.max_length,
+        width_bucket.max_length,
+        core_limit,
+        l1_budget_bytes,
+        boundary_mode,
+        fuse_terminal_scale,
+        latency_oriented_planner,
+        route_domain);
+    const size_t validated = bucket_detail::validate_axis_bucket<Scheme>(height_bucket, plan.y_plan, boundary_mode) +
+                             bucket_detail::validate_axis_bucket<Scheme>(width_bucket, plan.x_plan, boundary_mode);
+    return Lwt2DBucketedExecutionPlan{
+        .height_bucket = height_bucket,
+        .width_bucket = width_bucket,
+        .plan = std::move(plan),
+        .validated_length_count = validated,
+    };
+}
+
+// Host executor binding for a 2D bucket; no device 2D executable is built
+// from one yet.
+template <typename Scheme>
+[[nodiscard]] Lwt2DBucketRuntime bind_lwt_2d_bucket_runtime(
+    const Lwt2DBucketedExecutionPlan& bucketed, const size_t input_height, const size_t input_width) {
+    TT_FATAL(
+        bucketed.height_bucket.contains(input_height) && bucketed.width_bucket.contains(input_width),
+        "2D LWT shape {}x{} is outside bucket [{}, {}]x[{}, {}]",
+        input_height,
+        input_width,
+        bucketed.height_bucket.min_length,
+        bucketed.height_bucket.max_length,
+        bucketed.width_bucket.min_length,
+        bucketed.width_bucket.max_length);
+    const Pad1DConfig& y_pad = bucketed.plan.y_plan.preprocess_layout.pad_config;
+    const Pad1DConfig& x_pad = bucketed.plan.x_plan.preprocess_layout.pad_config;
+    const size_t band_height = forward_lifting_output_length<Scheme>(input_height, y_pad.mode);
+    const size_t band_width = forward_lifting_output_length<Scheme>(input_width, x_pad.mode);
+    // 2D chunks tile the band row-major, so active chunks are a sub-grid
+    // rather than a prefix; report the count for scheduling.
+    const auto active_chunks = std::count_if(
+        bucketed.plan.chunks.begin(), bucketed.plan.chunks.end(), [&](const Lwt2DChunkPlan& chunk) {
+            return chunk.final_band_rect.y.begin < band_height && chunk.final_band_rect.x.begin < band_width;
+        });
+    return Lwt2DBucketRuntime{
+        .input_height = static_cast<uint32_t>(input_height),
+        .input_width = static_cast<uint32_t>(input_width),
+        .y_left_pad = y_pad.left,
+        .x_left_pad = x_pad.left,
+        .band_height = band_height,
+        .band_width = band_width,
+        .active_chunk_count = static_cast<uint32_t>(active_chunks),
+    };
+}
+
+}  // namespace ttwv
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/common/signal_extension.hpp"
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/page_geometry.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/route_table.hpp"
+#include "tt_wavelet/include/lifting/segmented_plan.hpp"
+
+namespace ttwv {
+
+/**
+ * One level of one chunk in a fused cascade stage.
+ *
+ * `owned` are the canonical outputs of the level that this chunk stores:
+ * detail coefficients at every level, and the approximation at the stage's
+ * coarsest level. `computed` adds the halo of approximation samples that the
+ * next level's cone reads; those stay in the chunk's L1 level buffer. The
+ * chunk plan targets `computed`, so its terminal routes address canonical
+ * output indices.
+ */
+struct LwtCascadeChunkLevel {
+    IndexInterval owned{};
+    IndexInterval computed{};
+    LwtChunkPlan chunk{};
+};
+
+/**
+ * Consecutive levels computed by one pass over the stage input.
+ *
+ * Chunk levels are stored chunk-major, finest level first. Only the stage's
+ * input and its coarsest approximation touch DRAM; approximations of the
+ * levels in between live in one per-core level buffer, which each level
+ * reads into its workspace slots before overwriting it with its own output.
+ */
+struct LwtCascadeStage {
+    uint32_t first_level{0};
+    uint32_t level_count{0};
+    std::vector<LwtCascadeChunkLevel> chunk_levels;
+    LwtRouteTable route_table{};
+    uint32_t workspace_elements{0};
+    uint32_t level_buffer_elements{0};
+    uint64_t l1_bytes_per_core{0};
+
+    [[nodiscard]] size_t chunk_count() const noexcept {
+        return level_count == 0 ? 0 : chunk_levels.size() / level_count;
+    }
+    [[nodiscard]] const LwtCascadeChunkLevel& at(const size_t chunk_index, const size_t level) const {
+        TT_FATAL(level < level_count, "Cascade stage level {} is out of range for {} levels", level, level_count);
+        return chunk_levels.at(chunk_index * level_count + level);
+    }
+};
+
+/**
+ * Halo growth of one cascade level: how many approximation samples the
+ * chunks compute beyond the ones they own, so that the next fused level can
+ * read its whole cone from L1.
+ */
+struct LwtCascadeLevelReport {
+    uint32_t level{0};
+    uint32_t stage{0};
+    size_t input_length{0};
+    size_t output_length{0};
+    size_t computed_elements{0};
+    size_t max_halo_elements{0};
+    double halo_overhead{0.0};
+};
+
+struct LwtCascadePlan {
+    BoundaryMode boundary_mode{BoundaryMode::kSymmetric};
+    std::vector<LiftingForwardPlan> levels;
+    std::vector<LwtCascadeStage> stages;
+    std::vector<LwtCascadeLevelReport> level_reports;
+    LwtPageGeometry page_geometry{};
+    // Intermediate approximation samples neither written to nor re-read from
+    // DRAM, compared with running the levels one transform at a time.
+    uint64_t dram_elements_avoided{0};
+};
+
+namespace cascade_detail {
+
+/**
+ * Canonical samples of a `length`-sample signal read by padded samples
+ * [cone.begin, cone.end) of its extension. Extended samples map back through
+ * the boundary mode, including the edge samples that smooth and antireflect
+ * extrapolate from, so the hull is exactly what the chunk must hold.
+ */
+[[nodiscard]] inline IndexInterval extension_source_hull(
+    const segment_detail::PaddedCone cone, const Pad1DConfig& pad, const size_t length) {
+    const int64_t begin = static_cast<int64_t>(cone.begin) - static_cast<int64_t>(pad.left);
+    const int64_t end = static_cast<int64_t>(cone.end) - static_cast<int64_t>(pad.left);
+    const int64_t signed_length = static_cast<int64_t>(length);
+    IndexInterval hull{};
+    const auto include = [&](const size_t index) {
+        hull = execution_detail::hull(hull, IndexInterval{.begin = index, .end = index + 1});
+    };
+    if (std::max<int64_t>(begin, 0) < std::min(end, signed_length)) {
+        hull = IndexInterval{
+            .begin = static_cast<size_t>(std::max<int64_t>(begin, 0)),
+            .end = static_cast<size_t>(std::min(end, signed_length)),
+        };
+    }
+    const auto include_extended = [&](const int64_t index) {
+        const ExtendedIndex extended = make_extended_index(pad.mode, index, static_cast<uint32_t>(length));
+        switch (extended.operation) {
+            case ExtensionOperation::kZero: break;
+            case ExtensionOperation::kSample:
+            case ExtensionOperation::kNegatedSample: include(extended.source_index); break;
+            case ExtensionOperation::kSmooth:
+                include(extended.source_index);
+                include(extended.auxiliary_index);
+                break;
+            case ExtensionOperation::kAntireflect:
+                include(extended.source_index);
+                include(0);
+                include(length - 1);
+                break;
+        }
+    };
+    for (int64_t index = begin; index < std::min<int64_t>(end, 0); ++index) {
+        include_extended(index);
+    }
+    for (int64_t index = std::max(begin, signed_length); index < end; ++index) {
+        include_extended(index);
+    }
+    return hull;
+}
+
+[[nodiscard]] inline size_t canonical_origin(const LiftingForwardPlan& plan, const int final_shift) {
+    const int64_t canonical_start = static_cast<int64_t>(plan.preprocess_layout.pad_config.left + 1) / 2;
+    TT_FATAL(canonical_start >= final_shift, "LWT canonical output requires a negative origin");
+    return static_cast<size_t>(canonical_start - final_shift);
+}
+
+/**
+ * Plan levels [first_level, first_level + level_count) as one stage of
+ * `requested_chunk_count` chunks.
+ *
+ * Chunks split the coarsest level's output groups of `geometry` as
+ * build_chunks does. A chunk's owned range at a finer level is twice the
+ * owned range above it, clipped to the level, so owned ranges tile every
+ * level. Computed ranges are derived coarsest first: each level adds the
+ * canonical samples that the level above reads through its dependency cone
+ * and boundary extension.
+ */
+[[nodiscard]] inline LwtCascadeStage build_stage(
+    const std::vector<LiftingForwardPlan>& levels,
+    const uint32_t first_level,
+    const uint32_t level_count,
+    const uint32_t requested_chunk_count,
+    const LwtPageGeometry geometry) {
+    TT_FATAL(level_count > 0, "Cascade stage must fuse at least one level");
+    TT_FATAL(requested_chunk_count > 0, "Cascade chunk count must be non-zero");
+    const LiftingForwardPlan& top = levels[first_level + level_count - 1];
+    const size_t group = geometry.group_output_elements();
+    const size_t group_count = std::max(ceil_div(top.output_length, group), size_t{1});
+    const size_t chunk_count = std::min(static_cast<size_t>(requested_chunk_count), group_count);
+    const size_t base_groups = group_count / chunk_count;
+    const size_t extra_groups = group_count % chunk_count;
+
+    size_t route_rows = 0;
+    for (uint32_t level = 0; level < level_count; ++level) {
+        route_rows += execution_detail::chunk_route_count(levels[first_level + level]);
+    }
+    LwtCascadeStage stage{.first_level = first_level, .level_count = level_count, .chunk_levels = {}};
+    stage.route_table = make_lwt_route_table(chunk_count * route_rows);
+    stage.chunk_levels.reserve(chunk_count * level_count);
+
+    std::array<std::byte, execution_detail::kChunkScratchBytes> scratch_buffer;
+    std::pmr::monotonic_buffer_resource scratch{scratch_buffer.data(), scratch_buffer.size()};
+    std::vector<IndexInterval> owned(level_count);
+    std::vector<IndexInterval> computed(level_count);
+    size_t max_workspace_elements = 0;
+    size_t level_buffer_elements = 0;
+    size_t group_begin = 0;
+    for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+        const size_t chunk_groups = base_groups + (chunk_index < extra_groups ? 1 : 0);
+        const bool first_chunk = chunk_index == 0;
+        const bool last_chunk = chunk_index + 1 == chunk_count;
+        owned[level_count - 1] = IndexInterval{
+            .begin = group_begin * group,
+            .end = last_chunk ? top.output_length : (group_begin + chunk_groups) * group,
+        };
+        computed[level_count - 1] = owned[level_count - 1];
+        group_begin += chunk_groups;
+        for (uint32_t level = level_count - 1; level-- > 0;) {
+            const LiftingForwardPlan& plan = levels[first_level + level];
+            const LiftingForwardPlan& next = levels[first_level + level + 1];
+            owned[level] = IndexInterval{
+                .begin = first_chunk ? 0 : std::min(2 * owned[level + 1].begin, plan.output_length),
+                .end = last_chunk ? plan.output_length : std::min(2 * owned[level + 1].end, plan.output_length),
+            };
+            const IndexInterval needed = extension_source_hull(
+                segment_detail::padded_cone(next, computed[level + 1]),
+                next.preprocess_layout.pad_config,
+                plan.output_length);
+            computed[level] = execution_detail::hull(owned[level], needed);
+            level_buffer_elements = std::max(level_buffer_elements, computed[level].length());
+        }
+
+        for (uint32_t level = 0; level < level_count; ++level) {
+            const LiftingForwardPlan& plan = levels[first_level + level];
+            const size_t even_origin = canonical_origin(plan, plan.final_even_shift);
+            const size_t odd_origin = canonical_origin(plan, plan.final_odd_shift);
+            const IndexInterval outputs = computed[level];
+            LwtChunkPlan chunk = execution_detail::build_chunk(
+                plan,
+                IndexInterval{.begin = outputs.begin + even_origin, .end = outputs.end + even_origin},
+                IndexInterval{.begin = outputs.begin + odd_origin, .end = outputs.end + odd_origin},
+                even_origin,
+                odd_origin,
+                stage.route_table,
+                &scratch);
+            scratch.release();
+            max_workspace_elements = std::max(max_workspace_elements, chunk.max_workspace_elements);
+            stage.chunk_levels.push_back(
+                LwtCascadeChunkLevel{.owned = owned[level], .computed = outputs, .chunk = std::move(chunk)});
+        }
+    }
+    TT_FATAL(group_begin == group_count, "Cascade chunks do not cover every final output group");
+
+    const size_t workspace_elements = round_up(max_workspace_elements, static_cast<size_t>(geometry.stick_width));
+    const size_t aligned_level_buffer = round_up(level_buffer_elements, static_cast<size_t>(geometry.stick_width));
+    TT_FATAL(
+        workspace_elements <= std::numeric_limits<uint32_t>::max() &&
+            aligned_level_buffer <= std::numeric_limits<uint32_t>::max(),
+        "Cascade workspace of {} elements overflows uint32_t",
+        std::max(workspace_elements, aligned_level_buffer));
+    stage.workspace_elements = static_cast<uint32_t>(workspace_elements);
+    stage.level_buffer_elements = static_cast<uint32_t>(aligned_level_buffer);
+    stage.l1_bytes_per_core = (uint64_t{3} * workspace_elements + aligned_level_buffer) * sizeof(float);
+    return stage;
+}
+
+}  // namespace cascade_detail
+
+/**
+ * Plan a `level_count`-level forward LWT cascade, fusing consecutive levels
+ * wherever their joint working set fits the L1 budget.
+ *
+ * Each stage takes the most levels (up to `max_fused_levels`) for which some
+ * chunk count fits: like the single-level planner, chunk counts start at
+ * `core_limit` and double until the widest chunk's three workspace slots and
+ * level buffer fit `l1_signal_budget_bytes`. Deeper fusion grows the halo
+ * geometrically, since every fused level doubles the finer levels' reach,
+ * so a stage stops fusing where that halo no longer fits. A one-level stage
+ * is the ordinary single-level plan.
+ */
+template <typename Scheme>
+[[nodiscard]] LwtCascadePlan make_lwt_cascade_plan(
+    const size_t length,
+    const uint32_t level_count,
+    const uint32_t core_limit,
+    const uint32_t l1_signal_budget_bytes,
+    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
+    const uint32_t max_fused_levels = std::numeric_limits<uint32_t>::max(),
+    const LwtPageGeometry page_geometry = {}) {
+    validate_page_geometry(page_geometry);
+    TT_FATAL(level_count > 0, "LWT cascade requires at least one level");
+    TT_FATAL(max_fused_levels > 0, "LWT cascade must fuse at least one level per stage");
+    TT_FATAL(core_limit > 0, "LWT requires at least one worker core");
+    TT_FATAL(l1_signal_budget_bytes >= 3 * page_geometry.page_bytes(), "LWT L1 budget is too small");
+
+    LwtCascadePlan cascade{
+        .boundary_mode = boundary_mode,
+        .levels = {},
+        .stages = {},
+        .level_reports = {},
+        .page_geometry = page_geometry,
+    };
+    cascade.levels.reserve(level_count);
+    size_t level_length = length;
+    for (uint32_t level = 0; level < level_count; ++level) {
+        TT_FATAL(
+            level_length > (boundary_mode_requires_multiple_samples(boundary_mode) ? 1U : 0U),
+            "Cascade level {} input of {} samples is too short for its boundary mode",
+            level + 1,
+            level_length);
+        cascade.levels.push_back(
+            make_forward_lifting_plan<Scheme>(page_geometry.signal(level_length), 0, 0, boundary_mode));
+        level_length = cascade.levels.back().output_length;
+    }
+
+    for (uint32_t first_level = 0; first_level < level_count;) {
+        const uint32_t fusable = std::min(level_count - first_level, max_fused_levels);
+        bool planned = false;
+        for (uint32_t fused = fusable; fused > 0 && !planned; --fused) {
+            const size_t top_length = cascade.levels[first_level + fused - 1].output_length;
+            const size_t group_count =
+                std::max(ceil_div(top_length, static_cast<size_t>(page_geometry.group_output_elements())), size_t{1});
+            size_t chunk_count = std::min(group_count, static_cast<size_t>(core_limit));
+            for (;;) {
+                LwtCascadeStage stage = cascade_detail::build_stage(
+                    cascade.levels, first_level, fused, static_cast<uint32_t>(chunk_count), page_geometry);
+                if (stage.l1_bytes_per_core <= l1_signal_budget_bytes) {
+                    cascade.stages.push_back(std::move(stage));
+                    planned = true;
+                    break;
+                }
+                if (chunk_count == group_count) {
+                    TT_FATAL(
+                        fused > 1,
+                        "One-group cascade level {} requires {} bytes/core, exceeding the {}-byte L1 signal budget",
+                        first_level + 1,
+                        stage.l1_bytes_per_core,
+                        l1_signal_budget_bytes);
+                    break;
+                }
+                chunk_count = std::min(group_count, 2 * chunk_count);
+            }
+        }
+        first_level += cascade.stages.back().level_count;
+    }
+
+    for (uint32_t stage_index = 0; stage_index < cascade.stages.size(); ++stage_index) {
+        const LwtCascadeStage& stage = cascade.stages[stage_index];
+        for (uint32_t level = 0; level < stage.level_count; ++level) {
+            const LiftingForwardPlan& plan = cascade.levels[stage.first_level + level];
+            LwtCascadeLevelReport report{
+                .level = stage.first_level + level + 1,
+                .stage = stage_index,
+                .input_length = plan.preprocess_layout.input.length,
+                .output_length = plan.output_length,
+            };
+            for (size_t chunk_index = 0; chunk_index < stage.chunk_count(); ++chunk_index) {
+                const LwtCascadeChunkLevel& chunk_level = stage.at(chunk_index, level);
+                report.computed_elements += chunk_level.computed.length();
+                report.max_halo_elements = std::max(
+                    report.max_halo_elements, chunk_level.computed.length() - chunk_level.owned.length());
+            }
+            const size_t halo_elements =
+                report.computed_elements - std::min(report.computed_elements, plan.output_length);
+            report.halo_overhead =
+                static_cast<double>(halo_elements) / static_cast<double>(std::max<size_t>(plan.output_length, 1));
+            cascade.level_reports.push_back(report);
+            if (level + 1 < stage.level_count) {
+                cascade.dram_elements_avoided += 2 * uint64_t{plan.output_length};
+            }
+        }
+    }
+    return cascade;
+}
+
+}  // namespace ttwv
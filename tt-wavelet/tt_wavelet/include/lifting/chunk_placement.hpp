@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/lifting/core_selection.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/plan_2d.hpp"
+
+namespace ttwv {
+
+enum class ChunkPlacementPolicy : uint8_t {
+    kPlanOrder = 0,      ///< Chunks keep planner order; work ranges follow it.
+    kDramBankAware = 1,  ///< Config pages are permuted so each core's range sits near its banks.
+};
+
+/**
+ * Modelled DRAM read traffic of one chunk order on one core set.
+ *
+ * max_core_hops is the tail: reads of the busiest core, weighted by NoC
+ * hops to each bank, which bounds a bandwidth-bound transform's latency.
+ */
+struct DramTrafficReport {
+    std::vector<uint64_t> bank_pages;
+    uint64_t page_bytes{0};
+    uint64_t total_pages{0};
+    uint64_t modeled_hops{0};
+    uint64_t max_core_pages{0};
+    uint64_t max_core_hops{0};
+};
+
+struct ChunkPlacement {
+    /// chunk_order[i] is the planner chunk uploaded at config page i; the
+    /// plan itself keeps output order.
+    std::vector<uint32_t> chunk_order;
+    CoreSelection cores;
+    DramTrafficReport plan_order;
+    DramTrafficReport placed;
+
+    [[nodiscard]] bool reordered() const noexcept {
+        for (uint32_t index = 0; index < chunk_order.size(); ++index) {
+            if (chunk_order[index] != index) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * Parse the chunk placement option: null, empty or "plan-order" keep planner
+ * order and "dram-bank" enables bank-aware placement.
+ */
+[[nodiscard]] inline ChunkPlacementPolicy parse_chunk_placement_policy(const char* raw) {
+    if (raw == nullptr || raw[0] == '\0' || std::strcmp(raw, "plan-order") == 0) {
+        return ChunkPlacementPolicy::kPlanOrder;
+    }
+    TT_FATAL(std::strcmp(raw, "dram-bank") == 0, "Chunk placement must be 'plan-order' or 'dram-bank', got '{}'", raw);
+    return ChunkPlacementPolicy::kDramBankAware;
+}
+
+/**
+ * Input pages of sample 0 that each 1D chunk reads, per interleaved bank.
+ */
+[[nodiscard]] inline std::vector<DramBankHistogram> make_lwt_chunk_bank_histograms(
+    const LwtExecutionPlan& plan, const uint32_t bank_count) {
+    TT_FATAL(bank_count > 0, "Chunk bank histograms require at least one bank");
+    std::vector<DramBankHistogram> histograms(plan.chunks.size());
+    const std::vector<IndexInterval> pages = lwt_chunk_input_pages(plan);
+    for (size_t chunk = 0; chunk < pages.size(); ++chunk) {
+        histograms[chunk].pages_per_bank.assign(bank_count, 0);
+        core_selection_detail::add_page_range(histograms[chunk], pages[chunk].begin, pages[chunk].length(), bank_count);
+    }
+    return histograms;
+}
+
+/**
+ * Input tiles of sample 0 that each 2D chunk reads, per interleaved bank.
+ */
+[[nodiscard]] inline std::vector<DramBankHistogram> make_lwt_2d_chunk_bank_histograms(
+    const Lwt2DExecutionPlan& plan, const uint32_t bank_count) {
+    TT_FATAL(bank_count > 0, "Chunk bank histograms require at least one bank");
+    std::vector<DramBankHistogram> histograms(plan.chunks.size());
+    const std::vector<IndexRectangle> tiles = lwt_2d_chunk_input_tiles(plan);
+    const size_t tile_columns = plan.tiling.input.storage.width / kTileWidth2D;
+    for (size_t chunk = 0; chunk < tiles.size(); ++chunk) {
+        histograms[chunk].pages_per_bank.assign(bank_count, 0);
+        core_selection_detail::add_tile_rectangle(histograms[chunk], tiles[chunk], 0, tile_columns, bank_count);
+    }
+    return histograms;
+}
+
+namespace chunk_placement_detail {
+
+[[nodiscard]] inline std::vector<DramBankHistogram> slot_demand(
+    const std::span<const DramBankHistogram> chunks,
+    const std::span<const uint32_t> order,
+    const uint32_t slot_count,
+    const uint32_t bank_count) {
+    std::vector<DramBankHistogram> slots(slot_count);
+    for (uint32_t slot = 0; slot < slot_count; ++slot) {
+        slots[slot].pages_per_bank.assign(bank_count, 0);
+        const CoreSlotWork work = partition_core_slot_work(static_cast<uint32_t>(order.size()), slot_count, slot);
+        for (uint32_t position = work.begin; position < work.begin + work.count; ++position) {
+            const DramBankHistogram& chunk = chunks[order[position]];
+            for (uint32_t bank = 0; bank < bank_count; ++bank) {
+                slots[slot].pages_per_bank[bank] += chunk.pages_per_bank[bank];
+            }
+        }
+    }
+    return slots;
+}
+
+[[nodiscard]] inline DramTrafficReport traffic_report(
+    const WorkerGridTopology& topology,
+    const std::span<const DramBankHistogram> slots,
+    const CoreSelection& selection,
+    const uint32_t page_bytes) {
+    DramTrafficReport report{.bank_pages = std::vector<uint64_t>(topology.bank_count()), .page_bytes = page_bytes};
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        const uint64_t hops =
+            core_selection_detail::slot_cost(topology, slots[slot], topology.physical(selection.cores[slot]));
+        for (uint32_t bank = 0; bank < topology.bank_count(); ++bank) {
+            report.bank_pages[bank] += slots[slot].pages_per_bank[bank];
+        }
+        report.total_pages += slots[slot].total_pages();
+        report.modeled_hops += hops;
+        report.max_core_pages = std::max(report.max_core_pages, slots[slot].total_pages());
+        report.max_core_hops = std::max(report.max_core_hops, hops);
+    }
+    return report;
+}
+
+}  // namespace chunk_placement_detail
+
+/**
+ * Choose a config page order so that each core's contiguous work range reads
+ * banks near that core.
+ *
+ * The device partitions config pages into balanced contiguous ranges, so the
+ * placement chooses the page order rather than a new partition: cores come
+ * from select_worker_cores on planner order, then chunks are assigned to
+ * those slots, heaviest first, at their cheapest slot with remaining
+ * capacity, ties going to the least loaded slot. Pairwise chunk exchanges
+ * between slots then run until none lowers the modelled hops, followed by
+ * exchanges out of the busiest slot until none lowers the tail. Within a slot
+ * chunks stay in planner order so neighbouring halos remain adjacent. Planner
+ * order is kept unless placement models a lighter tail, or the same tail with
+ * fewer total hops.
+ */
+[[nodiscard]] inline ChunkPlacement place_chunks_near_dram_banks(
+    const WorkerGridTopology& topology,
+    const std::span<const DramBankHistogram> chunks,
+    const uint32_t active_core_count,
+    const uint32_t page_bytes) {
+    TT_FATAL(!chunks.empty(), "Chunk placement requires at least one chunk");
+    TT_FATAL(
+        active_core_count > 0 && active_core_count <= chunks.size(),
+        "Chunk placement needs between 1 and {} cores, got {}",
+        chunks.size(),
+        active_core_count);
+    const uint32_t chunk_count = static_cast<uint32_t>(chunks.size());
+    const uint32_t bank_count = topology.bank_count();
+
+    ChunkPlacement placement;
+    placement.chunk_order.resize(chunk_count);
+    std::iota(placement.chunk_order.begin(), placement.chunk_order.end(), 0U);
+    const std::vector<DramBankHistogram> plan_slots =
+        chunk_placement_detail::slot_demand(chunks, placement.chunk_order, active_core_count, bank_count);
+    placement.cores = select_worker_cores(topology, plan_slots);
+    placement.plan_order =
+        chunk_placement_detail::traffic_report(topology, plan_slots, placement.cores, page_bytes);
+
+    std::vector<NocCoordinate> physical(active_core_count);
+    for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+        physical[slot] = topology.physical(placement.cores.cores[slot]);
+    }
+    std::vector<uint64_t> cost(static_cast<size_t>(chunk_count) * active_core_count);
+    for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+        for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+            cost[static_cast<size_t>(chunk) * active_core_count + slot] =
+                core_selection_detail::slot_cost(topology, chunks[chunk], physical[slot]);
+        }
+    }
+    const auto chunk_cost = [&](const uint32_t chunk, const uint32_t slot) {
+        return cost[static_cast<size_t>(chunk) * active_core_count + slot];
+    };
+
+    std::vector<uint32_t> capacity(active_core_count);
+    for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+        capacity[slot] = partition_core_slot_work(chunk_count, active_core_count, slot).count;
+    }
+    std::vector<uint32_t> by_weight(chunk_count);
+    std::iota(by_weight.begin(), by_weight.end(), 0U);
+    std::stable_sort(by_weight.begin(), by_weight.end(), [&](const uint32_t lhs, const uint32_t rhs) {
+        return chunks[lhs].total_pages() > chunks[rhs].total_pages();
+    });
+    std::vector<uint32_t> slot_of(chunk_count);
+    std::vector<uint64_t> slot_hops(active_core_count, 0);
+    for (const uint32_t chunk : by_weight) {
+        uint32_t best = active_core_count;
+        for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+            if (capacity[slot] == 0) {
+                continue;
+            }
+            if (best == active_core_count || chunk_cost(chunk, slot) < chunk_cost(chunk, best) ||
+                (chunk_cost(chunk, slot) == chunk_cost(chunk, best) && slot_hops[slot] < slot_hops[best])) {
+                best = slot;
+            }
+        }
+        slot_of[chunk] = best;
+        --capacity[best];
+        slot_hops[best] += chunk_cost(chunk, best);
+    }
+
+    const auto exchange = [&](const uint32_t lhs, const uint32_t rhs) {
+        const uint32_t lhs_slot = slot_of[lhs];
+        const uint32_t rhs_slot = slot_of[rhs];
+        slot_hops[lhs_slot] = slot_hops[lhs_slot] - chunk_cost(lhs, lhs_slot) + chunk_cost(rhs, lhs_slot);
+        slot_hops[rhs_slot] = slot_hops[rhs_slot] - chunk_cost(rhs, rhs_slot) + chunk_cost(lhs, rhs_slot);
+        std::swap(slot_of[lhs], slot_of[rhs]);
+    };
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (uint32_t lhs = 0; lhs < chunk_count; ++lhs) {
+            for (uint32_t rhs = lhs + 1; rhs < chunk_count; ++rhs) {
+                const uint32_t lhs_slot = slot_of[lhs];
+                const uint32_t rhs_slot = slot_of[rhs];
+                if (lhs_slot != rhs_slot && chunk_cost(lhs, rhs_slot) + chunk_cost(rhs, lhs_slot) <
+                                                chunk_cost(lhs, lhs_slot) + chunk_cost(rhs, rhs_slot)) {
+                    exchange(lhs, rhs);
+                    improved = true;
+                }
+            }
+        }
+    }
+    // Total hops are now locally minimal; trade some back for a lighter tail.
+    // An exchange is taken only when both slots end below the current
+    // maximum, so each one lowers the maximum or the number of slots at it.
+    improved = true;
+    while (improved) {
+        improved = false;
+        const uint32_t busiest = static_cast<uint32_t>(
+            std::max_element(slot_hops.begin(), slot_hops.end()) - slot_hops.begin());
+        const uint64_t tail = slot_hops[busiest];
+        for (uint32_t lhs = 0; lhs < chunk_count && !improved; ++lhs) {
+            if (slot_of[lhs] != busiest) {
+                continue;
+            }
+            for (uint32_t rhs = 0; rhs < chunk_count; ++rhs) {
+                const uint32_t rhs_slot = slot_of[rhs];
+                if (rhs_slot == busiest) {
+                    continue;
+                }
+                const uint64_t busiest_after = tail - chunk_cost(lhs, busiest) + chunk_cost(rhs, busiest);
+                const uint64_t other_after =
+                    slot_hops[rhs_slot] - chunk_cost(rhs, rhs_slot) + chunk_cost(lhs, rhs_slot);
+                if (busiest_after < tail && other_after < tail) {
+                    exchange(lhs, rhs);
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<uint32_t> order(chunk_count);
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(), [&](const uint32_t lhs, const uint32_t rhs) {
+        return slot_of[lhs] < slot_of[rhs];
+    });
+    const std::vector<DramBankHistogram> placed_slots =
+        chunk_placement_detail::slot_demand(chunks, order, active_core_count, bank_count);
+    const auto lighter = [](const DramTrafficReport& lhs, const DramTrafficReport& rhs) {
+        return lhs.max_core_hops < rhs.max_core_hops ||
+               (lhs.max_core_hops == rhs.max_core_hops && lhs.modeled_hops < rhs.modeled_hops);
+    };
+    // Reselecting cores for the placed slots may undo the tail the exchanges
+    // were modelled against, so the cores they used stay a candidate.
+    CoreSelection placed_cores = select_worker_cores(topology, placed_slots);
+    DramTrafficReport placed = chunk_placement_detail::traffic_report(topology, placed_slots, placed_cores, page_bytes);
+    const DramTrafficReport modelled =
+        chunk_placement_detail::traffic_report(topology, placed_slots, placement.cores, page_bytes);
+    if (lighter(modelled, placed)) {
+        placed_cores = placement.cores;
+        placed_cores.modeled_hops = modelled.modeled_hops;
+        placed = modelled;
+    }
+    if (lighter(placed, placement.plan_order)) {
+        placement.chunk_order = std::move(order);
+        placement.cores = std::move(placed_cores);
+        placement.placed = placed;
+    } else {
+        placement.placed = placement.plan_order;
+    }
+    return placement;
+}
+
+}  // namespace ttwv
@@ -0,0 +1,624 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/extension_table.hpp"
+#include "tt_wavelet/include/lifting/incremental_plan.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan.hpp"
+#include "tt_wavelet/include/lifting/mixed_batch_plan.hpp"
+
+namespace ttwv {
+
+/**
+ * @brief Device addresses referenced by 1D route/chunk pages.
+ *
+ * The writers below are host-only: the executable resolves its MeshBuffer
+ * addresses once and the protocol pages are then emitted without touching the
+ * device API.
+ */
+struct LwtConfigAddresses {
+    std::array<uint32_t, 3> slots{};
+    uint32_t final_even{0};
+    uint32_t final_odd{0};
+
+    [[nodiscard]] constexpr uint32_t at(const StorageSlot slot) const noexcept {
+        return slots[static_cast<size_t>(slot)];
+    }
+};
+
+/**
+ * @brief Per-item DRAM addresses of a mixed-scheme batch.
+ *
+ * Workspace slots are shared by every item and passed separately.
+ */
+struct LwtBatchItemAddresses {
+    uint32_t input{0};
+    uint32_t final_even{0};
+    uint32_t final_odd{0};
+};
+
+struct IlwtConfigAddresses {
+    std::array<uint32_t, 3> slots{};
+
+    [[nodiscard]] constexpr uint32_t at(const StorageSlot slot) const noexcept {
+        return slots[static_cast<size_t>(slot)];
+    }
+};
+
+namespace config_detail {
+
+[[nodiscard]] inline uint32_t checked_u32(const size_t value, const char* label) {
+    TT_FATAL(
+        value <= static_cast<size_t>(std::numeric_limits<uint32_t>::max()), "{} {} overflows uint32_t", label, value);
+    return static_cast<uint32_t>(value);
+}
+
+[[nodiscard]] inline uint32_t group_count(
+    const size_t output_length, const size_t group_elements = device_protocol::kLwtGroupOutputElements) {
+    return checked_u32(ceil_div(output_length, group_elements), "LWT group count");
+}
+
+template <typename Chunks>
+[[nodiscard]] inline size_t uniform_route_count(const Chunks& chunks, const char* label) {
+    TT_FATAL(!chunks.empty(), "{} plan has no chunks", label);
+    const size_t route_count = chunks.front().routes.size();
+    for (const auto& chunk : chunks) {
+        TT_FATAL(chunk.routes.size() == route_count, "{} chunks have inconsistent route counts", label);
+    }
+    return route_count;
+}
+
+inline void check_capacity(const std::span<uint32_t> words, const size_t required, const char* label) {
+    TT_FATAL(words.size() >= required, "{} upload buffer holds {} words, {} required", label, words.size(), required);
+}
+
+// The page of chunk `chunk_index`, written at `page_index` of an LWT chunk
+// config buffer.
+inline void write_lwt_chunk_page(
+    const LwtExecutionPlan& plan, const size_t chunk_index, const size_t page_index, const std::span<uint32_t> words) {
+    const auto& chunk = plan.chunks[chunk_index];
+    const std::span<uint32_t> page = words.subspan(
+        page_index * device_protocol::kLwtChunkConfigWordCount, device_protocol::kLwtChunkConfigWordCount);
+    page[device_protocol::kLwtInitialEvenBegin] = checked_u32(chunk.initial_even.begin, "initial even begin");
+    page[device_protocol::kLwtInitialEvenLength] = checked_u32(chunk.initial_even.length(), "initial even length");
+    page[device_protocol::kLwtInitialOddBegin] = checked_u32(chunk.initial_odd.begin, "initial odd begin");
+    page[device_protocol::kLwtInitialOddLength] = checked_u32(chunk.initial_odd.length(), "initial odd length");
+    page[device_protocol::kLwtChunkFlags] = chunk.interior ? device_protocol::kLwtChunkFlagInterior : 0U;
+}
+
+// The `route_count` route pages of one chunk, written from page
+// `page_index * route_count`. Tile mirror validity is tracked per chunk, so
+// each chunk's pages are independent of the others.
+inline void write_lwt_route_pages(
+    const LwtExecutionPlan& plan,
+    const size_t chunk_index,
+    const size_t page_index,
+    const size_t route_count,
+    const LwtConfigAddresses& addresses,
+    const std::span<uint32_t> words) {
+    const auto resolve_output = [&](const RouteOutputRef output_ref) -> uint32_t {
+        switch (output_ref.storage) {
+            case RouteOutputStorage::kWorkspaceSlot: return addresses.at(output_ref.slot);
+            case RouteOutputStorage::kFinalEvenDram: return addresses.final_even;
+            case RouteOutputStorage::kFinalOddDram: return addresses.final_odd;
+        }
+        TT_THROW("Unsupported LWT output storage");
+    };
+
+    const auto& chunk = plan.chunks[chunk_index];
+    const size_t group_elements = plan.page_geometry.group_output_elements();
+    std::array<bool, 3> tile_mirror_valid{};
+    for (size_t route_index = 0; route_index < route_count; ++route_index) {
+        const LwtStepRoute route = plan.route_table.at(chunk.routes, route_index);
+        const uint32_t output_offset = checked_u32(route.output_offset_elements, "LWT output offset");
+        const std::span<uint32_t> page = words.subspan(
+            (page_index * route_count + route_index) * device_protocol::kRouteConfigWordCount,
+            device_protocol::kRouteConfigWordCount);
+        page[device_protocol::kRouteType] = static_cast<uint32_t>(route.type);
+        page[device_protocol::kRouteSourceAddr] = addresses.at(route.source.slot);
+        page[device_protocol::kRouteSourceLength] = checked_u32(route.source_storage_length, "LWT source storage end");
+        page[device_protocol::kRouteBaseAddr] = addresses.at(route.base.slot);
+        page[device_protocol::kRouteBaseLength] = checked_u32(route.base_storage_length, "LWT base storage end");
+        page[device_protocol::kRouteOutputAddr] = resolve_output(route.output);
+        page[device_protocol::kRouteOutputLength] = checked_u32(route.output_length, "LWT output length");
+        page[device_protocol::kRouteSourceOffset] = checked_u32(route.source_offset_elements, "LWT source offset");
+        page[device_protocol::kRouteBaseOffset] = checked_u32(route.base_offset_elements, "LWT base offset");
+        page[device_protocol::kRouteSourceLeftPad] = route.source_left_pad_elements;
+        page[device_protocol::kRouteOutputOffset] = output_offset;
+        page[device_protocol::kRouteGroupCount] = group_count(route.output_length, group_elements);
+        uint32_t route_flags =
+            route.output.storage == RouteOutputStorage::kWorkspaceSlot ? 0U : device_protocol::kRouteFlagFinalDram;
+        route_flags |= tile_mirror_valid[static_cast<size_t>(route.source.slot)]
+                           ? device_protocol::kRouteFlagSourceTileMirror
+                           : 0U;
+        route_flags |=
+            tile_mirror_valid[static_cast<size_t>(route.base.slot)] ? device_protocol::kRouteFlagBaseTileMirror : 0U;
+        if (route.output.storage == RouteOutputStorage::kWorkspaceSlot) {
+            const bool produces_tile_mirror = output_offset % group_elements == 0;
+            route_flags |= produces_tile_mirror ? device_protocol::kRouteFlagOutputTileMirror : 0U;
+            tile_mirror_valid[static_cast<size_t>(route.output.slot)] = produces_tile_mirror;
+        }
+        page[device_protocol::kRouteFlags] = route_flags;
+    }
+}
+
+}  // namespace config_detail
+
+// Exact word counts match the DRAM config buffers: one page per chunk and one
+// page per (chunk, route) pair, with a single zero page for an empty plan.
+[[nodiscard]] inline size_t lwt_chunk_config_word_count(const LwtExecutionPlan& plan) noexcept {
+    return std::max(plan.chunks.size(), size_t{1}) * device_protocol::kLwtChunkConfigWordCount;
+}
+
+[[nodiscard]] inline size_t lwt_route_config_word_count(const LwtExecutionPlan& plan) {
+    const size_t route_count = config_detail::uniform_route_count(plan.chunks, "LWT");
+    return std::max(plan.chunks.size() * route_count, size_t{1}) * device_protocol::kRouteConfigWordCount;
+}
+
+[[nodiscard]] inline size_t ilwt_chunk_config_word_count(const IlwtExecutionPlan& plan) noexcept {
+    return std::max(plan.chunks.size(), size_t{1}) * device_protocol::kLwtChunkConfigWordCount;
+}
+
+[[nodiscard]] inline size_t ilwt_route_config_word_count(const IlwtExecutionPlan& plan) {
+    const size_t route_count = config_detail::uniform_route_count(plan.chunks, "ILWT");
+    return std::max(plan.chunks.size() * route_count, size_t{1}) * device_protocol::kRouteConfigWordCount;
+}
+
+[[nodiscard]] inline size_t extension_config_word_count(const ExtensionTableKey& key) noexcept {
+    return size_t{device_protocol::extension_config_page_count(key.left + key.right)} *
+           device_protocol::kExtensionConfigWordCount;
+}
+
+// Halo table of the whole signal a forward LWT executable reads.
+[[nodiscard]] inline ExtensionTableKey lwt_extension_table_key(const LwtExecutionPlan& plan) {
+    return extension_table_key(plan.full_plan, plan.full_plan.preprocess_layout.input.length);
+}
+
+// Chunk pages, route pages and, for LWT, extension pages: the size of one
+// contiguous staging buffer that serves every DRAM config upload of an
+// executable.
+[[nodiscard]] inline size_t lwt_config_upload_word_count(const LwtExecutionPlan& plan) {
+    return lwt_chunk_config_word_count(plan) + lwt_route_config_word_count(plan) +
+           extension_config_word_count(lwt_extension_table_key(plan));
+}
+
+[[nodiscard]] inline size_t ilwt_config_upload_word_count(const IlwtExecutionPlan& plan) {
+    return ilwt_chunk_config_word_count(plan) + ilwt_route_config_word_count(plan);
+}
+
+/**
+ * @brief Streams LWT chunk pages into a caller-owned buffer.
+ *
+ * Exactly `lwt_chunk_config_word_count(plan)` words are written; unused page
+ * words are zeroed so the buffer may be recycled between executables. Page p
+ * holds chunk `chunk_at_page(chunk_order, p)`.
+ *
+ * @return The written prefix of `words`.
+ */
+inline std::span<uint32_t> write_lwt_chunk_config_words(
+    const LwtExecutionPlan& plan, const std::span<uint32_t> words, const std::span<const uint32_t> chunk_order = {}) {
+    const size_t word_count = lwt_chunk_config_word_count(plan);
+    config_detail::check_capacity(words, word_count, "LWT chunk config");
+    validate_chunk_page_order(chunk_order, plan.chunks.size());
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t page_index = 0; page_index < plan.chunks.size(); ++page_index) {
+        config_detail::write_lwt_chunk_page(plan, chunk_at_page(chunk_order, page_index), page_index, output);
+    }
+    return output;
+}
+
+inline std::span<uint32_t> write_lwt_route_config_words(
+    const LwtExecutionPlan& plan,
+    const LwtConfigAddresses& addresses,
+    const std::span<uint32_t> words,
+    const std::span<const uint32_t> chunk_order = {}) {
+    const size_t route_count = config_detail::uniform_route_count(plan.chunks, "LWT");
+    const size_t word_count = lwt_route_config_word_count(plan);
+    config_detail::check_capacity(words, word_count, "LWT route config");
+    validate_chunk_page_order(chunk_order, plan.chunks.size());
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t page_index = 0; page_index < plan.chunks.size(); ++page_index) {
+        config_detail::write_lwt_route_pages(
+            plan, chunk_at_page(chunk_order, page_index), page_index, route_count, addresses, output);
+    }
+    return output;
+}
+
+/**
+ * @brief Streams the halo entries of `table` into a caller-owned buffer.
+ *
+ * Exactly `extension_config_word_count(table.key)` words are written, left
+ * halo first. The device reader evaluates entry p for padded index p before
+ * the signal and entry p - length after it, as gather_from_extension_table
+ * does on the host.
+ *
+ * @return The written prefix of `words`.
+ */
+inline std::span<uint32_t> write_extension_config_words(
+    const ExtensionGatherTable& table, const std::span<uint32_t> words) {
+    const size_t word_count = extension_config_word_count(table.key);
+    config_detail::check_capacity(words, word_count, "Extension config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    size_t entry_index = 0;
+    const auto write_entry = [&](const ExtensionGatherEntry& entry) {
+        const std::span<uint32_t> entry_words = output.subspan(
+            entry_index++ * device_protocol::kExtensionEntryWordCount, device_protocol::kExtensionEntryWordCount);
+        entry_words[device_protocol::kExtensionSourceIndex] = entry.source_index;
+        entry_words[device_protocol::kExtensionAuxiliaryIndex] = entry.auxiliary_index;
+        entry_words[device_protocol::kExtensionScale] = std::bit_cast<uint32_t>(entry.scale);
+        entry_words[device_protocol::kExtensionOperation] =
+            static_cast<uint32_t>(entry.operation) | (entry.reflected ? device_protocol::kExtensionFlagReflected : 0U);
+    };
+    for (const ExtensionGatherEntry& entry : table.left_halo) {
+        write_entry(entry);
+    }
+    for (const ExtensionGatherEntry& entry : table.right_halo) {
+        write_entry(entry);
+    }
+    return output;
+}
+
+/**
+ * @brief Rewrites the LWT pages a replan changed in the previous upload buffers.
+ *
+ * `chunk_words` and `route_words` hold the pages of the plan `delta` was
+ * computed against. Pages of reused chunks are left as they are; pages of
+ * changed chunks are rewritten for `plan`, and pages past its last chunk are
+ * zeroed. A full rebuild rewrites everything. Pages are in plan order; an
+ * upload permuted by a chunk page order is rewritten in full instead.
+ *
+ * @return The chunk and route words to upload again.
+ */
+inline std::pair<std::span<uint32_t>, std::span<uint32_t>> write_lwt_config_delta_words(
+    const LwtExecutionPlan& plan,
+    const LwtPlanDelta& delta,
+    const LwtConfigAddresses& addresses,
+    const std::span<uint32_t> chunk_words,
+    const std::span<uint32_t> route_words) {
+    if (delta.full_rebuild || delta.first_changed_chunk == 0) {
+        return {
+            write_lwt_chunk_config_words(plan, chunk_words),
+            write_lwt_route_config_words(plan, addresses, route_words),
+        };
+    }
+    const size_t route_count = config_detail::uniform_route_count(plan.chunks, "LWT");
+    TT_FATAL(
+        route_count == delta.route_count && plan.chunks.size() == delta.chunk_count,
+        "LWT config delta does not describe this plan");
+    const size_t chunk_word_count = lwt_chunk_config_word_count(plan);
+    const size_t route_word_count = lwt_route_config_word_count(plan);
+    config_detail::check_capacity(chunk_words, chunk_word_count, "LWT chunk config");
+    config_detail::check_capacity(route_words, route_word_count, "LWT route config");
+
+    // Stale pages of dropped chunks are cleared along with the changed ones.
+    const size_t stale_chunks = std::max(delta.chunk_count, delta.previous_chunk_count);
+    const size_t chunk_begin = delta.first_changed_chunk * device_protocol::kLwtChunkConfigWordCount;
+    const size_t route_begin = delta.first_changed_chunk * route_count * device_protocol::kRouteConfigWordCount;
+    const std::span<uint32_t> changed_chunk_words = chunk_words.subspan(
+        chunk_begin,
+        std::min(stale_chunks * device_protocol::kLwtChunkConfigWordCount, chunk_words.size()) - chunk_begin);
+    const std::span<uint32_t> changed_route_words = route_words.subspan(
+        route_begin,
+        std::min(stale_chunks * route_count * device_protocol::kRouteConfigWordCount, route_words.size()) -
+            route_begin);
+    std::fill(changed_chunk_words.begin(), changed_chunk_words.end(), 0U);
+    std::fill(changed_route_words.begin(), changed_route_words.end(), 0U);
+    for (size_t chunk_index = delta.first_changed_chunk; chunk_index < plan.chunks.size(); ++chunk_index) {
+        config_detail::write_lwt_chunk_page(plan, chunk_index, chunk_index, chunk_words);
+        config_detail::write_lwt_route_pages(plan, chunk_index, chunk_index, route_count, addresses, route_words);
+    }
+    return {changed_chunk_words, changed_route_words};
+}
+
+inline std::span<uint32_t> write_ilwt_chunk_config_words(
+    const IlwtExecutionPlan& plan, const IlwtConfigAddresses& addresses, const std::span<uint32_t> words) {
+    const size_t word_count = ilwt_chunk_config_word_count(plan);
+    config_detail::check_capacity(words, word_count, "ILWT chunk config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
+        const auto& chunk = plan.chunks[chunk_index];
+        const std::span<uint32_t> page = output.subspan(
+            chunk_index * device_protocol::kLwtChunkConfigWordCount, device_protocol::kLwtChunkConfigWordCount);
+        page[device_protocol::kIlwtApproximationBegin] =
+            config_detail::checked_u32(chunk.canonical_approximation.begin, "ILWT approximation begin");
+        page[device_protocol::kIlwtApproximationLength] =
+            config_detail::checked_u32(chunk.canonical_approximation.length(), "ILWT approximation length");
+        page[device_protocol::kIlwtDetailBegin] =
+            config_detail::checked_u32(chunk.canonical_detail.begin, "ILWT detail begin");
+        page[device_protocol::kIlwtDetailLength] =
+            config_detail::checked_u32(chunk.canonical_detail.length(), "ILWT detail length");
+        page[device_protocol::kIlwtFinalEvenAddr] = addresses.at(chunk.final_even.slot);
+        page[device_protocol::kIlwtFinalEvenStorageLength] =
+            config_detail::checked_u32(chunk.final_even_storage_length, "ILWT final even storage length");
+        page[device_protocol::kIlwtFinalEvenOffset] =
+            config_detail::checked_u32(chunk.final_even_offset_elements, "ILWT final even offset");
+        page[device_protocol::kIlwtFinalEvenBegin] =
+            config_detail::checked_u32(chunk.reconstructed_even.begin, "ILWT final even begin");
+        page[device_protocol::kIlwtFinalOddAddr] = addresses.at(chunk.final_odd.slot);
+        page[device_protocol::kIlwtFinalOddStorageLength] =
+            config_detail::checked_u32(chunk.final_odd_storage_length, "ILWT final odd storage length");
+        page[device_protocol::kIlwtFinalOddOffset] =
+            config_detail::checked_u32(chunk.final_odd_offset_elements, "ILWT final odd offset");
+        page[device_protocol::kIlwtFinalOddBegin] =
+            config_detail::checked_u32(chunk.reconstructed_odd.begin, "ILWT final odd begin");
+        page[device_protocol::kIlwtOutputBegin] =
+            config_detail::checked_u32(chunk.output_signal.begin, "ILWT output begin");
+        page[device_protocol::kIlwtOutputLength] =
+            config_detail::checked_u32(chunk.output_signal.length(), "ILWT output length");
+    }
+    return output;
+}
+
+inline std::span<uint32_t> write_ilwt_route_config_words(
+    const IlwtExecutionPlan& plan, const IlwtConfigAddresses& addresses, const std::span<uint32_t> words) {
+    const size_t route_count = config_detail::uniform_route_count(plan.chunks, "ILWT");
+    const size_t word_count = ilwt_route_config_word_count(plan);
+    config_detail::check_capacity(words, word_count, "ILWT route config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
+        const auto& chunk = plan.chunks[chunk_index];
+        std::array<bool, 3> tile_mirror_valid{};
+        for (size_t route_index = 0; route_index < route_count; ++route_index) {
+            const LwtStepRoute route = plan.route_table.at(chunk.routes, route_index);
+            TT_FATAL(
+                route.output.storage == RouteOutputStorage::kWorkspaceSlot,
+                "ILWT intermediate route must target a local workspace slot");
+            const std::span<uint32_t> page = output.subspan(
+                (chunk_index * route_count + route_index) * device_protocol::kRouteConfigWordCount,
+                device_protocol::kRouteConfigWordCount);
+            page[device_protocol::kRouteType] = static_cast<uint32_t>(route.type);
+            page[device_protocol::kRouteSourceAddr] = addresses.at(route.source.slot);
+            page[device_protocol::kRouteSourceLength] =
+                config_detail::checked_u32(route.source_storage_length, "ILWT source storage length");
+            page[device_protocol::kRouteBaseAddr] = addresses.at(route.base.slot);
+            page[device_protocol::kRouteBaseLength] =
+                config_detail::checked_u32(route.base_storage_length, "ILWT base storage length");
+            page[device_protocol::kRouteOutputAddr] = addresses.at(route.output.slot);
+            page[device_protocol::kRouteOutputLength] =
+                config_detail::checked_u32(route.output_length, "ILWT output length");
+            page[device_protocol::kRouteSourceOffset] =
+                config_detail::checked_u32(route.source_offset_elements, "ILWT source offset");
+            page[device_protocol::kRouteBaseOffset] =
+                config_detail::checked_u32(route.base_offset_elements, "ILWT base offset");
+            page[device_protocol::kRouteSourceLeftPad] = route.source_left_pad_elements;
+            page[device_protocol::kRouteOutputOffset] = 0;
+            page[device_protocol::kRouteGroupCount] = config_detail::group_count(route.output_length);
+            uint32_t route_flags = plan.final_interleave_direct && route_index + 1 == route_count
+                                       ? device_protocol::kRouteFlagIlwtFinalInterleave
+                                       : 0U;
+            route_flags |= tile_mirror_valid[static_cast<size_t>(route.source.slot)]
+                               ? device_protocol::kRouteFlagSourceTileMirror
+                               : 0U;
+            route_flags |= tile_mirror_valid[static_cast<size_t>(route.base.slot)]
+                               ? device_protocol::kRouteFlagBaseTileMirror
+                               : 0U;
+            route_flags |= device_protocol::kRouteFlagOutputTileMirror;
+            tile_mirror_valid[static_cast<size_t>(route.output.slot)] = true;
+            page[device_protocol::kRouteFlags] = route_flags;
+        }
+    }
+    return output;
+}
+
+[[nodiscard]] inline size_t lwt_batch_work_config_word_count(const LwtMixedBatchPlan& batch) noexcept {
+    return std::max(batch.work.size(), size_t{1}) * device_protocol::kLwtBatchWorkConfigWordCount;
+}
+
+[[nodiscard]] inline size_t lwt_batch_chunk_config_word_count(const LwtMixedBatchPlan& batch) noexcept {
+    return std::max(batch.chunk_page_begin.back(), size_t{1}) * device_protocol::kLwtChunkConfigWordCount;
+}
+
+[[nodiscard]] inline size_t lwt_batch_route_config_word_count(const LwtMixedBatchPlan& batch) noexcept {
+    return std::max(batch.route_page_begin.back(), size_t{1}) * device_protocol::kRouteConfigWordCount;
+}
+
+[[nodiscard]] inline size_t lwt_batch_coefficient_config_word_count(const LwtMixedBatchPlan& batch) noexcept {
+    return std::max(batch.coefficient_page_begin.back(), size_t{1}) * device_protocol::kLwtCoefficientConfigWordCount;
+}
+
+/**
+ * @brief Streams one work page per scheduled chunk of a mixed-scheme batch.
+ *
+ * Pages follow `batch.work`, so core slot s reads pages
+ * [slots[s].begin, slots[s].begin + slots[s].count). Each page names the
+ * item's chunk, route and coefficient pages and its input signal.
+ */
+inline std::span<uint32_t> write_lwt_batch_work_config_words(
+    const LwtMixedBatchPlan& batch,
+    const std::span<const LwtBatchItemAddresses> item_addresses,
+    const std::span<uint32_t> words) {
+    using config_detail::checked_u32;
+    TT_FATAL(
+        item_addresses.size() == batch.item_count(),
+        "Mixed LWT batch of {} items received {} address sets",
+        batch.item_count(),
+        item_addresses.size());
+    const size_t word_count = lwt_batch_work_config_word_count(batch);
+    config_detail::check_capacity(words, word_count, "LWT batch work config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t index = 0; index < batch.work.size(); ++index) {
+        const LwtBatchWork& work = batch.work[index];
+        const LiftingForwardPlan& full_plan = batch.plans[work.item].full_plan;
+        const size_t route_count = batch.coefficients[work.item].size();
+        const std::span<uint32_t> page = output.subspan(
+            index * device_protocol::kLwtBatchWorkConfigWordCount, device_protocol::kLwtBatchWorkConfigWordCount);
+        page[device_protocol::kLwtBatchWorkItem] = work.item;
+        page[device_protocol::kLwtBatchWorkChunk] = work.chunk;
+        page[device_protocol::kLwtBatchWorkChunkPage] =
+            checked_u32(batch.chunk_page_begin[work.item] + work.chunk, "LWT batch chunk page");
+        page[device_protocol::kLwtBatchWorkRoutePage] =
+            checked_u32(batch.route_page_begin[work.item] + work.chunk * route_count, "LWT batch route page");
+        page[device_protocol::kLwtBatchWorkRouteCount] = checked_u32(route_count, "LWT batch route count");
+        page[device_protocol::kLwtBatchWorkCoefficientPage] =
+            checked_u32(batch.coefficient_page_begin[work.item], "LWT batch coefficient page");
+        page[device_protocol::kLwtBatchWorkInputAddr] = item_addresses[work.item].input;
+        page[device_protocol::kLwtBatchWorkInputLength] =
+            checked_u32(full_plan.preprocess_layout.input.length, "LWT batch input length");
+        page[device_protocol::kLwtBatchWorkBoundaryMode] =
+            static_cast<uint32_t>(full_plan.preprocess_layout.pad_config.mode);
+        page[device_protocol::kLwtBatchWorkInputLeftPad] = full_plan.preprocess_layout.pad_config.left;
+    }
+    return output;
+}
+
+inline std::span<uint32_t> write_lwt_batch_chunk_config_words(
+    const LwtMixedBatchPlan& batch, const std::span<uint32_t> words) {
+    const size_t word_count = lwt_batch_chunk_config_word_count(batch);
+    config_detail::check_capacity(words, word_count, "LWT batch chunk config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t item = 0; item < batch.item_count(); ++item) {
+        const std::span<uint32_t> item_words =
+            output.subspan(batch.chunk_page_begin[item] * device_protocol::kLwtChunkConfigWordCount);
+        for (size_t chunk_index = 0; chunk_index < batch.plans[item].chunks.size(); ++chunk_index) {
+            config_detail::write_lwt_chunk_page(batch.plans[item], chunk_index, chunk_index, item_words);
+        }
+    }
+    return output;
+}
+
+inline std::span<uint32_t> write_lwt_batch_route_config_words(
+    const LwtMixedBatchPlan& batch,
+    const std::array<uint32_t, 3>& slots,
+    const std::span<const LwtBatchItemAddresses> item_addresses,
+    const std::span<uint32_t> words) {
+    TT_FATAL(
+        item_addresses.size() == batch.item_count(),
+        "Mixed LWT batch of {} items received {} address sets",
+        batch.item_count(),
+        item_addresses.size());
+    const size_t word_count = lwt_batch_route_config_word_count(batch);
+    config_detail::check_capacity(words, word_count, "LWT batch route config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t item = 0; item < batch.item_count(); ++item) {
+        const LwtConfigAddresses addresses{
+            .slots = slots,
+            .final_even = item_addresses[item].final_even,
+            .final_odd = item_addresses[item].final_odd,
+        };
+        const std::span<uint32_t> item_words =
+            output.subspan(batch.route_page_begin[item] * device_protocol::kRouteConfigWordCount);
+        const size_t route_count = batch.coefficients[item].size();
+        for (size_t chunk_index = 0; chunk_index < batch.plans[item].chunks.size(); ++chunk_index) {
+            config_detail::write_lwt_route_pages(
+                batch.plans[item], chunk_index, chunk_index, route_count, addresses, item_words);
+        }
+    }
+    return output;
+}
+
+/**
+ * @brief Streams the runtime coefficient pages of a mixed-scheme batch.
+ *
+ * One page per (item, route), holding the step type, the tap count, the
+ * folded terminal scale and the taps as FP32 bit patterns.
+ */
+inline std::span<uint32_t> write_lwt_batch_coefficient_config_words(
+    const LwtMixedBatchPlan& batch, const std::span<uint32_t> words) {
+    const size_t word_count = lwt_batch_coefficient_config_word_count(batch);
+    config_detail::check_capacity(words, word_count, "LWT batch coefficient config");
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    for (size_t item = 0; item < batch.item_count(); ++item) {
+        const std::vector<HostRouteCoefficients>& routes = batch.coefficients[item];
+        for (size_t route_index = 0; route_index < routes.size(); ++route_index) {
+            const HostRouteCoefficients& route = routes[route_index];
+            const std::span<uint32_t> page = output.subspan(
+                (batch.coefficient_page_begin[item] + route_index) * device_protocol::kLwtCoefficientConfigWordCount,
+                device_protocol::kLwtCoefficientConfigWordCount);
+            page[device_protocol::kLwtCoefficientStepType] = static_cast<uint32_t>(route.type);
+            page[device_protocol::kLwtCoefficientTapCount] = route.k;
+            page[device_protocol::kLwtCoefficientOutputScale] = std::bit_cast<uint32_t>(route.output_scale);
+            for (size_t tap = 0; tap < route.coefficients.size(); ++tap) {
+                page[device_protocol::kLwtCoefficientFirst + tap] = std::bit_cast<uint32_t>(route.coefficients[tap]);
+            }
+        }
+    }
+    return output;
+}
+
+/**
+ * @brief Decodes `route_count` coefficient pages starting at `first_page`.
+ *
+ * The inverse of write_lwt_batch_coefficient_config_words for one item, as a
+ * core reads its item's routes.
+ */
+[[nodiscard]] inline std::vector<HostRouteCoefficients> read_lwt_coefficient_config_words(
+    const std::span<const uint32_t> words, const size_t first_page, const size_t route_count) {
+    TT_FATAL(
+        (first_page + route_count) * device_protocol::kLwtCoefficientConfigWordCount <= words.size(),
+        "LWT coefficient pages [{}, {}) exceed {} words",
+        first_page,
+        first_page + route_count,
+        words.size());
+    std::vector<HostRouteCoefficients> routes(route_count);
+    for (size_t route_index = 0; route_index < route_count; ++route_index) {
+        const std::span<const uint32_t> page = words.subspan(
+            (first_page + route_index) * device_protocol::kLwtCoefficientConfigWordCount,
+            device_protocol::kLwtCoefficientConfigWordCount);
+        HostRouteCoefficients& route = routes[route_index];
+        route.type = static_cast<StepType>(page[device_protocol::kLwtCoefficientStepType]);
+        route.k = page[device_protocol::kLwtCoefficientTapCount];
+        route.output_scale = std::bit_cast<float>(page[device_protocol::kLwtCoefficientOutputScale]);
+        for (size_t tap = 0; tap < route.coefficients.size(); ++tap) {
+            route.coefficients[tap] = std::bit_cast<float>(page[device_protocol::kLwtCoefficientFirst + tap]);
+        }
+        route.palindromic = has_palindromic_taps(route);
+    }
+    return routes;
+}
+
+// Allocating wrappers for host tools and tests that do not own an upload
+// buffer.  Device upload paths write into the executable staging buffer.
+[[nodiscard]] inline std::vector<uint32_t> build_lwt_chunk_config_words(const LwtExecutionPlan& plan) {
+    std::vector<uint32_t> words(lwt_chunk_config_word_count(plan));
+    write_lwt_chunk_config_words(plan, words);
+    return words;
+}
+
+[[nodiscard]] inline std::vector<uint32_t> build_lwt_route_config_words(
+    const LwtExecutionPlan& plan, const LwtConfigAddresses& addresses) {
+    std::vector<uint32_t> words(lwt_route_config_word_count(plan));
+    write_lwt_route_config_words(plan, addresses, words);
+    return words;
+}
+
+[[nodiscard]] inline std::vector<uint32_t> build_extension_config_words(const ExtensionGatherTable& table) {
+    std::vector<uint32_t> words(extension_config_word_count(table.key));
+    write_extension_config_words(table, words);
+    return words;
+}
+
+[[nodiscard]] inline std::vector<uint32_t> build_ilwt_chunk_config_words(
+    const IlwtExecutionPlan& plan, const IlwtConfigAddresses& addresses) {
+    std::vector<uint32_t> words(ilwt_chunk_config_word_count(plan));
+    write_ilwt_chunk_config_words(plan, addresses, words);
+    return words;
+}
+
+[[nodiscard]] inline std::vector<uint32_t> build_ilwt_route_config_words(
+    const IlwtExecutionPlan& plan, const IlwtConfigAddresses& addresses) {
+    std::vector<uint32_t> words(ilwt_route_config_word_count(plan));
+    write_ilwt_route_config_words(plan, addresses, words);
+    return words;
+}
+
+}  // namespace ttwv
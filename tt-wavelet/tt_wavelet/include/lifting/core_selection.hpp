@@ -0,0 +1,546 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/constants.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/common/tiling_2d.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan.hpp"
+#include "tt_wavelet/include/lifting/plan_2d.hpp"
+
+namespace ttwv {
+
+struct NocCoordinate {
+    uint32_t x{0};
+    uint32_t y{0};
+
+    friend constexpr bool operator==(const NocCoordinate&, const NocCoordinate&) = default;
+};
+
+/**
+ * Host description of one worker grid for core selection.
+ *
+ * Logical worker (x, y) sits at physical NoC coordinate
+ * (worker_columns[x], worker_rows[y]). Harvested rows or columns are simply
+ * absent from those lists. dram_bank_endpoints lists the NoC endpoint that
+ * serves each interleaved DRAM bank, in bank order: interleaved page p lives
+ * in bank p % dram_bank_endpoints.size().
+ */
+struct WorkerGridTopology {
+    const char* name{""};
+    uint32_t noc_width{0};
+    uint32_t noc_height{0};
+    std::vector<uint32_t> worker_columns;
+    std::vector<uint32_t> worker_rows;
+    std::vector<NocCoordinate> dram_bank_endpoints;
+
+    [[nodiscard]] uint32_t logical_width() const noexcept { return static_cast<uint32_t>(worker_columns.size()); }
+    [[nodiscard]] uint32_t logical_height() const noexcept { return static_cast<uint32_t>(worker_rows.size()); }
+    [[nodiscard]] uint32_t bank_count() const noexcept { return static_cast<uint32_t>(dram_bank_endpoints.size()); }
+
+    [[nodiscard]] NocCoordinate physical(const NocCoordinate logical) const {
+        TT_FATAL(
+            logical.x < worker_columns.size() && logical.y < worker_rows.size(),
+            "Logical worker ({}, {}) is outside the {} grid",
+            logical.x,
+            logical.y,
+            name);
+        return NocCoordinate{.x = worker_columns[logical.x], .y = worker_rows[logical.y]};
+    }
+};
+
+/**
+ * DRAM pages read by one chunk or core slot, counted per interleaved bank.
+ *
+ * As slot demand, entry s of a vector describes the s-th entry of the
+ * selected core vector, which owns the s-th contiguous work range of
+ * partition_core_slot_work.
+ */
+struct DramBankHistogram {
+    std::vector<uint64_t> pages_per_bank;
+
+    [[nodiscard]] uint64_t total_pages() const noexcept {
+        return std::accumulate(pages_per_bank.begin(), pages_per_bank.end(), uint64_t{0});
+    }
+};
+
+struct CoreSelection {
+    std::vector<NocCoordinate> cores;
+    uint64_t modeled_hops{0};
+    uint64_t first_n_modeled_hops{0};
+};
+
+struct CoreSlotWork {
+    uint32_t begin{0};
+    uint32_t count{0};
+};
+
+namespace core_selection_detail {
+
+[[nodiscard]] inline std::vector<uint32_t> worker_axis(
+    const std::initializer_list<uint32_t> physical, const uint32_t harvested_mask) {
+    std::vector<uint32_t> axis;
+    axis.reserve(physical.size());
+    uint32_t index = 0;
+    for (const uint32_t coordinate : physical) {
+        if ((harvested_mask & (1U << index++)) == 0) {
+            axis.push_back(coordinate);
+        }
+    }
+    return axis;
+}
+
+[[nodiscard]] constexpr uint32_t torus_distance(const uint32_t from, const uint32_t to, const uint32_t size) noexcept {
+    const uint32_t forward = to >= from ? to - from : to + size - from;
+    return std::min(forward, size - forward);
+}
+
+// Both NoCs are unidirectional tori running in opposite directions, so the
+// shorter of the two routes bounds the hop count of a read.
+[[nodiscard]] inline uint32_t noc_hops(
+    const WorkerGridTopology& topology, const NocCoordinate from, const NocCoordinate to) noexcept {
+    return torus_distance(from.x, to.x, topology.noc_width) + torus_distance(from.y, to.y, topology.noc_height);
+}
+
+[[nodiscard]] inline uint64_t slot_cost(
+    const WorkerGridTopology& topology, const DramBankHistogram& demand, const NocCoordinate physical) {
+    uint64_t hops = 0;
+    for (uint32_t bank = 0; bank < demand.pages_per_bank.size(); ++bank) {
+        hops += demand.pages_per_bank[bank] * noc_hops(topology, physical, topology.dram_bank_endpoints[bank]);
+    }
+    return hops;
+}
+
+inline void add_page_range(
+    DramBankHistogram& demand, const uint64_t first_page, const uint64_t page_count, const uint32_t bank_count) {
+    const uint64_t full_rounds = page_count / bank_count;
+    for (uint32_t bank = 0; bank < bank_count; ++bank) {
+        demand.pages_per_bank[bank] += full_rounds;
+    }
+    for (uint64_t page = first_page + full_rounds * bank_count; page < first_page + page_count; ++page) {
+        ++demand.pages_per_bank[page % bank_count];
+    }
+}
+
+// Raw input samples covered by the even/odd initial cones of one axis,
+// clamped to the signal; extension reads fold back onto the edge pages.
+[[nodiscard]] inline IndexInterval raw_axis_cone(
+    const IndexInterval initial_even, const IndexInterval initial_odd, const size_t left_pad, const size_t length) {
+    size_t begin = std::numeric_limits<size_t>::max();
+    size_t end = 0;
+    if (!initial_even.empty()) {
+        begin = std::min(begin, 2 * initial_even.begin);
+        end = std::max(end, 2 * initial_even.end - 1);
+    }
+    if (!initial_odd.empty()) {
+        begin = std::min(begin, 2 * initial_odd.begin + 1);
+        end = std::max(end, 2 * initial_odd.end);
+    }
+    if (begin >= end) {
+        return {};
+    }
+    const size_t raw_begin = std::clamp(begin, left_pad, left_pad + length - 1) - left_pad;
+    const size_t raw_end = std::clamp(end, left_pad + 1, left_pad + length) - left_pad;
+    return IndexInterval{.begin = raw_begin, .end = std::max(raw_end, raw_begin + 1)};
+}
+
+}  // namespace core_selection_detail
+
+/**
+ * Wormhole B0: a 10x12 NoC with Tensix columns 1-4 and 6-9 and rows 1-5 and
+ * 7-11. The twelve interleaved DRAM banks are two per channel and use the
+ * channel's preferred worker endpoint. Bit i of `harvested_row_mask` removes
+ * logical row i. This and the Blackhole table describe synthetic planner
+ * grids; an open device reports its own topology.
+ */
+[[nodiscard]] inline WorkerGridTopology make_wormhole_b0_topology(const uint32_t harvested_row_mask = 0) {
+    constexpr NocCoordinate kChannelEndpoints[] = {{0, 1}, {0, 6}, {5, 1}, {5, 9}, {5, 4}, {5, 6}};
+    WorkerGridTopology topology{
+        .name = "wormhole_b0",
+        .noc_width = 10,
+        .noc_height = 12,
+        .worker_columns = {1, 2, 3, 4, 6, 7, 8, 9},
+        .worker_rows = core_selection_detail::worker_axis({1, 2, 3, 4, 5, 7, 8, 9, 10, 11}, harvested_row_mask),
+        .dram_bank_endpoints = {},
+    };
+    for (const NocCoordinate endpoint : kChannelEndpoints) {
+        topology.dram_bank_endpoints.push_back(endpoint);
+        topology.dram_bank_endpoints.push_back(endpoint);
+    }
+    return topology;
+}
+
+/**
+ * Blackhole: a 17x12 NoC with Tensix columns 1-7 and 10-16 and rows 2-11.
+ * DRAM columns 0 and 9 each host four channels with one interleaved bank per
+ * channel. Bit i of `harvested_column_mask` removes logical column i.
+ */
+[[nodiscard]] inline WorkerGridTopology make_blackhole_topology(const uint32_t harvested_column_mask = 0) {
+    return WorkerGridTopology{
+        .name = "blackhole",
+        .noc_width = 17,
+        .noc_height = 12,
+        .worker_columns = core_selection_detail::worker_axis(
+            {1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 16}, harvested_column_mask),
+        .worker_rows = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+        .dram_bank_endpoints = {{0, 1}, {0, 3}, {0, 8}, {0, 6}, {9, 1}, {9, 3}, {9, 8}, {9, 6}},
+    };
+}
+
+/**
+ * Topology reported by a device: the NoC coordinate of each logical worker
+ * column and row and of each interleaved DRAM bank. Translated coordinates
+ * may lie past the reported NoC size, so the torus is widened to cover every
+ * coordinate.
+ */
+[[nodiscard]] inline WorkerGridTopology make_worker_grid_topology(
+    const char* name,
+    const uint32_t noc_width,
+    const uint32_t noc_height,
+    std::vector<uint32_t> worker_columns,
+    std::vector<uint32_t> worker_rows,
+    std::vector<NocCoordinate> dram_bank_endpoints) {
+    TT_FATAL(
+        !worker_columns.empty() && !worker_rows.empty() && !dram_bank_endpoints.empty(),
+        "The {} topology needs worker columns, worker rows, and DRAM banks",
+        name);
+    WorkerGridTopology topology{
+        .name = name,
+        .noc_width = noc_width,
+        .noc_height = noc_height,
+        .worker_columns = std::move(worker_columns),
+        .worker_rows = std::move(worker_rows),
+        .dram_bank_endpoints = std::move(dram_bank_endpoints),
+    };
+    for (const uint32_t column : topology.worker_columns) {
+        topology.noc_width = std::max(topology.noc_width, column + 1);
+    }
+    for (const uint32_t row : topology.worker_rows) {
+        topology.noc_height = std::max(topology.noc_height, row + 1);
+    }
+    for (const NocCoordinate endpoint : topology.dram_bank_endpoints) {
+        topology.noc_width = std::max(topology.noc_width, endpoint.x + 1);
+        topology.noc_height = std::max(topology.noc_height, endpoint.y + 1);
+    }
+    return topology;
+}
+
+/**
+ * Restrict `topology` to the first `width` x `height` logical workers of a
+ * synthetic grid.
+ */
+[[nodiscard]] inline WorkerGridTopology crop_worker_grid(
+    WorkerGridTopology topology, const uint32_t width, const uint32_t height) {
+    TT_FATAL(
+        width > 0 && height > 0 && width <= topology.logical_width() && height <= topology.logical_height(),
+        "Worker grid {}x{} does not fit the {} topology",
+        width,
+        height,
+        topology.name);
+    topology.worker_columns.resize(width);
+    topology.worker_rows.resize(height);
+    return topology;
+}
+
+/**
+ * Contiguous, balanced work ranges: the first total % slots slots take one
+ * extra item. This is the partition the device programs use.
+ */
+[[nodiscard]] constexpr CoreSlotWork partition_core_slot_work(
+    const uint32_t total_items, const uint32_t slot_count, const uint32_t slot) noexcept {
+    const uint32_t base = total_items / slot_count;
+    const uint32_t extra = total_items % slot_count;
+    return CoreSlotWork{
+        .begin = slot * base + std::min(slot, extra),
+        .count = base + (slot < extra ? 1U : 0U),
+    };
+}
+
+/**
+ * Input sticks of sample 0 read by each chunk of a 1D forward plan. The input
+ * buffer holds one stick per page; extension reads fold onto edge sticks.
+ */
+[[nodiscard]] inline std::vector<IndexInterval> lwt_chunk_input_pages(const LwtExecutionPlan& plan) {
+    const SignalBuffer& input = plan.full_plan.preprocess_layout.input;
+    std::vector<IndexInterval> pages;
+    pages.reserve(plan.chunks.size());
+    for (const LwtChunkPlan& chunk : plan.chunks) {
+        const IndexInterval raw = core_selection_detail::raw_axis_cone(
+            chunk.initial_even, chunk.initial_odd, plan.full_plan.preprocess_layout.pad_config.left, input.length);
+        pages.push_back(IndexInterval{
+            .begin = raw.begin / input.stick_width, .end = ceil_div(raw.end, static_cast<size_t>(input.stick_width))});
+    }
+    return pages;
+}
+
+/**
+ * Per-slot DRAM bank demand of a batched 1D forward plan. Work item w is
+ * the chunk at config page w % chunks of sample w / chunks, and sample b's
+ * input sticks start at page b * input_pages_per_sample.
+ */
+[[nodiscard]] inline std::vector<DramBankHistogram> make_lwt_core_slot_demand(
+    const LwtExecutionPlan& plan,
+    const uint32_t batch_count,
+    const uint32_t active_core_count,
+    const uint32_t bank_count,
+    const std::span<const uint32_t> chunk_order = {}) {
+    TT_FATAL(bank_count > 0 && active_core_count > 0, "Core slot demand requires banks and cores");
+    const uint64_t pages_per_sample = plan.full_plan.preprocess_layout.input.stick_count();
+    const uint32_t chunk_count = static_cast<uint32_t>(plan.chunks.size());
+
+    const std::vector<IndexInterval> chunk_pages = lwt_chunk_input_pages(plan);
+    std::vector<DramBankHistogram> demand(active_core_count);
+    const uint32_t total_items = chunk_count * batch_count;
+    for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+        demand[slot].pages_per_bank.assign(bank_count, 0);
+        const CoreSlotWork work = partition_core_slot_work(total_items, active_core_count, slot);
+        for (uint32_t item = work.begin; item < work.begin + work.count; ++item) {
+            const IndexInterval pages = chunk_pages[chunk_at_page(chunk_order, item % chunk_count)];
+            core_selection_detail::add_page_range(
+                demand[slot], (item / chunk_count) * pages_per_sample + pages.begin, pages.length(), bank_count);
+        }
+    }
+    return demand;
+}
+
+/**
+ * Per-slot DRAM bank demand of a batched 1D inverse plan. The approximation
+ * and detail buffers are separate interleaved buffers, so both start at
+ * bank 0.
+ */
+[[nodiscard]] inline std::vector<DramBankHistogram> make_ilwt_core_slot_demand(
+    const IlwtExecutionPlan& plan,
+    const uint32_t batch_count,
+    const uint32_t active_core_count,
+    const uint32_t bank_count) {
+    TT_FATAL(bank_count > 0 && active_core_count > 0, "Core slot demand requires banks and cores");
+    const uint64_t pages_per_sample = SignalBuffer{.length = plan.full_plan.coefficient_length}.stick_count();
+    const uint32_t chunk_count = static_cast<uint32_t>(plan.chunks.size());
+    const size_t period = ilwt_coefficient_period(plan.full_plan);
+
+    std::vector<DramBankHistogram> demand(active_core_count);
+    const uint32_t total_items = chunk_count * batch_count;
+    for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+        demand[slot].pages_per_bank.assign(bank_count, 0);
+        const CoreSlotWork work = partition_core_slot_work(total_items, active_core_count, slot);
+        for (uint32_t item = work.begin; item < work.begin + work.count; ++item) {
+            const IlwtChunkPlan& chunk = plan.chunks[item % chunk_count];
+            const uint64_t sample_base = (item / chunk_count) * pages_per_sample;
+            for (const IndexInterval coefficients : {chunk.canonical_approximation, chunk.canonical_detail}) {
+                if (coefficients.empty()) {
+                    continue;
+                }
+                // Periodization windows may run past the period; the tail
+                // rereads the band from its start.
+                const IndexInterval head{.begin = coefficients.begin, .end = std::min(coefficients.end, period)};
+                const IndexInterval tail{.begin = 0, .end = std::min(coefficients.end - head.end, period)};
+                for (const IndexInterval pages : {head, tail}) {
+                    if (pages.empty()) {
+                        continue;
+                    }
+                    const size_t first_page = pages.begin / kStickWidth;
+                    core_selection_detail::add_page_range(
+                        demand[slot],
+                        sample_base + first_page,
+                        ceil_div(pages.end, size_t{kStickWidth}) - first_page,
+                        bank_count);
+                }
+            }
+        }
+    }
+    return demand;
+}
+
+/**
+ * Input tile rows and columns read by each chunk of a 2D forward plan.
+ */
+[[nodiscard]] inline std::vector<IndexRectangle> lwt_2d_chunk_input_tiles(const Lwt2DExecutionPlan& plan) {
+    std::vector<IndexRectangle> tiles;
+    tiles.reserve(plan.chunks.size());
+    for (const Lwt2DChunkPlan& chunk : plan.chunks) {
+        const IndexInterval rows = core_selection_detail::raw_axis_cone(
+            chunk.y_cone.initial_even,
+            chunk.y_cone.initial_odd,
+            plan.y_plan.preprocess_layout.pad_config.left,
+            plan.input_height);
+        const IndexInterval columns = core_selection_detail::raw_axis_cone(
+            chunk.x_cone.initial_even,
+            chunk.x_cone.initial_odd,
+            plan.x_plan.preprocess_layout.pad_config.left,
+            plan.input_width);
+        tiles.push_back(IndexRectangle{
+            .y = IndexInterval{.begin = rows.begin / kTileHeight2D, .end = ceil_div(rows.end, kTileHeight2D)},
+            .x = IndexInterval{.begin = columns.begin / kTileWidth2D, .end = ceil_div(columns.end, kTileWidth2D)},
+        });
+    }
+    return tiles;
+}
+
+namespace core_selection_detail {
+
+// Row-major tile order: tile (y, x) of sample b is page
+// b * tiles_per_sample + y * tile_columns + x.
+inline void add_tile_rectangle(
+    DramBankHistogram& demand,
+    const IndexRectangle& tiles,
+    const uint64_t sample_base,
+    const size_t tile_columns,
+    const uint32_t bank_count) {
+    for (size_t row = tiles.y.begin; row < tiles.y.end; ++row) {
+        add_page_range(demand, sample_base + row * tile_columns + tiles.x.begin, tiles.x.length(), bank_count);
+    }
+}
+
+}  // namespace core_selection_detail
+
+/**
+ * Per-slot DRAM bank demand of a batched 2D forward plan, counted in input
+ * tiles of the row-major tiled input.
+ */
+[[nodiscard]] inline std::vector<DramBankHistogram> make_lwt_2d_core_slot_demand(
+    const Lwt2DExecutionPlan& plan,
+    const uint32_t batch_count,
+    const uint32_t active_core_count,
+    const uint32_t bank_count,
+    const std::span<const uint32_t> chunk_order = {}) {
+    TT_FATAL(bank_count > 0 && active_core_count > 0, "Core slot demand requires banks and cores");
+    const size_t tile_columns = plan.tiling.input.storage.width / kTileWidth2D;
+    const uint64_t tiles_per_sample =
+        static_cast<uint64_t>(plan.tiling.input.storage.height / kTileHeight2D) * tile_columns;
+    const std::vector<IndexRectangle> chunk_tiles = lwt_2d_chunk_input_tiles(plan);
+    const uint32_t chunk_count = static_cast<uint32_t>(plan.chunks.size());
+
+    std::vector<DramBankHistogram> demand(active_core_count);
+    const uint32_t total_items = chunk_count * batch_count;
+    for (uint32_t slot = 0; slot < active_core_count; ++slot) {
+        demand[slot].pages_per_bank.assign(bank_count, 0);
+        const CoreSlotWork work = partition_core_slot_work(total_items, active_core_count, slot);
+        for (uint32_t item = work.begin; item < work.begin + work.count; ++item) {
+            core_selection_detail::add_tile_rectangle(
+                demand[slot],
+                chunk_tiles[chunk_at_page(chunk_order, item % chunk_count)],
+                (item / chunk_count) * tiles_per_sample,
+                tile_columns,
+                bank_count);
+        }
+    }
+    return demand;
+}
+
+/**
+ * Choose worker cores and their slot order to minimise modelled DRAM read
+ * hops.
+ *
+ * Slots are placed heaviest first on the free core closest to their banks,
+ * then pairwise swaps and moves to free cores run until no single exchange
+ * lowers the cost. The first-N row-major grid is the fallback whenever it is
+ * not worse, so the result never models more hops than the old selection.
+ */
+[[nodiscard]] inline CoreSelection select_worker_cores(
+    const WorkerGridTopology& topology, const std::span<const DramBankHistogram> slots) {
+    const uint32_t width = topology.logical_width();
+    const size_t candidate_count = static_cast<size_t>(width) * topology.logical_height();
+    TT_FATAL(
+        !slots.empty() && slots.size() <= candidate_count,
+        "Core selection needs between 1 and {} slots, got {}",
+        candidate_count,
+        slots.size());
+    for (const DramBankHistogram& slot : slots) {
+        TT_FATAL(
+            slot.pages_per_bank.size() == topology.bank_count(),
+            "Core slot demand covers {} banks but {} has {}",
+            slot.pages_per_bank.size(),
+            topology.name,
+            topology.bank_count());
+    }
+
+    std::vector<NocCoordinate> candidates(candidate_count);
+    for (size_t index = 0; index < candidate_count; ++index) {
+        candidates[index] =
+            NocCoordinate{.x = static_cast<uint32_t>(index % width), .y = static_cast<uint32_t>(index / width)};
+    }
+    std::vector<uint64_t> cost(slots.size() * candidate_count);
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        for (size_t index = 0; index < candidate_count; ++index) {
+            cost[slot * candidate_count + index] =
+                core_selection_detail::slot_cost(topology, slots[slot], topology.physical(candidates[index]));
+        }
+    }
+    const auto slot_cost = [&](const size_t slot, const size_t candidate) {
+        return cost[slot * candidate_count + candidate];
+    };
+
+    uint64_t first_n_hops = 0;
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        first_n_hops += slot_cost(slot, slot);
+    }
+
+    std::vector<size_t> order(slots.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+        return slots[lhs].total_pages() > slots[rhs].total_pages();
+    });
+    std::vector<size_t> assignment(slots.size());
+    std::vector<bool> used(candidate_count, false);
+    for (const size_t slot : order) {
+        size_t best = candidate_count;
+        for (size_t candidate = 0; candidate < candidate_count; ++candidate) {
+            if (!used[candidate] && (best == candidate_count || slot_cost(slot, candidate) < slot_cost(slot, best))) {
+                best = candidate;
+            }
+        }
+        assignment[slot] = best;
+        used[best] = true;
+    }
+
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (size_t slot = 0; slot < slots.size(); ++slot) {
+            for (size_t candidate = 0; candidate < candidate_count; ++candidate) {
+                if (!used[candidate] && slot_cost(slot, candidate) < slot_cost(slot, assignment[slot])) {
+                    used[assignment[slot]] = false;
+                    used[candidate] = true;
+                    assignment[slot] = candidate;
+                    improved = true;
+                }
+            }
+            for (size_t other = slot + 1; other < slots.size(); ++other) {
+                const uint64_t current = slot_cost(slot, assignment[slot]) + slot_cost(other, assignment[other]);
+                const uint64_t swapped = slot_cost(slot, assignment[other]) + slot_cost(other, assignment[slot]);
+                if (swapped < current) {
+                    std::swap(assignment[slot], assignment[other]);
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    uint64_t modeled_hops = 0;
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        modeled_hops += slot_cost(slot, assignment[slot]);
+    }
+    CoreSelection selection{.cores = {}, .modeled_hops = modeled_hops, .first_n_modeled_hops = first_n_hops};
+    selection.cores.reserve(slots.size());
+    if (modeled_hops >= first_n_hops) {
+        selection.modeled_hops = first_n_hops;
+        selection.cores.assign(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(slots.size()));
+        return selection;
+    }
+    for (const size_t candidate : assignment) {
+        selection.cores.push_back(candidates[candidate]);
+    }
+    return selection;
+}
+
+}  // namespace ttwv
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <utility>
 #include <vector>
@@ -14,6 +15,7 @@
 #include "tt-metalium/host_api.hpp"
 #include "tt-metalium/mesh_buffer.hpp"
 #include "tt-metalium/mesh_device.hpp"
+#include "tt_wavelet/include/lifting/config_words.hpp"
 #include "tt_wavelet/include/lifting/execution_plan.hpp"
 #include "tt_wavelet/include/lifting/inverse_plan.hpp"
 #include "tt_wavelet/include/lifting/static_scheme.hpp"
@@ -30,6 +32,9 @@ struct LiftingSchedulerTelemetry {
     uint32_t min_work_items_per_core{0};
     uint32_t max_work_items_per_core{0};
     uint32_t active_core_count{0};
+    uint64_t modeled_dram_hops{0};
+    uint64_t first_n_modeled_dram_hops{0};
+    bool dram_bank_chunk_placement{false};
     uint32_t chunk_count{0};
     uint32_t route_count{0};
     uint32_t groups_per_chunk{0};
@@ -65,7 +70,11 @@ struct LwtWorkingBuffers {
     std::shared_ptr<tt::tt_metal::distributed::MeshBuffer> final_odd{};
     std::shared_ptr<tt::tt_metal::distributed::MeshBuffer> route_config{};
     std::shared_ptr<tt::tt_metal::distributed::MeshBuffer> chunk_config{};
+    // Halo entries of the whole signal, uploaded by prepare_lwt.
+    std::shared_ptr<tt::tt_metal::distributed::MeshBuffer> extension_config{};
     std::vector<tt::tt_metal::CoreCoord> cores;
+    // Planner chunk at each config page; empty keeps plan order.
+    std::vector<uint32_t> chunk_order;
     LiftingSchedulerTelemetry scheduler{};
 
     [[nodiscard]] const std::shared_ptr<tt::tt_metal::distributed::MeshBuffer>& at(
@@ -78,6 +87,8 @@ struct LwtExecutable {
     LwtExecutionPlan plan{};
     LwtWorkingBuffers buffers{};
     tt::tt_metal::distributed::MeshWorkload workload{};
+    std::vector<uint32_t> config_upload{};
+    ExtensionGatherTable extension_table{};
 };
 
 struct IlwtWorkingBuffers {
@@ -98,6 +109,7 @@ struct IlwtExecutable {
     IlwtExecutionPlan plan{};
     IlwtWorkingBuffers buffers{};
     tt::tt_metal::distributed::MeshWorkload workload{};
+    std::vector<uint32_t> config_upload{};
 };
 
 [[nodiscard]] LwtExecutable create_lwt_executable_impl(
@@ -117,6 +129,7 @@ template <typename Scheme>
     const SignalBuffer& input_desc,
     const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
     const uint32_t batch_count = 1) {
+    static_assert(rounded_step_count<Scheme>() == 0, "Rounded integer schemes run on the integer host executor");
     TT_FATAL(input_desc.length > 0, "Input signal must be non-empty");
     TT_FATAL(batch_count > 0, "LWT batch count must be positive");
     TT_FATAL(input_desc.element_size_bytes == sizeof(float), "LWT supports FP32 only");
@@ -138,6 +151,13 @@ template <typename Scheme>
 
 void prepare_lwt(tt::tt_metal::distributed::MeshCommandQueue& command_queue, LwtExecutable& executable);
 
+// Uploads config pages from a caller-owned buffer of at least
+// `lwt_config_upload_word_count(executable.plan)` words, e.g. pinned memory.
+void prepare_lwt(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    LwtExecutable& executable,
+    std::span<uint32_t> upload_words);
+
 void enqueue_lwt(tt::tt_metal::distributed::MeshCommandQueue& command_queue, LwtExecutable& executable);
 
 void execute_lwt(
@@ -165,6 +185,7 @@ template <typename Scheme>
     const size_t original_length,
     const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
     const uint32_t batch_count = 1) {
+    static_assert(rounded_step_count<Scheme>() == 0, "Rounded integer schemes run on the integer host executor");
     TT_FATAL(batch_count > 0, "ILWT batch count must be positive");
     const SignalBuffer coefficient_desc{.length = coefficient_length};
     TT_FATAL(
@@ -185,6 +206,11 @@ template <typename Scheme>
 
 void prepare_ilwt(tt::tt_metal::distributed::MeshCommandQueue& command_queue, IlwtExecutable& executable);
 
+void prepare_ilwt(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    IlwtExecutable& executable,
+    std::span<uint32_t> upload_words);
+
 void enqueue_ilwt(tt::tt_metal::distributed::MeshCommandQueue& command_queue, IlwtExecutable& executable);
 
 void execute_ilwt(
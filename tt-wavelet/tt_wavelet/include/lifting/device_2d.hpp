@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <utility>
 #include <vector>
@@ -34,6 +35,9 @@ struct Lwt2DSchedulerTelemetry {
     Shape2D padded_band{};
     uint32_t available_worker_core_count{0};
     uint32_t active_core_count{0};
+    uint64_t modeled_dram_hops{0};
+    uint64_t first_n_modeled_dram_hops{0};
+    bool dram_bank_chunk_placement{false};
     uint32_t batch_count{1};
     uint32_t chunks_per_sample{0};
     uint32_t total_work_items{0};
@@ -69,6 +73,8 @@ struct Lwt2DWorkingBuffers {
     std::shared_ptr<tt::tt_metal::distributed::MeshBuffer> route_config{};
     std::shared_ptr<tt::tt_metal::distributed::MeshBuffer> band_config{};
     std::vector<tt::tt_metal::CoreCoord> cores;
+    // Planner chunk at each config page; empty keeps plan order.
+    std::vector<uint32_t> chunk_order;
     Lwt2DSchedulerTelemetry scheduler{};
 };
 
@@ -76,12 +82,14 @@ struct Lwt2DExecutable {
     Lwt2DExecutionPlan plan{};
     Lwt2DWorkingBuffers buffers{};
     tt::tt_metal::distributed::MeshWorkload workload{};
+    std::vector<uint32_t> config_upload{};
 };
 
 struct Ilwt2DExecutable {
     Ilwt2DExecutionPlan plan{};
     Lwt2DWorkingBuffers buffers{};
     tt::tt_metal::distributed::MeshWorkload workload{};
+    std::vector<uint32_t> config_upload{};
 };
 
 [[nodiscard]] Lwt2DExecutable create_lwt_2d_executable_impl(
@@ -132,6 +140,13 @@ template <typename Scheme>
 
 void prepare_lwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue, Lwt2DExecutable& executable);
 
+// Uploads chunk, route and band pages from a caller-owned buffer of at least
+// `lwt_2d_config_upload_word_count(executable.plan)` words.
+void prepare_lwt_2d(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    Lwt2DExecutable& executable,
+    std::span<uint32_t> upload_words);
+
 void enqueue_lwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue, Lwt2DExecutable& executable);
 
 void execute_lwt_2d(
@@ -193,6 +208,11 @@ template <typename Scheme>
 
 void prepare_ilwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue, Ilwt2DExecutable& executable);
 
+void prepare_ilwt_2d(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    Ilwt2DExecutable& executable,
+    std::span<uint32_t> upload_words);
+
 void enqueue_ilwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue, Ilwt2DExecutable& executable);
 
 void execute_ilwt_2d(
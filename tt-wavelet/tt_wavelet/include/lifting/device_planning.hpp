@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tt_stl/assert.hpp>
+#include <utility>
+
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan.hpp"
+#include "tt_wavelet/include/lifting/l1_accounting.hpp"
+#include "tt_wavelet/include/lifting/policy.hpp"
+
+namespace ttwv {
+
+// Host-only half of the 1D device planning policy. The device factories and
+// offline tools share it so that a plan chosen without a MeshDevice is the
+// plan the device would build for the same architecture and L1 capacity.
+
+inline constexpr uint32_t kDefaultL1SignalBudgetBytes = 768 * 1024;
+inline constexpr uint32_t kIlwtInterleaveBatchSticks = 96;
+inline constexpr uint32_t kAlignedNocMaxRouteCount = 5;
+inline constexpr uint32_t kAlignedNocMinGroupsPerChunk = 2;
+inline constexpr uint32_t kWormholeSingleGroupLwtTileMinRouteCount = 4;
+inline constexpr uint32_t kWormholeSingleGroupIlwtTileMinRouteCount = 7;
+
+static_assert(
+    kIlwtInterleaveBatchSticks <= device_protocol::kIlwtGroupOutputElements / kStickWidth,
+    "ILWT interleave batch must fit in one output group");
+
+struct LwtDevicePlan {
+    LwtExecutionPlan plan{};
+    uint32_t signal_budget_bytes{0};
+    bool hybrid_tile_mirror{false};
+    bool row_major_noc_staging{false};
+};
+
+struct IlwtDevicePlan {
+    IlwtExecutionPlan plan{};
+    uint32_t signal_budget_bytes{0};
+    uint32_t interleave_batch_sticks{1};
+    bool hybrid_tile_mirror{false};
+    bool row_major_noc_staging{false};
+};
+
+namespace device_planning_detail {
+
+[[nodiscard]] inline uint32_t checked_u32(const size_t value, const char* label) {
+    TT_FATAL(
+        value <= static_cast<size_t>(std::numeric_limits<uint32_t>::max()), "{} {} overflows uint32_t", label, value);
+    return static_cast<uint32_t>(value);
+}
+
+}  // namespace device_planning_detail
+
+[[nodiscard]] inline uint32_t ilwt_interleave_batch_sticks(const tt::ARCH architecture) {
+    // B96 was measured on Wormhole. Keep Blackhole on its existing one-stick
+    // path until the architecture has independent correctness and timing data.
+    return architecture == tt::ARCH::WORMHOLE_B0 ? kIlwtInterleaveBatchSticks : 1U;
+}
+
+[[nodiscard]] inline bool supports_hybrid_tile_mirror(const tt::ARCH architecture, const WorkspaceLayout layout) {
+    // The tile-shadow path is a Wormhole KEEP result. Blackhole keeps its
+    // tile-native policy until the row-major mirror has been measured there.
+    return architecture == tt::ARCH::WORMHOLE_B0 && layout == WorkspaceLayout::kRowMajor;
+}
+
+[[nodiscard]] inline uint32_t tile_mirror_elements(const uint32_t workspace_elements, const bool hybrid_tile_mirror) {
+    return hybrid_tile_mirror
+               ? device_planning_detail::checked_u32(
+                     ceil_div(workspace_elements, static_cast<uint32_t>(device_protocol::kLwtGroupOutputElements)) *
+                         device_protocol::kLwtGroupOutputElements,
+                     "hybrid tile mirror elements")
+               : 0U;
+}
+
+[[nodiscard]] inline uint32_t planner_signal_budget_bytes(
+    const uint32_t configured_budget,
+    const uint32_t capacity_bytes,
+    const ArchitecturePolicy& policy,
+    const bool hybrid_tile_mirror,
+    const uint32_t interleave_batch_sticks,
+    const uint32_t extension_table_bytes = 0) {
+    if (!hybrid_tile_mirror) {
+        return configured_budget;
+    }
+
+    const L1Accounting fixed = make_l1_accounting(
+        0, 0, 0, interleave_batch_sticks, policy.l1_scratch_bytes, capacity_bytes, extension_table_bytes);
+    constexpr uint64_t mirror_rounding_reserve =
+        uint64_t{3} * (device_protocol::kLwtGroupOutputElements - 1U) * sizeof(float);
+    TT_FATAL(
+        fixed.total_bytes + mirror_rounding_reserve < capacity_bytes,
+        "LWT fixed resources leave no room for a hybrid workspace");
+
+    // The planner accounts for the logical three-slot workspace. A hybrid
+    // slot additionally owns a tile-native mirror of approximately the same
+    // size. Reserve the worst-case group-rounding overhead and halve the
+    // remaining physical workspace capacity.
+    const uint64_t capacity_limited_budget = (capacity_bytes - fixed.total_bytes - mirror_rounding_reserve) / 2U;
+    return std::min(
+        configured_budget, device_planning_detail::checked_u32(capacity_limited_budget, "hybrid L1 signal budget"));
+}
+
+[[nodiscard]] inline bool prefer_tile_native_workspace(const LwtExecutionPlan& plan, const tt::ARCH architecture) {
+    TT_FATAL(!plan.chunks.empty(), "LWT workspace selection requires at least one chunk");
+
+    // Interleaved repeated measurements on Blackhole P150 show tile-native
+    // wins across the complete 106-scheme sweep at 100K, 300K, 500K, and 1M.
+    // Keep this architecture-local; Wormhole retains its calibrated hybrid
+    // row-major policy below.
+    if (architecture == tt::ARCH::BLACKHOLE) {
+        return true;
+    }
+
+    // All-scheme Wormhole measurements show that one-group chunks do not
+    // amortize the row-major tile-shadow traffic once the lifting schedule has
+    // at least four executable routes.  Require multiple chunks so tiny and
+    // external-coefficient edge cases retain their proven layout. Multi-group
+    // chunks retain the hybrid row-major steady-state path. Keep this
+    // crossover architecture-local; Blackhole has an independently selected
+    // tile-native default.
+    if (architecture == tt::ARCH::WORMHOLE_B0 && plan.chunks.size() > 1 && plan.groups_per_chunk == 1 &&
+        plan.chunks.front().routes.size() >= kWormholeSingleGroupLwtTileMinRouteCount) {
+        return true;
+    }
+
+    // Tile-native persistence makes an aligned base a three-page transfer and
+    // makes every output write three pages instead of 96 half-sticks.  A
+    // shifted base still needs a tile/row remap, so keep row-major storage for
+    // schemes where fewer than half of predict/update routes can use the page
+    // path.  The override above keeps this policy directly benchmarkable.
+    uint32_t predict_update_count = 0;
+    uint32_t aligned_base_count = 0;
+    const RouteRange routes = plan.chunks.front().routes;
+    const auto types = plan.route_table.rows_of(plan.route_table.type, routes);
+    const auto base_offsets = plan.route_table.rows_of(plan.route_table.base_offset_elements, routes);
+    for (size_t route_index = 0; route_index < routes.size(); ++route_index) {
+        if (!is_predict_update_step(types[route_index])) {
+            continue;
+        }
+        ++predict_update_count;
+        aligned_base_count += base_offsets[route_index] == 0 ? 1U : 0U;
+    }
+    return predict_update_count > 0 && 2U * aligned_base_count >= predict_update_count;
+}
+
+[[nodiscard]] inline bool prefer_tile_native_inverse_workspace(
+    const IlwtExecutionPlan& plan, const tt::ARCH architecture) {
+    TT_FATAL(!plan.chunks.empty(), "ILWT workspace selection requires at least one chunk");
+
+    if (architecture == tt::ARCH::BLACKHOLE) {
+        const uint32_t route_count =
+            device_planning_detail::checked_u32(plan.chunks.front().routes.size(), "ILWT route count");
+        // Blackhole tile-native is the general inverse winner. Row-major only
+        // crosses over once a core owns enough groups to amortize its setup,
+        // and only for very short schedules. This metadata rule explains the
+        // stable crossover cases without scheme-name checks.
+        const bool row_major_crossover = (plan.output_groups_per_chunk >= 2 && route_count <= 2) ||
+                                         (plan.output_groups_per_chunk >= 3 && route_count <= 3);
+        return !row_major_crossover;
+    }
+
+    // The inverse B96 row-major path remains faster for short lifting
+    // schedules.  On Wormhole, tile-native becomes the consistent winner for
+    // a one-group chunk at seven or more executable routes. Require multiple
+    // chunks so tiny/external ILWT inputs stay on the proven row-major path.
+    // Once a chunk owns multiple groups, the hybrid row-major mirror amortizes
+    // its setup cost.
+    return architecture == tt::ARCH::WORMHOLE_B0 && plan.chunks.size() > 1 && plan.output_groups_per_chunk == 1 &&
+           plan.chunks.front().routes.size() >= kWormholeSingleGroupIlwtTileMinRouteCount;
+}
+
+template <typename Plan>
+[[nodiscard]] bool prefer_aligned_row_major_noc_staging(
+    const Plan& plan, const uint32_t groups_per_chunk, const bool hybrid_tile_mirror) {
+    TT_FATAL(!plan.chunks.empty(), "LWT NoC staging selection requires at least one chunk");
+    // Matched standalone measurements show a clear win for short route
+    // schedules (notably bior3.9) once a core owns multiple groups. Longer
+    // schedules such as db10 and dmey lose to packet setup overhead, so they
+    // retain the scalar row-major gather while still using the tile mirror.
+    return hybrid_tile_mirror && groups_per_chunk >= kAlignedNocMinGroupsPerChunk &&
+           plan.chunks.front().routes.size() <= kAlignedNocMaxRouteCount;
+}
+
+/**
+ * L1 bytes of the halo table a forward reader keeps for a plan: one page per
+ * four of its left and right pad samples.
+ */
+[[nodiscard]] inline uint32_t extension_table_l1_bytes(const LiftingForwardPlan& full_plan) {
+    const Pad1DConfig& pad = full_plan.preprocess_layout.pad_config;
+    return device_protocol::extension_config_page_count(pad.left + pad.right) *
+           device_protocol::kExtensionConfigPageBytes;
+}
+
+[[nodiscard]] inline uint32_t extension_table_l1_bytes(const LwtExecutionPlan& plan) {
+    return extension_table_l1_bytes(plan.full_plan);
+}
+
+// Inverse readers load canonical coefficients and hold no halo table.
+[[nodiscard]] constexpr uint32_t extension_table_l1_bytes(const IlwtExecutionPlan&) noexcept { return 0; }
+
+/**
+ * Per-core L1 accounting of a 1D forward or inverse plan as the device
+ * allocates it; fails when the plan does not fit `capacity_bytes`.
+ */
+template <typename Plan>
+[[nodiscard]] L1Accounting make_device_l1_accounting(
+    const Plan& plan,
+    const ArchitecturePolicy& policy,
+    const bool hybrid_tile_mirror,
+    const uint32_t interleave_batch_sticks,
+    const uint32_t capacity_bytes) {
+    return make_l1_accounting(
+        plan.workspace_elements,
+        plan.max_workspace_elements,
+        tile_mirror_elements(plan.workspace_elements, hybrid_tile_mirror),
+        interleave_batch_sticks,
+        policy.l1_scratch_bytes,
+        capacity_bytes,
+        extension_table_l1_bytes(plan));
+}
+
+/**
+ * Forward LWT plan, workspace layout and staging mode the device selects for
+ * `policy`. `configured_budget_bytes` is the L1 signal budget before the
+ * hybrid-mirror capacity limit; a workspace override disables the automatic
+ * layout choice.
+ */
+[[nodiscard]] inline LwtDevicePlan select_lwt_device_plan(
+    LiftingForwardPlan full_plan,
+    const ArchitecturePolicy& policy,
+    const uint32_t core_limit,
+    const uint32_t capacity_bytes,
+    const uint32_t configured_budget_bytes,
+    const std::optional<WorkspaceLayout> workspace_override = std::nullopt) {
+    const WorkspaceLayout initial_workspace_layout = workspace_override.value_or(WorkspaceLayout::kRowMajor);
+    const bool initial_hybrid_tile_mirror = supports_hybrid_tile_mirror(policy.architecture, initial_workspace_layout);
+    const uint32_t signal_budget_bytes = planner_signal_budget_bytes(
+        configured_budget_bytes,
+        capacity_bytes,
+        policy,
+        initial_hybrid_tile_mirror,
+        1U,
+        extension_table_l1_bytes(full_plan));
+    LwtExecutionPlan plan =
+        make_lwt_execution_plan(std::move(full_plan), core_limit, signal_budget_bytes, initial_workspace_layout);
+    const bool tile_native_preferred = prefer_tile_native_workspace(plan, policy.architecture);
+    const bool hybrid_has_steady_state = plan.groups_per_chunk >= kAlignedNocMinGroupsPerChunk;
+    if (!workspace_override.has_value() && tile_native_preferred &&
+        (!initial_hybrid_tile_mirror || !hybrid_has_steady_state)) {
+        plan = make_lwt_execution_plan(
+            std::move(plan.full_plan), core_limit, signal_budget_bytes, WorkspaceLayout::kTileNative);
+    }
+    const bool hybrid_tile_mirror = supports_hybrid_tile_mirror(policy.architecture, plan.workspace_layout);
+    const bool row_major_noc_staging =
+        prefer_aligned_row_major_noc_staging(plan, plan.groups_per_chunk, hybrid_tile_mirror);
+    return LwtDevicePlan{
+        .plan = std::move(plan),
+        .signal_budget_bytes = signal_budget_bytes,
+        .hybrid_tile_mirror = hybrid_tile_mirror,
+        .row_major_noc_staging = row_major_noc_staging,
+    };
+}
+
+/**
+ * Inverse counterpart of select_lwt_device_plan. `policy` must already carry
+ * the workspace override, as make_architecture_policy applies it to the
+ * inverse layout.
+ */
+[[nodiscard]] inline IlwtDevicePlan select_ilwt_device_plan(
+    LiftingInversePlan full_plan,
+    const ArchitecturePolicy& policy,
+    const uint32_t core_limit,
+    const uint32_t capacity_bytes,
+    const uint32_t configured_budget_bytes,
+    const std::optional<WorkspaceLayout> workspace_override = std::nullopt) {
+    TT_FATAL(policy.inverse_scale_inline, "ILWT policy must preserve inline FP32 inverse scaling");
+    const uint32_t interleave_batch_sticks = ilwt_interleave_batch_sticks(policy.architecture);
+    const bool initial_hybrid_tile_mirror = supports_hybrid_tile_mirror(policy.architecture, policy.ilwt_layout);
+    const uint32_t signal_budget_bytes = planner_signal_budget_bytes(
+        configured_budget_bytes, capacity_bytes, policy, initial_hybrid_tile_mirror, interleave_batch_sticks);
+    IlwtExecutionPlan plan = make_ilwt_execution_plan(
+        std::move(full_plan), core_limit, signal_budget_bytes, policy.ilwt_layout, policy.final_interleave_direct);
+    const WorkspaceLayout preferred_layout = prefer_tile_native_inverse_workspace(plan, policy.architecture)
+                                                 ? WorkspaceLayout::kTileNative
+                                                 : WorkspaceLayout::kRowMajor;
+    if (!workspace_override.has_value() && plan.workspace_layout != preferred_layout) {
+        const ArchitecturePolicy preferred_policy = make_architecture_policy(policy.architecture, preferred_layout);
+        plan = make_ilwt_execution_plan(
+            std::move(plan.full_plan),
+            core_limit,
+            signal_budget_bytes,
+            preferred_layout,
+            preferred_policy.final_interleave_direct);
+    }
+    const bool hybrid_tile_mirror = supports_hybrid_tile_mirror(policy.architecture, plan.workspace_layout);
+    const bool row_major_noc_staging =
+        prefer_aligned_row_major_noc_staging(plan, plan.output_groups_per_chunk, hybrid_tile_mirror);
+    return IlwtDevicePlan{
+        .plan = std::move(plan),
+        .signal_budget_bytes = signal_budget_bytes,
+        .interleave_batch_sticks = interleave_batch_sticks,
+        .hybrid_tile_mirror = hybrid_tile_mirror,
+        .row_major_noc_staging = row_major_noc_staging,
+    };
+}
+
+}  // namespace ttwv
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory_resource>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <tuple>
 #include <utility>
@@ -11,7 +14,9 @@
 
 #include "tt_wavelet/include/common/signal.hpp"
 #include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/page_geometry.hpp"
 #include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/route_table.hpp"
 
 namespace ttwv {
 
@@ -42,7 +47,7 @@ struct AxisConePlan {
     IndexInterval final_odd{};
     IndexInterval initial_even{};
     IndexInterval initial_odd{};
-    std::vector<AxisRouteRequirement> routes;
+    std::pmr::vector<AxisRouteRequirement> routes;
     size_t max_workspace_elements{0};
     bool base_transitions_aligned_32{false};
 };
@@ -54,29 +59,18 @@ struct DependencyExtent {
     int32_t odd_right{0};
 };
 
-struct LwtStepRoute {
-    StepType type{StepType::kPredict};
-    StreamRef source{};
-    StreamRef base{};
-    RouteOutputRef output{};
-    size_t source_storage_length{0};
-    size_t base_storage_length{0};
-    size_t source_offset_elements{0};
-    size_t base_offset_elements{0};
-    uint32_t source_left_pad_elements{0};
-    size_t output_length{0};
-    size_t output_offset_elements{0};
-};
-
 struct LwtChunkPlan {
     IndexInterval final_even{};
     IndexInterval final_odd{};
     IndexInterval initial_even{};
     IndexInterval initial_odd{};
     DependencyExtent descriptor{};
-    std::vector<LwtStepRoute> routes;
+    RouteRange routes{};
     size_t max_workspace_elements{0};
     double dependency_overhead{0.0};
+    // The initial cone reads only signal samples, so the chunk's reader
+    // skips boundary extension entirely.
+    bool interior{false};
 };
 
 enum class WorkspaceLayout : uint8_t {
@@ -86,15 +80,42 @@ enum class WorkspaceLayout : uint8_t {
 
 struct LwtExecutionPlan {
     LiftingForwardPlan full_plan{};
+    IndexInterval output_window{};
     std::vector<LwtChunkPlan> chunks;
+    LwtRouteTable route_table{};
     uint32_t groups_per_chunk{0};
     uint32_t workspace_elements{0};
     uint32_t max_workspace_elements{0};
     uint32_t active_core_count{0};
     double max_dependency_overhead{0.0};
     WorkspaceLayout workspace_layout{WorkspaceLayout::kRowMajor};
+    LwtPageGeometry page_geometry{};
 };
 
+/**
+ * Planner chunk uploaded at config page `page`.
+ *
+ * Plans keep their chunks in output order; a device that places chunks near
+ * DRAM banks permutes only the uploaded pages. An empty order is the
+ * identity.
+ */
+[[nodiscard]] inline size_t chunk_at_page(const std::span<const uint32_t> chunk_order, const size_t page) noexcept {
+    return chunk_order.empty() ? page : chunk_order[page];
+}
+
+inline void validate_chunk_page_order(const std::span<const uint32_t> chunk_order, const size_t chunk_count) {
+    if (chunk_order.empty()) {
+        return;
+    }
+    TT_FATAL(
+        chunk_order.size() == chunk_count, "Chunk page order covers {} of {} chunks", chunk_order.size(), chunk_count);
+    std::vector<bool> seen(chunk_count, false);
+    for (const uint32_t chunk : chunk_order) {
+        TT_FATAL(chunk < chunk_count && !seen[chunk], "Chunk page order is not a permutation");
+        seen[chunk] = true;
+    }
+}
+
 namespace execution_detail {
 
 using RequiredStreams = AxisRequiredStreams;
@@ -176,7 +197,7 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
         predict_update_route_index < plan.routes.size(),
         "LWT terminal-scale inline path could not find a predict/update route");
 
-    bool final_even = plan.routes[predict_update_route_index].type == StepType::kUpdate;
+    bool final_even = is_update_step(plan.routes[predict_update_route_index].type);
     for (size_t route_index = predict_update_route_index + 1; route_index + 2 < plan.routes.size(); ++route_index) {
         TT_FATAL(
             plan.routes[route_index].type == StepType::kSwap,
@@ -198,11 +219,12 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
     };
 }
 
-[[nodiscard]] inline std::vector<RequiredStreams> backpropagate_requirements(
+[[nodiscard]] inline std::pmr::vector<RequiredStreams> backpropagate_requirements(
     const LiftingForwardPlan& plan,
     const IndexInterval final_even,
     const IndexInterval final_odd,
-    const size_t closure_extent = 0) {
+    const size_t closure_extent = 0,
+    std::pmr::memory_resource* const resource = std::pmr::get_default_resource()) {
     const auto close_interval = [closure_extent](const IndexInterval interval, const size_t stream_length) {
         if (closure_extent == 0 || interval.empty()) {
             return interval;
@@ -213,7 +235,7 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
                                        : round_up(interval.end, closure_extent);
         return IndexInterval{.begin = begin, .end = std::min(rounded_end, stream_length)};
     };
-    std::vector<RequiredStreams> required(plan.routes.size() + 1);
+    std::pmr::vector<RequiredStreams> required(plan.routes.size() + 1, resource);
 
     size_t even_length = plan.final_even_length;
     size_t odd_length = plan.final_odd_length;
@@ -233,7 +255,8 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
 
         RequiredStreams before{};
         switch (route.type) {
-            case StepType::kPredict: {
+            case StepType::kPredict:
+            case StepType::kRoundedPredict: {
                 TT_FATAL(
                     even_length == route.source_length && odd_length == route.output_length,
                     "Predict route length state is inconsistent with the forward plan");
@@ -244,7 +267,8 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
                 odd_length = route.base_length;
                 break;
             }
-            case StepType::kUpdate: {
+            case StepType::kUpdate:
+            case StepType::kRoundedUpdate: {
                 TT_FATAL(
                     odd_length == route.source_length && even_length == route.output_length,
                     "Update route length state is inconsistent with the forward plan");
@@ -306,21 +330,60 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
     return static_cast<int32_t>(value);
 }
 
+/**
+ * Whether padded even sample 2 * i of `even` and odd sample 2 * i + 1 of
+ * `odd` all land inside the signal, i.e. the chunk loading these initial
+ * streams never reads a boundary extension.
+ */
+[[nodiscard]] inline bool initial_cone_is_interior(
+    const LiftingForwardPlan& plan, const IndexInterval even, const IndexInterval odd) noexcept {
+    const size_t left = plan.preprocess_layout.pad_config.left;
+    const size_t right = left + plan.preprocess_layout.input.length;
+    const auto inside = [left, right](const IndexInterval stream, const size_t phase) {
+        return stream.empty() || (2 * stream.begin + phase >= left && 2 * (stream.end - 1) + phase < right);
+    };
+    return inside(even, 0) && inside(odd, 1);
+}
+
+// Routes executed by every chunk: all but swaps and the inlined terminal scale.
+[[nodiscard]] inline size_t chunk_route_count(const LiftingForwardPlan& plan) {
+    const auto data_routes = static_cast<size_t>(
+        std::count_if(plan.routes.begin(), plan.routes.end(), [](const LiftingStepRoute& route) {
+            return route.type != StepType::kSwap;
+        }));
+    TT_FATAL(data_routes > 0, "LWT plan has no data routes");
+    return data_routes - 1;
+}
+
 [[nodiscard]] inline LwtChunkPlan build_chunk(
     const LiftingForwardPlan& plan,
     const IndexInterval final_even,
     const IndexInterval final_odd,
     const size_t final_even_output_origin,
-    const size_t final_odd_output_origin) {
-    const std::vector<RequiredStreams> required = backpropagate_requirements(plan, final_even, final_odd);
+    const size_t final_odd_output_origin,
+    LwtRouteTable& route_table,
+    std::pmr::memory_resource* const scratch) {
+    const std::pmr::vector<RequiredStreams> required =
+        backpropagate_requirements(plan, final_even, final_odd, 0, scratch);
     const TerminalScaleInline inline_scale = terminal_scale_inline(plan);
     StoredStream active_even{.slot = StorageSlot::kA, .storage = required.front().even};
     StoredStream active_odd{.slot = StorageSlot::kB, .storage = required.front().odd};
     StorageSlot free_slot = StorageSlot::kScratch;
     size_t max_workspace_elements = std::max(required.front().even.length(), required.front().odd.length());
 
-    std::vector<LwtStepRoute> routes;
-    routes.reserve(plan.routes.size());
+    // Terminal routes address the canonical interval of each final stream.
+    const auto canonical_offset = [&](const RouteOutputStorage storage, const IndexInterval output) -> size_t {
+        if (storage == RouteOutputStorage::kWorkspaceSlot) {
+            return 0;
+        }
+        const bool even = storage == RouteOutputStorage::kFinalEvenDram;
+        const size_t origin = even ? final_even_output_origin : final_odd_output_origin;
+        const size_t begin = output.empty() ? 0 : output.begin;
+        TT_FATAL(begin >= origin, "LWT final-{} route starts before the canonical interval", even ? "even" : "odd");
+        return begin - origin;
+    };
+
+    const size_t route_begin = route_table.rows;
     for (size_t route_index = 0; route_index < plan.routes.size(); ++route_index) {
         const auto& full_route = plan.routes[route_index];
         const RequiredStreams& after = required[route_index + 1];
@@ -330,8 +393,8 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
             continue;
         }
 
-        if (full_route.type == StepType::kPredict || full_route.type == StepType::kUpdate) {
-            const bool predict = full_route.type == StepType::kPredict;
+        if (is_predict_update_step(full_route.type)) {
+            const bool predict = is_predict_step(full_route.type);
             const bool inline_scale_route = route_index == inline_scale.predict_update_route_index;
             const uint32_t k = coefficient_count(full_route);
             const IndexInterval output = predict ? after.odd : after.even;
@@ -344,7 +407,7 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
                 inline_scale_route ? RouteOutputRef{.storage = inline_scale.final_storage, .slot = free_slot}
                                    : detail::workspace_output(free_slot);
 
-            routes.push_back(LwtStepRoute{
+            route_table.push_back(LwtStepRoute{
                 .type = full_route.type,
                 .source = StreamRef{.slot = source.slot},
                 .base = StreamRef{.slot = base.slot},
@@ -355,7 +418,7 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
                 .base_offset_elements = local_offset(base.storage, base_required),
                 .source_left_pad_elements = full_route.source_left_pad,
                 .output_length = output.length(),
-                .output_offset_elements = inline_scale_route && !output.empty() ? output.begin : 0,
+                .output_offset_elements = canonical_offset(output_ref.storage, output),
             });
 
             const StoredStream replacement{.slot = free_slot, .storage = output};
@@ -378,7 +441,7 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
         const StoredStream& source = scale_even ? active_even : active_odd;
         const IndexInterval output = scale_even ? after.even : after.odd;
         const auto final_storage = scale_even ? RouteOutputStorage::kFinalEvenDram : RouteOutputStorage::kFinalOddDram;
-        routes.push_back(LwtStepRoute{
+        route_table.push_back(LwtStepRoute{
             .type = full_route.type,
             .source = StreamRef{.slot = source.slot},
             .base = StreamRef{.slot = source.slot},
@@ -389,24 +452,10 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
             .base_offset_elements = local_offset(source.storage, output),
             .source_left_pad_elements = 0,
             .output_length = output.length(),
-            .output_offset_elements = output.empty() ? 0 : output.begin,
+            .output_offset_elements = canonical_offset(final_storage, output),
         });
     }
 
-    for (auto& route : routes) {
-        if (route.output.storage == RouteOutputStorage::kFinalEvenDram) {
-            TT_FATAL(
-                route.output_offset_elements >= final_even_output_origin,
-                "LWT final-even route starts before the canonical interval");
-            route.output_offset_elements -= final_even_output_origin;
-        } else if (route.output.storage == RouteOutputStorage::kFinalOddDram) {
-            TT_FATAL(
-                route.output_offset_elements >= final_odd_output_origin,
-                "LWT final-odd route starts before the canonical interval");
-            route.output_offset_elements -= final_odd_output_origin;
-        }
-    }
-
     const IndexInterval initial_even = required.front().even;
     const IndexInterval initial_odd = required.front().odd;
     const size_t final_begin = std::min(final_even.begin, final_odd.begin);
@@ -434,52 +483,99 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
                 .odd_right = checked_descriptor_extent(
                     static_cast<int64_t>(initial_odd.end) - static_cast<int64_t>(final_end), "odd-right"),
             },
-        .routes = std::move(routes),
+        .routes = route_table.range_since(route_begin),
         .max_workspace_elements = max_workspace_elements,
         .dependency_overhead = dependency_overhead,
+        .interior = initial_cone_is_interior(plan, initial_even, initial_odd),
     };
 }
 
-[[nodiscard]] inline std::vector<LwtChunkPlan> build_chunks(
-    const LiftingForwardPlan& plan, const uint32_t requested_chunk_count) {
-    TT_FATAL(requested_chunk_count > 0, "LWT chunk count must be non-zero");
+// Terminal stream index of canonical output 0, per terminal stream.
+struct FinalStreamOrigins {
+    size_t even{0};
+    size_t odd{0};
+};
+
+[[nodiscard]] inline FinalStreamOrigins final_stream_origins(const LiftingForwardPlan& plan) {
     const int64_t canonical_start = static_cast<int64_t>(plan.preprocess_layout.pad_config.left + 1) / 2;
     const int64_t signed_even_origin = canonical_start - plan.final_even_shift;
     const int64_t signed_odd_origin = canonical_start - plan.final_odd_shift;
     TT_FATAL(signed_even_origin >= 0 && signed_odd_origin >= 0, "LWT canonical output requires a negative origin");
-    const size_t final_even_origin = static_cast<size_t>(signed_even_origin);
-    const size_t final_odd_origin = static_cast<size_t>(signed_odd_origin);
+    const FinalStreamOrigins origins{
+        .even = static_cast<size_t>(signed_even_origin),
+        .odd = static_cast<size_t>(signed_odd_origin),
+    };
     TT_FATAL(
-        final_even_origin + plan.output_length <= plan.final_even_length &&
-            final_odd_origin + plan.output_length <= plan.final_odd_length,
+        origins.even + plan.output_length <= plan.final_even_length &&
+            origins.odd + plan.output_length <= plan.final_odd_length,
         "LWT terminal streams do not cover the canonical output interval");
-    const size_t max_final_length = plan.output_length;
-    const size_t final_group_count =
-        std::max(ceil_div(max_final_length, static_cast<size_t>(device_protocol::kLwtGroupOutputElements)), size_t{1});
+    return origins;
+}
+
+// Scratch for the per-chunk requirement vectors: a few hundred bytes each,
+// reused chunk after chunk from one stack buffer.
+inline constexpr size_t kChunkScratchBytes = 4096;
+
+/**
+ * Build the chunks of one candidate chunk count. Their routes are appended
+ * to `route_table`, which is replaced by a table sized for exactly this
+ * candidate. Chunk boundaries fall on multiples of `group_elements`.
+ */
+[[nodiscard]] inline std::vector<LwtChunkPlan> build_chunks(
+    const LiftingForwardPlan& plan,
+    const uint32_t requested_chunk_count,
+    const IndexInterval canonical_outputs,
+    LwtRouteTable& route_table,
+    const size_t group_elements = device_protocol::kLwtGroupOutputElements) {
+    TT_FATAL(requested_chunk_count > 0, "LWT chunk count must be non-zero");
+    TT_FATAL(
+        canonical_outputs.begin <= canonical_outputs.end && canonical_outputs.end <= plan.output_length,
+        "LWT output window [{}, {}) exceeds the canonical output length {}",
+        canonical_outputs.begin,
+        canonical_outputs.end,
+        plan.output_length);
+    // Terminal routes address the output window, so a windowed plan writes a
+    // dense buffer that starts at `canonical_outputs.begin`.
+    const FinalStreamOrigins origins = final_stream_origins(plan);
+    const size_t window_even_origin = origins.even + canonical_outputs.begin;
+    const size_t window_odd_origin = origins.odd + canonical_outputs.begin;
+    const size_t max_final_length = canonical_outputs.length();
+    const size_t final_group_count = std::max(ceil_div(max_final_length, group_elements), size_t{1});
     const size_t chunk_count = std::min(static_cast<size_t>(requested_chunk_count), final_group_count);
     const size_t base_groups = final_group_count / chunk_count;
     const size_t extra_groups = final_group_count % chunk_count;
 
+    route_table = make_lwt_route_table(chunk_count * chunk_route_count(plan));
+    std::array<std::byte, kChunkScratchBytes> scratch_buffer;
+    std::pmr::monotonic_buffer_resource scratch{scratch_buffer.data(), scratch_buffer.size()};
     std::vector<LwtChunkPlan> chunks;
     chunks.reserve(chunk_count);
     size_t group_begin = 0;
     for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
         const size_t group_count = base_groups + (chunk_index < extra_groups ? 1 : 0);
-        const size_t begin = group_begin * device_protocol::kLwtGroupOutputElements;
-        const size_t end =
-            std::min((group_begin + group_count) * device_protocol::kLwtGroupOutputElements, max_final_length);
+        const size_t begin = group_begin * group_elements;
+        const size_t end = std::min((group_begin + group_count) * group_elements, max_final_length);
         chunks.push_back(build_chunk(
             plan,
-            IndexInterval{.begin = begin + final_even_origin, .end = end + final_even_origin},
-            IndexInterval{.begin = begin + final_odd_origin, .end = end + final_odd_origin},
-            final_even_origin,
-            final_odd_origin));
+            IndexInterval{.begin = begin + window_even_origin, .end = end + window_even_origin},
+            IndexInterval{.begin = begin + window_odd_origin, .end = end + window_odd_origin},
+            window_even_origin,
+            window_odd_origin,
+            route_table,
+            &scratch));
+        scratch.release();
         group_begin += group_count;
     }
     TT_FATAL(group_begin == final_group_count, "LWT chunks do not cover every final output group");
     return chunks;
 }
 
+[[nodiscard]] inline std::vector<LwtChunkPlan> build_chunks(
+    const LiftingForwardPlan& plan, const uint32_t requested_chunk_count, LwtRouteTable& route_table) {
+    return build_chunks(
+        plan, requested_chunk_count, IndexInterval{.begin = 0, .end = plan.output_length}, route_table);
+}
+
 }  // namespace execution_detail
 
 /**
@@ -495,11 +591,12 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
     const LiftingForwardPlan& plan,
     const IndexInterval final_even,
     const IndexInterval final_odd,
-    const size_t closure_extent = 0) {
-    const std::vector<AxisRequiredStreams> required =
-        execution_detail::backpropagate_requirements(plan, final_even, final_odd, closure_extent);
+    const size_t closure_extent = 0,
+    std::pmr::memory_resource* const resource = std::pmr::get_default_resource()) {
+    const std::pmr::vector<AxisRequiredStreams> required =
+        execution_detail::backpropagate_requirements(plan, final_even, final_odd, closure_extent, resource);
 
-    std::vector<AxisRouteRequirement> routes;
+    std::pmr::vector<AxisRouteRequirement> routes(resource);
     routes.reserve(plan.routes.size());
     for (size_t route_index = 0; route_index < plan.routes.size(); ++route_index) {
         const LiftingStepRoute& route = plan.routes[route_index];
@@ -512,7 +609,8 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
         };
 
         switch (route.type) {
-            case StepType::kPredict: {
+            case StepType::kPredict:
+            case StepType::kRoundedPredict: {
                 const uint32_t k = execution_detail::coefficient_count(route);
                 requirement.output = after.odd;
                 requirement.source =
@@ -520,7 +618,8 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
                 requirement.base = execution_detail::translated(requirement.output, route.base_offset);
                 break;
             }
-            case StepType::kUpdate: {
+            case StepType::kUpdate:
+            case StepType::kRoundedUpdate: {
                 const uint32_t k = execution_detail::coefficient_count(route);
                 requirement.output = after.even;
                 requirement.source =
@@ -566,31 +665,50 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
     };
 }
 
+/**
+ * Plan only the canonical outputs in `output_window`.
+ *
+ * Chunks and their dependency cones cover just the window, and terminal
+ * routes write relative to `output_window.begin`. Segmented execution uses
+ * this to compute each stitched output sample exactly once.
+ *
+ * `page_geometry` sets the stick width the groups, workspace alignment and
+ * input/output page counts are derived from; the input and output signal
+ * descriptors of the returned plan carry that stick width and its element
+ * size. Workspace slots stay FP32 for every sample format.
+ */
 [[nodiscard]] inline LwtExecutionPlan make_lwt_execution_plan(
     LiftingForwardPlan full_plan,
+    const IndexInterval output_window,
     const uint32_t core_limit,
     const uint32_t l1_signal_budget_bytes,
-    const WorkspaceLayout workspace_layout = WorkspaceLayout::kRowMajor) {
+    const WorkspaceLayout workspace_layout = WorkspaceLayout::kRowMajor,
+    const LwtPageGeometry page_geometry = {}) {
+    validate_page_geometry(page_geometry);
     TT_FATAL(core_limit > 0, "LWT requires at least one worker core");
-    TT_FATAL(l1_signal_budget_bytes >= 3 * device_protocol::kStickBytes, "LWT L1 budget is too small");
+    TT_FATAL(l1_signal_budget_bytes >= 3 * page_geometry.page_bytes(), "LWT L1 budget is too small");
+    apply_page_geometry(full_plan.preprocess_layout, page_geometry);
 
-    const size_t max_final_length = full_plan.output_length;
-    const uint32_t final_group_count = static_cast<uint32_t>(
-        std::max(ceil_div(max_final_length, static_cast<size_t>(device_protocol::kLwtGroupOutputElements)), size_t{1}));
+    const size_t group_elements = page_geometry.group_output_elements();
+    const size_t max_final_length = output_window.length();
+    const uint32_t final_group_count =
+        static_cast<uint32_t>(std::max(ceil_div(max_final_length, group_elements), size_t{1}));
     uint32_t chunk_count = std::min(final_group_count, core_limit);
     std::vector<LwtChunkPlan> chunks;
+    LwtRouteTable route_table;
     uint32_t workspace_elements = 0;
     uint32_t max_workspace_elements = 0;
 
     const auto build_candidate = [&](const uint32_t candidate_chunk_count) {
-        auto candidate_chunks = execution_detail::build_chunks(full_plan, candidate_chunk_count);
+        auto candidate_chunks = execution_detail::build_chunks(
+            full_plan, candidate_chunk_count, output_window, route_table, group_elements);
         size_t candidate_max_workspace_elements = 0;
         for (const auto& chunk : candidate_chunks) {
             candidate_max_workspace_elements = std::max(candidate_max_workspace_elements, chunk.max_workspace_elements);
         }
         const size_t workspace_alignment = workspace_layout == WorkspaceLayout::kTileNative
-                                               ? static_cast<size_t>(device_protocol::kLwtGroupOutputElements)
-                                               : static_cast<size_t>(kStickWidth);
+                                               ? group_elements
+                                               : static_cast<size_t>(page_geometry.stick_width);
         const size_t aligned_workspace = round_up(candidate_max_workspace_elements, workspace_alignment);
         TT_FATAL(
             aligned_workspace <= static_cast<size_t>(std::numeric_limits<uint32_t>::max()),
@@ -607,7 +725,7 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
         chunks = std::move(std::get<0>(candidate));
         workspace_elements = std::get<1>(candidate);
         max_workspace_elements = std::get<2>(candidate);
-        const uint64_t workspace_bytes_per_core = uint64_t{3} * workspace_elements * sizeof(float);
+        const uint64_t workspace_bytes_per_core = page_geometry.workspace_bytes(workspace_elements);
         if (workspace_bytes_per_core <= l1_signal_budget_bytes) {
             break;
         }
@@ -630,14 +748,28 @@ inline void validate_interval(const IndexInterval interval, const size_t stream_
 
     return LwtExecutionPlan{
         .full_plan = std::move(full_plan),
+        .output_window = output_window,
         .chunks = std::move(chunks),
+        .route_table = std::move(route_table),
         .groups_per_chunk = groups_per_chunk,
         .workspace_elements = workspace_elements,
         .max_workspace_elements = max_workspace_elements,
         .active_core_count = active_core_count,
         .max_dependency_overhead = max_dependency_overhead,
         .workspace_layout = workspace_layout,
+        .page_geometry = page_geometry,
     };
 }
 
+[[nodiscard]] inline LwtExecutionPlan make_lwt_execution_plan(
+    LiftingForwardPlan full_plan,
+    const uint32_t core_limit,
+    const uint32_t l1_signal_budget_bytes,
+    const WorkspaceLayout workspace_layout = WorkspaceLayout::kRowMajor,
+    const LwtPageGeometry page_geometry = {}) {
+    const IndexInterval output_window{.begin = 0, .end = full_plan.output_length};
+    return make_lwt_execution_plan(
+        std::move(full_plan), output_window, core_limit, l1_signal_budget_bytes, workspace_layout, page_geometry);
+}
+
 }  // namespace ttwv
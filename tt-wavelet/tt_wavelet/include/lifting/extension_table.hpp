@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <vector>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/common/signal_extension.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+
+namespace ttwv {
+
+/**
+ * Identity of one extension table: the mode, the signal length, and the
+ * number of extended samples before index 0 and after index length - 1.
+ */
+struct ExtensionTableKey {
+    BoundaryMode mode{BoundaryMode::kSymmetric};
+    uint32_t length{0};
+    uint32_t left{0};
+    uint32_t right{0};
+
+    [[nodiscard]] constexpr bool operator==(const ExtensionTableKey&) const noexcept = default;
+};
+
+/**
+ * One precomputed halo sample.
+ *
+ * The value is an affine expression of at most three signal samples:
+ * kSample and kNegatedSample read `source_index`; kSmooth adds `scale`
+ * times the difference of `source_index` and `auxiliary_index` to the edge;
+ * kAntireflect reflects `source_index` about the last sample when
+ * `reflected` is set and adds `scale` periods of last - first. `scale` holds
+ * the float factor make_extended_index's distance or period quotient turns
+ * into, so entries evaluate bit for bit like evaluate_extended_index.
+ */
+struct ExtensionGatherEntry {
+    uint32_t source_index{0};
+    uint32_t auxiliary_index{0};
+    float scale{0.0F};
+    ExtensionOperation operation{ExtensionOperation::kZero};
+    bool reflected{false};
+};
+
+/**
+ * Immutable halo maps of one key: `left_halo[h]` describes extended index
+ * h - key.left and `right_halo[h]` extended index key.length + h.
+ */
+struct ExtensionGatherTable {
+    ExtensionTableKey key{};
+    std::vector<ExtensionGatherEntry> left_halo;
+    std::vector<ExtensionGatherEntry> right_halo;
+};
+
+/**
+ * Key of the halo table covering `plan`'s padded extent around an
+ * `input_length`-sample signal. Bucketed runs bind a signal shorter than the
+ * plan's, so their right halo grows by the difference.
+ */
+[[nodiscard]] inline ExtensionTableKey extension_table_key(const LiftingForwardPlan& plan, const size_t input_length) {
+    const PadSplit1DLayout& layout = plan.preprocess_layout;
+    TT_FATAL(
+        input_length <= layout.input.length,
+        "LWT input of {} samples exceeds the plan's {}",
+        input_length,
+        layout.input.length);
+    return ExtensionTableKey{
+        .mode = layout.pad_config.mode,
+        .length = static_cast<uint32_t>(input_length),
+        .left = layout.pad_config.left,
+        .right = static_cast<uint32_t>(layout.padded_length() - layout.pad_config.left - input_length),
+    };
+}
+
+[[nodiscard]] inline ExtensionGatherEntry make_extension_gather_entry(const ExtendedIndex& extended) noexcept {
+    ExtensionGatherEntry entry{
+        .source_index = extended.source_index,
+        .auxiliary_index = extended.auxiliary_index,
+        .operation = extended.operation,
+        .reflected = extended.reflected,
+    };
+    if (extended.operation == ExtensionOperation::kSmooth) {
+        entry.scale = static_cast<float>(extended.distance);
+    } else if (extended.operation == ExtensionOperation::kAntireflect) {
+        entry.scale = static_cast<float>(extended.period_quotient) * 2.0F;
+    }
+    return entry;
+}
+
+[[nodiscard]] inline ExtensionGatherTable make_extension_gather_table(const ExtensionTableKey key) {
+    TT_FATAL(key.length > 0, "Extension table requires a non-empty signal");
+    TT_FATAL(is_supported_lwt_boundary_mode(key.mode), "Unsupported extension table boundary mode");
+    ExtensionGatherTable table;
+    table.key = key;
+    table.left_halo.reserve(key.left);
+    table.right_halo.reserve(key.right);
+    for (uint32_t h = 0; h < key.left; ++h) {
+        const int64_t index = static_cast<int64_t>(h) - static_cast<int64_t>(key.left);
+        table.left_halo.push_back(make_extension_gather_entry(make_extended_index(key.mode, index, key.length)));
+    }
+    for (uint32_t h = 0; h < key.right; ++h) {
+        const int64_t index = static_cast<int64_t>(key.length) + static_cast<int64_t>(h);
+        table.right_halo.push_back(make_extension_gather_entry(make_extended_index(key.mode, index, key.length)));
+    }
+    return table;
+}
+
+template <typename SourceReader>
+[[nodiscard]] inline float evaluate_extension_gather_entry(
+    const ExtensionGatherEntry& entry, const uint32_t length, const SourceReader& read_source) noexcept {
+    switch (entry.operation) {
+        case ExtensionOperation::kZero: return 0.0F;
+        case ExtensionOperation::kSample: return read_source(entry.source_index);
+        case ExtensionOperation::kNegatedSample: return -read_source(entry.source_index);
+        case ExtensionOperation::kSmooth: {
+            const float edge = read_source(entry.source_index);
+            return edge + entry.scale * (edge - read_source(entry.auxiliary_index));
+        }
+        case ExtensionOperation::kAntireflect: {
+            const float source = read_source(entry.source_index);
+            const float first = read_source(0);
+            const float last = read_source(length - 1U);
+            const float base = entry.reflected ? 2.0F * last - source : source;
+            return base + entry.scale * (last - first);
+        }
+    }
+    return 0.0F;
+}
+
+/**
+ * Fill `output[i]` with extended sample `first + stride * i` of `input`.
+ *
+ * The window splits into a left halo, a strided copy of signal samples and
+ * a right halo; halo samples come from `table`, so the gather does no index
+ * decomposition. The window must lie inside the table's halos.
+ */
+inline void gather_from_extension_table(
+    const ExtensionGatherTable& table,
+    const std::span<const float> input,
+    const int64_t first,
+    const size_t stride,
+    const std::span<float> output) {
+    if (output.empty()) {
+        return;
+    }
+    const int64_t length = table.key.length;
+    const int64_t signed_stride = static_cast<int64_t>(stride);
+    const int64_t last = first + signed_stride * static_cast<int64_t>(output.size() - 1);
+    TT_FATAL(input.size() == table.key.length, "Extension table for {} samples read {}", length, input.size());
+    TT_FATAL(
+        first >= -static_cast<int64_t>(table.key.left) && last < length + static_cast<int64_t>(table.key.right),
+        "Extended window [{}, {}] exceeds the table halos of {} and {} samples",
+        first,
+        last,
+        table.key.left,
+        table.key.right);
+
+    // Number of leading outputs whose extended index lies below `bound`.
+    const auto outputs_below = [&](const int64_t bound) -> size_t {
+        if (bound <= first) {
+            return 0;
+        }
+        return std::min(output.size(), static_cast<size_t>((bound - first + signed_stride - 1) / signed_stride));
+    };
+    const size_t signal_begin = outputs_below(0);
+    const size_t signal_end = std::max(signal_begin, outputs_below(length));
+    const auto read_source = [input](const uint32_t index) { return input[index]; };
+    for (size_t i = 0; i < signal_begin; ++i) {
+        const int64_t index = first + signed_stride * static_cast<int64_t>(i);
+        output[i] = evaluate_extension_gather_entry(
+            table.left_halo[static_cast<size_t>(index + table.key.left)], table.key.length, read_source);
+    }
+    if (signal_end > signal_begin) {
+        const float* const source = input.data() + (first + signed_stride * static_cast<int64_t>(signal_begin));
+        for (size_t i = signal_begin; i < signal_end; ++i) {
+            output[i] = source[(i - signal_begin) * stride];
+        }
+    }
+    for (size_t i = signal_end; i < output.size(); ++i) {
+        const int64_t index = first + signed_stride * static_cast<int64_t>(i);
+        output[i] = evaluate_extension_gather_entry(
+            table.right_halo[static_cast<size_t>(index - length)], table.key.length, read_source);
+    }
+}
+
+/**
+ * Caller-owned tables for repeated transforms, built once per key on first
+ * use and kept for the kCapacity most recently used keys.
+ *
+ * Workspaces reused across bucketed or incrementally replanned lengths see a
+ * new key per length, so a miss on a full cache rebuilds the least recently
+ * used table in place. A returned reference stays valid until kCapacity
+ * other keys have been looked up; the executors use one table per chunk
+ * load, and a cascade one per level.
+ */
+struct ExtensionTableCache {
+    static constexpr size_t kCapacity = 8;
+
+    struct Entry {
+        ExtensionGatherTable table{};
+        uint64_t last_use{0};
+    };
+    std::deque<Entry> entries;
+    uint64_t clock{0};
+
+    [[nodiscard]] const ExtensionGatherTable& at(const ExtensionTableKey key) {
+        ++clock;
+        for (Entry& entry : entries) {
+            if (entry.table.key == key) {
+                entry.last_use = clock;
+                return entry.table;
+            }
+        }
+        if (entries.size() < kCapacity) {
+            return entries.emplace_back(Entry{.table = make_extension_gather_table(key), .last_use = clock}).table;
+        }
+        Entry& victim = *std::min_element(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+            return lhs.last_use < rhs.last_use;
+        });
+        victim = Entry{.table = make_extension_gather_table(key), .last_use = clock};
+        return victim.table;
+    }
+};
+
+}  // namespace ttwv
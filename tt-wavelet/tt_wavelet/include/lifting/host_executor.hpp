@@ -0,0 +1,726 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/signal_extension.hpp"
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/cascade_plan.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/extension_table.hpp"
+#include "tt_wavelet/include/lifting/segmented_plan.hpp"
+#include "tt_wavelet/include/lifting/static_plan.hpp"
+#include "tt_wavelet/include/lifting/static_scheme.hpp"
+
+namespace ttwv {
+
+/**
+ * Coefficients consumed by one executable chunk route.
+ *
+ * Entries are aligned with `LwtChunkPlan::routes`: swaps are metadata only
+ * and the terminal scale folded into the last predict/update is carried as
+ * `output_scale` instead of a separate entry, exactly as on device.
+ * `palindromic` routes evaluate the folded stencil of is_palindromic_step.
+ */
+struct HostRouteCoefficients {
+    StepType type{StepType::kPredict};
+    uint32_t k{0};
+    std::array<float, device_protocol::kStepCoeffCapacity> coefficients{};
+    float output_scale{1.0F};
+    bool palindromic{false};
+};
+
+// Runtime counterpart of is_palindromic_step for coefficients read as data.
+[[nodiscard]] inline bool has_palindromic_taps(const HostRouteCoefficients& step) noexcept {
+    if (!is_predict_update_step(step.type) || step.k < 2) {
+        return false;
+    }
+    for (uint32_t j = 0; j < step.k / 2; ++j) {
+        if (std::bit_cast<uint32_t>(step.coefficients[j]) !=
+            std::bit_cast<uint32_t>(step.coefficients[step.k - 1 - j])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Reusable per-thread storage for the three workspace slots of one chunk.
+ */
+struct HostLwtWorkspace {
+    std::array<std::vector<float>, 3> slots;
+    // Halo tables of the lengths this workspace has transformed.
+    ExtensionTableCache extension_tables;
+
+    [[nodiscard]] std::vector<float>& at(const StorageSlot slot) noexcept { return slots[static_cast<size_t>(slot)]; }
+};
+
+namespace host_executor_detail {
+
+template <typename Scheme, size_t Index = 0>
+void append_scheme_coefficients(std::vector<HostRouteCoefficients>& steps) {
+    if constexpr (Index < Scheme::num_steps) {
+        using Step = SchemeStep<Scheme, Index>;
+        static_assert(!is_rounded_step(Step::type), "Rounded integer steps run on the integer host executor");
+        if constexpr (Step::type != StepType::kSwap) {
+            HostRouteCoefficients step{.type = Step::type, .k = Step::k, .palindromic = is_palindromic_step<Step>()};
+            for (size_t j = 0; j < Step::k; ++j) {
+                step.coefficients[j] = std::bit_cast<float>(Step::coeff_bits[j]);
+            }
+            steps.push_back(step);
+        }
+        append_scheme_coefficients<Scheme, Index + 1>(steps);
+    }
+}
+
+[[nodiscard]] inline float read_extended(
+    const std::span<const float> input, const BoundaryMode mode, const int64_t padded_index, const uint32_t left_pad) {
+    const uint32_t length = static_cast<uint32_t>(input.size());
+    const ExtendedIndex extended = make_extended_index(mode, padded_index - static_cast<int64_t>(left_pad), length);
+    return evaluate_extended_index(extended, length, [input](const uint32_t index) { return input[index]; });
+}
+
+/**
+ * Read sample `index` of the boundary-extended signal for any 64-bit length.
+ *
+ * Lengths that fit the 32-bit helpers go through make_extended_index; longer
+ * signals use the same period decomposition and float expressions in 64-bit
+ * coordinates, so both paths agree bit for bit.
+ */
+[[nodiscard]] inline float read_extended_sample(
+    const std::span<const float> input, const BoundaryMode mode, const int64_t index) {
+    const uint64_t length = input.size();
+    if (index >= 0 && static_cast<uint64_t>(index) < length) {
+        return input[static_cast<size_t>(index)];
+    }
+    if (length <= std::numeric_limits<uint32_t>::max()) {
+        const uint32_t narrow_length = static_cast<uint32_t>(length);
+        return evaluate_extended_index(
+            make_extended_index(mode, index, narrow_length), narrow_length, [input](const uint32_t source) {
+                return input[source];
+            });
+    }
+
+    const uint64_t last = length - 1;
+    switch (mode) {
+        case BoundaryMode::kZero: return 0.0F;
+        case BoundaryMode::kConstant: return input[index < 0 ? 0 : last];
+        case BoundaryMode::kPeriodic: return input[decompose_extension_period(index, length).remainder];
+        case BoundaryMode::kPeriodization:
+            return input[std::min(decompose_extension_period(index, length + length % 2).remainder, last)];
+        case BoundaryMode::kSymmetric: {
+            const uint64_t phase = decompose_extension_period(index, 2 * length).remainder;
+            return input[phase < length ? phase : 2 * length - 1 - phase];
+        }
+        case BoundaryMode::kAntisymmetric: {
+            const uint64_t phase = decompose_extension_period(index, 4 * length).remainder;
+            if (phase < length) {
+                return input[phase];
+            }
+            if (phase < 2 * length) {
+                return -input[2 * length - 1 - phase];
+            }
+            if (phase < 3 * length) {
+                return input[phase - 2 * length];
+            }
+            return -input[4 * length - 1 - phase];
+        }
+        case BoundaryMode::kSmooth: {
+            const bool left = index < 0;
+            const uint64_t distance =
+                left ? static_cast<uint64_t>(-(index + 1)) + 1 : static_cast<uint64_t>(index) - last;
+            const float edge = input[left ? 0 : last];
+            const float neighbor = input[left ? 1 : last - 1];
+            return edge + static_cast<float>(distance) * (edge - neighbor);
+        }
+        case BoundaryMode::kReflect: {
+            const uint64_t phase = decompose_extension_period(index, 2 * last).remainder;
+            return input[phase <= last ? phase : 2 * last - phase];
+        }
+        case BoundaryMode::kAntireflect: {
+            const SignedExtensionPeriod mapped = decompose_extension_period(index, 2 * last);
+            const bool reflected = mapped.remainder > last;
+            const float source = input[reflected ? 2 * last - mapped.remainder : mapped.remainder];
+            const float base = reflected ? 2.0F * input[last] - source : source;
+            return base + (static_cast<float>(mapped.quotient) * 2.0F) * (input[last] - input[0]);
+        }
+    }
+    return 0.0F;
+}
+
+/**
+ * Fill `output[i]` with sample `first + stride * i` of the boundary-extended
+ * signal, one extension run at a time.
+ *
+ * Each run is narrowed to the samples the stride selects and then filled as
+ * a copy, reversed copy or fill where it reads plain samples, or through
+ * evaluate_extension_run otherwise; the values match read_extended_sample.
+ */
+inline void gather_extended(
+    const std::span<const float> input,
+    const BoundaryMode mode,
+    const int64_t first,
+    const size_t stride,
+    const std::span<float> output) {
+    if (output.empty()) {
+        return;
+    }
+    const int64_t signed_stride = static_cast<int64_t>(stride);
+    const int64_t end = first + signed_stride * static_cast<int64_t>(output.size() - 1) + 1;
+    for_each_extension_run(mode, first, end, input.size(), [&](ExtensionRun run) {
+        // First selected sample at or after the run start, and its offset.
+        const size_t begin = static_cast<size_t>((run.begin - first + signed_stride - 1) / signed_stride);
+        const uint64_t skip = static_cast<uint64_t>(first + signed_stride * static_cast<int64_t>(begin) - run.begin);
+        if (skip >= run.length) {
+            return;
+        }
+        const int64_t advance = static_cast<int64_t>(run.step) * static_cast<int64_t>(skip);
+        // Smooth runs extrapolate from a fixed edge; only their distance moves.
+        if (run.operation == ExtensionOperation::kSmooth) {
+            run.distance += static_cast<uint64_t>(advance);
+        } else {
+            run.source_index += static_cast<uint64_t>(advance);
+        }
+        run.length = (run.length - skip + stride - 1) / stride;
+        run.step *= static_cast<int32_t>(stride);
+        float* const destination = output.data() + begin;
+        if (run.operation == ExtensionOperation::kSample && (run.step == 1 || run.step == 0 || run.step == -1)) {
+            const float* const source = input.data() + run.source_index;
+            if (run.step == 1) {
+                std::copy_n(source, run.length, destination);
+            } else if (run.step == 0) {
+                std::fill_n(destination, run.length, *source);
+            } else {
+                std::reverse_copy(source + 1 - run.length, source + 1, destination);
+            }
+            return;
+        }
+        evaluate_extension_run(
+            run,
+            input.size(),
+            [input](const uint64_t index) { return input[index]; },
+            [destination](const uint64_t t, const float value) { destination[t] = value; });
+    });
+}
+
+// Interior chunks read plain samples; edge chunks gather their halo from the
+// precomputed table of the signal's key.
+inline void load_initial_stream(
+    std::vector<float>& slot,
+    const IndexInterval interval,
+    const size_t phase,
+    const std::span<const float> input,
+    const ExtensionGatherTable& table,
+    const bool interior) {
+    const int64_t first = static_cast<int64_t>(2 * interval.begin + phase) - static_cast<int64_t>(table.key.left);
+    if (interior) {
+        const float* const source = input.data() + first;
+        for (size_t i = 0; i < interval.length(); ++i) {
+            slot[i] = source[2 * i];
+        }
+        return;
+    }
+    gather_from_extension_table(table, input, first, 2, std::span<float>{slot.data(), interval.length()});
+}
+
+inline void store_final(const std::span<float> output, const size_t offset, const size_t index, const float value) {
+    // The writer clips at the logical output length, so bucketed plans may
+    // compute terminal samples that the caller never reads.
+    if (offset + index < output.size()) {
+        output[offset + index] = value;
+    }
+}
+
+/**
+ * Run the routes of one chunk over the three workspace slots, whose initial
+ * streams are already loaded. Terminal samples go to
+ * `store_terminal(storage, output_offset, index, value)`.
+ */
+template <typename StoreTerminal>
+inline void execute_chunk_routes(
+    const LwtRouteTable& route_table,
+    const RouteRange routes,
+    const std::span<const HostRouteCoefficients> coefficients,
+    HostLwtWorkspace& workspace,
+    const StoreTerminal& store_terminal) {
+    for (size_t route_index = 0; route_index < routes.size(); ++route_index) {
+        const LwtStepRoute route = route_table.at(routes, route_index);
+        const HostRouteCoefficients& step = coefficients[route_index];
+        TT_FATAL(step.type == route.type, "Host LWT coefficient set {} has the wrong step type", route_index);
+        const std::vector<float>& source = workspace.at(route.source.slot);
+        const float* source_data = source.data() + route.source_offset_elements;
+        const float* base_data = workspace.at(route.base.slot).data() + route.base_offset_elements;
+        float* workspace_output = route.output.storage == RouteOutputStorage::kWorkspaceSlot
+                                      ? workspace.at(route.output.slot).data()
+                                      : nullptr;
+
+        const auto emit = [&](const size_t i, const float value) {
+            if (workspace_output != nullptr) {
+                workspace_output[i] = value;
+            } else {
+                store_terminal(route.output.storage, route.output_offset_elements, i, value);
+            }
+        };
+        if (step.palindromic) {
+            // Taps j and k-1-j are equal, so each pair shares one multiply.
+            const uint32_t pairs = step.k / 2;
+            const bool middle = (step.k & 1U) != 0;
+            for (size_t i = 0; i < route.output_length; ++i) {
+                float value = base_data[i];
+                for (uint32_t j = 0; j < pairs; ++j) {
+                    value += step.coefficients[j] * (source_data[i + step.k - 1 - j] + source_data[i + j]);
+                }
+                if (middle) {
+                    value += step.coefficients[pairs] * source_data[i + pairs];
+                }
+                emit(i, value * step.output_scale);
+            }
+            continue;
+        }
+        for (size_t i = 0; i < route.output_length; ++i) {
+            float value = 0.0F;
+            if (is_predict_update_step(route.type)) {
+                // The reader left-pads by 17-K so the newest source sample
+                // meets h[0]; the stencil is therefore a true convolution.
+                value = base_data[i];
+                for (uint32_t j = 0; j < step.k; ++j) {
+                    value += step.coefficients[j] * source_data[i + step.k - 1 - j];
+                }
+                value *= step.output_scale;
+            } else {
+                value = source_data[i] * step.coefficients[0];
+            }
+            emit(i, value);
+        }
+    }
+}
+
+template <size_t Phase, size_t StreamLength, uint32_t LeftPad, BoundaryMode Mode, size_t Length>
+inline void load_static_initial_stream(float* slot, const std::span<const float, Length> input) {
+    // Samples whose padded index lands inside the signal are copied
+    // directly; only the edge samples go through the boundary extension.
+    constexpr size_t raw_begin = LeftPad >= Phase ? (LeftPad - Phase + 1) / 2 : 0;
+    constexpr size_t interior_end = std::min(StreamLength, (Length + LeftPad - Phase + 1) / 2);
+    constexpr size_t interior_begin = std::min(raw_begin, interior_end);
+    for (size_t i = 0; i < interior_begin; ++i) {
+        slot[i] = read_extended(input, Mode, static_cast<int64_t>(2 * i + Phase), LeftPad);
+    }
+    for (size_t i = interior_begin; i < interior_end; ++i) {
+        slot[i] = input[2 * i + Phase - LeftPad];
+    }
+    for (size_t i = interior_end; i < StreamLength; ++i) {
+        slot[i] = read_extended(input, Mode, static_cast<int64_t>(2 * i + Phase), LeftPad);
+    }
+}
+
+template <typename Scheme, size_t Length, BoundaryMode Mode, size_t Index>
+inline void execute_static_route(
+    const std::span<float> approximation, const std::span<float> detail, HostLwtWorkspace& workspace) {
+    using Step = SchemeStep<Scheme, Index>;
+    if constexpr (Step::type != StepType::kSwap) {
+        constexpr const auto& plan = kStaticForwardLiftingPlan<Scheme, Length, Mode>;
+        constexpr LiftingStepRoute route = plan.routes[Index];
+        constexpr std::array<float, Step::k> h = std::bit_cast<std::array<float, Step::k>>(Step::coeff_bits);
+        const float* source = workspace.at(route.source.slot).data() + route.source_offset;
+
+        if constexpr (is_predict_update_step(Step::type)) {
+            static_assert(route.output.storage == RouteOutputStorage::kWorkspaceSlot);
+            const float* base = workspace.at(route.base.slot).data() + route.base_offset;
+            float* output = workspace.at(route.output.slot).data();
+            for (size_t i = 0; i < route.output_length; ++i) {
+                float value = base[i];
+                if constexpr (is_palindromic_step<Step>()) {
+                    for (size_t j = 0; j < Step::k / 2; ++j) {
+                        value += h[j] * (source[i + Step::k - 1 - j] + source[i + j]);
+                    }
+                    if constexpr (Step::k % 2 != 0) {
+                        value += h[Step::k / 2] * source[i + Step::k / 2];
+                    }
+                } else {
+                    for (size_t j = 0; j < Step::k; ++j) {
+                        value += h[j] * source[i + Step::k - 1 - j];
+                    }
+                }
+                output[i] = value;
+            }
+        } else if constexpr (route.output.storage == RouteOutputStorage::kWorkspaceSlot) {
+            float* output = workspace.at(route.output.slot).data();
+            for (size_t i = 0; i < route.output_length; ++i) {
+                output[i] = source[i] * h[0];
+            }
+        } else {
+            // Terminal scales store only the canonical output window.
+            constexpr bool even = route.output.storage == RouteOutputStorage::kFinalEvenDram;
+            constexpr size_t origin = even ? plan.final_even_origin() : plan.final_odd_origin();
+            const std::span<float> final_output = even ? approximation : detail;
+            for (size_t m = 0; m < plan.output_length; ++m) {
+                final_output[m] = source[origin + m] * h[0];
+            }
+        }
+    }
+}
+
+template <typename Scheme, size_t Length, BoundaryMode Mode, size_t... Index>
+inline void execute_static_routes(
+    const std::span<float> approximation,
+    const std::span<float> detail,
+    HostLwtWorkspace& workspace,
+    std::index_sequence<Index...> /*unused*/) {
+    (execute_static_route<Scheme, Length, Mode, Index>(approximation, detail, workspace), ...);
+}
+
+}  // namespace host_executor_detail
+
+/**
+ * Resolve the static scheme coefficients for every executable route of
+ * `plan`, in chunk-route order.
+ */
+template <typename Scheme>
+[[nodiscard]] std::vector<HostRouteCoefficients> make_host_lwt_route_coefficients(const LiftingForwardPlan& plan) {
+    std::vector<HostRouteCoefficients> steps;
+    steps.reserve(Scheme::num_steps);
+    host_executor_detail::append_scheme_coefficients<Scheme>(steps);
+
+    const execution_detail::TerminalScaleInline inline_scale = execution_detail::terminal_scale_inline(plan);
+    float terminal_scale = 1.0F;
+    for (const HostRouteCoefficients& step : steps) {
+        if (step.type == inline_scale.scale_type) {
+            terminal_scale = step.coefficients[0];
+        }
+    }
+
+    std::vector<HostRouteCoefficients> routes;
+    routes.reserve(steps.size());
+    size_t step_index = 0;
+    for (size_t route_index = 0; route_index < plan.routes.size(); ++route_index) {
+        const StepType type = plan.routes[route_index].type;
+        if (type == StepType::kSwap) {
+            continue;
+        }
+        TT_FATAL(
+            step_index < steps.size() && steps[step_index].type == type,
+            "Host LWT route {} does not match the static scheme step order",
+            route_index);
+        HostRouteCoefficients route = steps[step_index++];
+        if (type == inline_scale.scale_type) {
+            continue;
+        }
+        if (route_index == inline_scale.predict_update_route_index) {
+            route.output_scale = terminal_scale;
+        }
+        routes.push_back(route);
+    }
+    TT_FATAL(step_index == steps.size(), "Host LWT plan does not consume every static scheme step");
+    return routes;
+}
+
+/**
+ * Execute one chunk of a forward execution plan on the host.
+ *
+ * This follows the device data flow: the initial even/odd cones are read
+ * through the boundary extension of the runtime `input`, every route reads
+ * its local source/base windows, and terminal routes store into the
+ * canonical approximation/detail outputs. `input.size()` is the logical
+ * length used by the extension, so it may be shorter than the planned
+ * length when the plan serves a length bucket.
+ */
+inline void execute_lwt_chunk_on_host(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const size_t chunk_index,
+    const std::span<const float> input,
+    const std::span<float> approximation,
+    const std::span<float> detail,
+    HostLwtWorkspace& workspace) {
+    TT_FATAL(chunk_index < plan.chunks.size(), "Host LWT chunk {} is out of range", chunk_index);
+    TT_FATAL(!input.empty(), "Host LWT input must be non-empty");
+    const LwtChunkPlan& chunk = plan.chunks[chunk_index];
+    TT_FATAL(
+        chunk.routes.size() == coefficients.size(),
+        "Host LWT chunk has {} routes but {} coefficient sets",
+        chunk.routes.size(),
+        coefficients.size());
+
+    const size_t slot_elements = std::max<size_t>(plan.workspace_elements, chunk.max_workspace_elements);
+    for (std::vector<float>& slot : workspace.slots) {
+        if (slot.size() < slot_elements) {
+            slot.resize(slot_elements);
+        }
+    }
+
+    const ExtensionGatherTable& table =
+        workspace.extension_tables.at(extension_table_key(plan.full_plan, input.size()));
+    host_executor_detail::load_initial_stream(
+        workspace.at(StorageSlot::kA), chunk.initial_even, 0, input, table, chunk.interior);
+    host_executor_detail::load_initial_stream(
+        workspace.at(StorageSlot::kB), chunk.initial_odd, 1, input, table, chunk.interior);
+
+    host_executor_detail::execute_chunk_routes(
+        plan.route_table,
+        chunk.routes,
+        coefficients,
+        workspace,
+        [&](const RouteOutputStorage storage, const size_t offset, const size_t index, const float value) {
+            host_executor_detail::store_final(
+                storage == RouteOutputStorage::kFinalEvenDram ? approximation : detail, offset, index, value);
+        });
+}
+
+/**
+ * Execute every chunk of `plan` on the host, in chunk order.
+ *
+ * `approximation` and `detail` receive the canonical output prefix; their
+ * sizes select how many terminal samples are stored.
+ */
+inline void execute_lwt_on_host(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const float> input,
+    const std::span<float> approximation,
+    const std::span<float> detail,
+    HostLwtWorkspace& workspace,
+    const size_t chunk_count) {
+    TT_FATAL(chunk_count <= plan.chunks.size(), "Host LWT requested {} chunks from a smaller plan", chunk_count);
+    for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+        execute_lwt_chunk_on_host(plan, coefficients, chunk_index, input, approximation, detail, workspace);
+    }
+}
+
+inline void execute_lwt_on_host(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const float> input,
+    const std::span<float> approximation,
+    const std::span<float> detail) {
+    HostLwtWorkspace workspace;
+    execute_lwt_on_host(plan, coefficients, input, approximation, detail, workspace, plan.chunks.size());
+}
+
+/**
+ * Execute a segmented forward LWT on the host.
+ *
+ * Each segment gathers its window of the extended signal, runs its 32-bit
+ * plan and stores the kept outputs at `output_begin`; the halo samples of
+ * neighbouring windows are read twice, but no output is computed twice.
+ * `coefficients` come from make_host_lwt_route_coefficients for the
+ * scheme, which every segment plan shares.
+ */
+inline void execute_segmented_lwt_on_host(
+    const SegmentedLwtPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const float> input,
+    const std::span<float> approximation,
+    const std::span<float> detail) {
+    TT_FATAL(
+        input.size() == plan.input_length,
+        "Segmented LWT input has {} samples but the plan expects {}",
+        input.size(),
+        plan.input_length);
+    TT_FATAL(
+        approximation.size() >= plan.output_length && detail.size() >= plan.output_length,
+        "Segmented LWT outputs must hold {} samples",
+        plan.output_length);
+
+    HostLwtWorkspace workspace;
+    std::vector<float> window;
+    for (const LwtSegment& segment : plan.segments) {
+        const LwtExecutionPlan& segment_plan = plan.plans[segment.plan_index];
+        std::span<const float> segment_input = input;
+        if (segment.window_length != input.size()) {
+            window.resize(segment.window_length);
+            host_executor_detail::gather_extended(input, plan.boundary_mode, segment.window_begin, 1, window);
+            segment_input = window;
+        }
+        execute_lwt_on_host(
+            segment_plan,
+            coefficients,
+            segment_input,
+            approximation.subspan(segment.output_begin, segment.output_length),
+            detail.subspan(segment.output_begin, segment.output_length),
+            workspace,
+            segment_plan.chunks.size());
+    }
+}
+
+/**
+ * Execute a fused LWT cascade on the host.
+ *
+ * Each stage reads its input through the boundary extension: the signal
+ * for the first stage, the previous stage's coarsest approximation after
+ * that. Within a stage a chunk keeps one level buffer, as on device: every
+ * fused level loads its initial cones from the buffer through the level's
+ * own extension and then overwrites it with its computed approximation.
+ * Only owned samples reach `details[level]` and, for the last stage,
+ * `approximation`, so every output is stored exactly once.
+ */
+inline void execute_lwt_cascade_on_host(
+    const LwtCascadePlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const float> input,
+    const std::span<float> approximation,
+    const std::span<const std::span<float>> details) {
+    TT_FATAL(!plan.levels.empty(), "Host LWT cascade has no levels");
+    TT_FATAL(
+        input.size() == plan.levels.front().preprocess_layout.input.length,
+        "Host LWT cascade input has {} samples but the plan expects {}",
+        input.size(),
+        plan.levels.front().preprocess_layout.input.length);
+    TT_FATAL(
+        details.size() == plan.levels.size(),
+        "Host LWT cascade needs {} detail outputs, got {}",
+        plan.levels.size(),
+        details.size());
+    for (size_t level = 0; level < plan.levels.size(); ++level) {
+        TT_FATAL(
+            details[level].size() >= plan.levels[level].output_length,
+            "Host LWT cascade level {} detail must hold {} samples",
+            level + 1,
+            plan.levels[level].output_length);
+    }
+    TT_FATAL(
+        approximation.size() >= plan.levels.back().output_length,
+        "Host LWT cascade approximation must hold {} samples",
+        plan.levels.back().output_length);
+
+    HostLwtWorkspace workspace;
+    std::vector<float> level_buffer;
+    std::vector<float> stage_input;
+    std::vector<float> stage_output;
+    std::span<const float> current_input = input;
+    for (size_t stage_index = 0; stage_index < plan.stages.size(); ++stage_index) {
+        const LwtCascadeStage& stage = plan.stages[stage_index];
+        const bool last_stage = stage_index + 1 == plan.stages.size();
+        const size_t top_level = stage.first_level + stage.level_count - 1;
+        stage_output.resize(last_stage ? 0 : plan.levels[top_level].output_length);
+        const std::span<float> top_output = last_stage ? approximation : std::span<float>{stage_output};
+        level_buffer.resize(stage.level_buffer_elements);
+        for (std::vector<float>& slot : workspace.slots) {
+            slot.resize(std::max<size_t>(slot.size(), stage.workspace_elements));
+        }
+
+        for (size_t chunk_index = 0; chunk_index < stage.chunk_count(); ++chunk_index) {
+            for (uint32_t level = 0; level < stage.level_count; ++level) {
+                const LwtCascadeChunkLevel& chunk_level = stage.at(chunk_index, level);
+                TT_FATAL(
+                    chunk_level.chunk.routes.size() == coefficients.size(),
+                    "Host LWT cascade chunk has {} routes but {} coefficient sets",
+                    chunk_level.chunk.routes.size(),
+                    coefficients.size());
+                const LiftingForwardPlan& level_plan = plan.levels[stage.first_level + level];
+                const uint32_t level_input_length = static_cast<uint32_t>(level_plan.preprocess_layout.input.length);
+                const IndexInterval buffered = level == 0 ? IndexInterval{} : stage.at(chunk_index, level - 1).computed;
+                const auto read_source = [&](const uint32_t index) {
+                    if (level == 0) {
+                        return current_input[index];
+                    }
+                    TT_FATAL(
+                        buffered.begin <= index && index < buffered.end,
+                        "Cascade level {} reads sample {} outside its level buffer",
+                        stage.first_level + level + 1,
+                        index);
+                    return level_buffer[index - buffered.begin];
+                };
+                // Every chunk of a level shares the level's halo table.
+                const ExtensionGatherTable& table = workspace.extension_tables.at(
+                    extension_table_key(level_plan, level_input_length));
+                const auto load = [&](std::vector<float>& slot, const IndexInterval interval, const size_t phase) {
+                    for (size_t i = 0; i < interval.length(); ++i) {
+                        const int64_t logical = static_cast<int64_t>(2 * (interval.begin + i) + phase) -
+                                                static_cast<int64_t>(table.key.left);
+                        if (chunk_level.chunk.interior || (logical >= 0 && logical < level_input_length)) {
+                            slot[i] = read_source(static_cast<uint32_t>(logical));
+                        } else {
+                            const ExtensionGatherEntry& entry =
+                                logical < 0 ? table.left_halo[static_cast<size_t>(logical + table.key.left)]
+                                            : table.right_halo[static_cast<size_t>(logical - level_input_length)];
+                            slot[i] = evaluate_extension_gather_entry(entry, level_input_length, read_source);
+                        }
+                    }
+                };
+                load(workspace.at(StorageSlot::kA), chunk_level.chunk.initial_even, 0);
+                load(workspace.at(StorageSlot::kB), chunk_level.chunk.initial_odd, 1);
+
+                const bool top = level + 1 == stage.level_count;
+                const std::span<float> detail = details[stage.first_level + level];
+                host_executor_detail::execute_chunk_routes(
+                    stage.route_table,
+                    chunk_level.chunk.routes,
+                    coefficients,
+                    workspace,
+                    [&](const RouteOutputStorage storage, const size_t offset, const size_t index, const float value) {
+                        const size_t output_index = offset + index;
+                        if (storage == RouteOutputStorage::kFinalOddDram) {
+                            if (execution_detail::contains(chunk_level.owned, {output_index, output_index + 1})) {
+                                detail[output_index] = value;
+                            }
+                        } else if (top) {
+                            if (execution_detail::contains(chunk_level.owned, {output_index, output_index + 1})) {
+                                top_output[output_index] = value;
+                            }
+                        } else {
+                            level_buffer[output_index - chunk_level.computed.begin] = value;
+                        }
+                    });
+            }
+        }
+        if (!last_stage) {
+            stage_input.swap(stage_output);
+            current_input = stage_input;
+        }
+    }
+}
+
+/**
+ * Execute the forward LWT of a signal whose length is fixed at compile time.
+ *
+ * Route geometry and coefficients come from kStaticForwardLiftingPlan and
+ * the scheme as constants, so every stencil has a constant tap count and
+ * constant offsets, and the boundary extension is confined to the edges of
+ * the two initial streams. The arithmetic matches execute_lwt_on_host
+ * exactly; the runtime path remains the one for lengths chosen at run time.
+ */
+template <typename Scheme, size_t Length, BoundaryMode Mode = BoundaryMode::kSymmetric>
+void execute_static_lwt_on_host(
+    const std::span<const float, Length> input,
+    const std::span<float> approximation,
+    const std::span<float> detail,
+    HostLwtWorkspace& workspace) {
+    static_assert(rounded_step_count<Scheme>() == 0, "Rounded integer schemes run on the integer host executor");
+    constexpr const auto& plan = kStaticForwardLiftingPlan<Scheme, Length, Mode>;
+    TT_FATAL(
+        approximation.size() >= plan.output_length && detail.size() >= plan.output_length,
+        "Static LWT outputs must hold {} samples",
+        plan.output_length);
+
+    constexpr size_t slot_elements = plan.workspace_elements();
+    for (std::vector<float>& slot : workspace.slots) {
+        if (slot.size() < slot_elements) {
+            slot.resize(slot_elements);
+        }
+    }
+
+    constexpr uint32_t left_pad = plan.preprocess_layout.pad_config.left;
+    host_executor_detail::load_static_initial_stream<0, plan.preprocess_layout.output.even.length, left_pad, Mode>(
+        workspace.at(StorageSlot::kA).data(), input);
+    host_executor_detail::load_static_initial_stream<1, plan.preprocess_layout.output.odd.length, left_pad, Mode>(
+        workspace.at(StorageSlot::kB).data(), input);
+    host_executor_detail::execute_static_routes<Scheme, Length, Mode>(
+        approximation, detail, workspace, std::make_index_sequence<Scheme::num_steps>{});
+}
+
+template <typename Scheme, size_t Length, BoundaryMode Mode = BoundaryMode::kSymmetric>
+void execute_static_lwt_on_host(
+    const std::span<const float, Length> input, const std::span<float> approximation, const std::span<float> detail) {
+    HostLwtWorkspace workspace;
+    execute_static_lwt_on_host<Scheme, Length, Mode>(input, approximation, detail, workspace);
+}
+
+}  // namespace ttwv
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/route_table.hpp"
+
+namespace ttwv {
+
+/**
+ * What a replanned 1D executable must rewrite relative to its previous plan.
+ *
+ * Chunks before `first_changed_chunk` keep their chunk page, route pages and
+ * compute arguments word for word. Reader and writer arguments carry the input
+ * and output lengths, so they change on every core whenever the length does.
+ * A different chunk count moves chunk boundaries between cores and a
+ * different workspace size moves the tile mirror offset; either one, or a
+ * full rebuild, invalidates every runtime argument.
+ */
+struct LwtPlanDelta {
+    size_t previous_chunk_count{0};
+    size_t chunk_count{0};
+    size_t first_changed_chunk{0};
+    size_t route_count{0};
+    bool full_rebuild{false};
+    bool chunk_count_changed{false};
+    bool workspace_changed{false};
+    bool input_length_changed{false};
+
+    [[nodiscard]] constexpr size_t reused_chunk_count() const noexcept { return first_changed_chunk; }
+    [[nodiscard]] constexpr size_t changed_chunk_count() const noexcept { return chunk_count - first_changed_chunk; }
+    [[nodiscard]] constexpr bool chunk_changed(const size_t chunk_index) const noexcept {
+        return chunk_index >= first_changed_chunk;
+    }
+
+    // Every core needs new runtime arguments, not only those of changed chunks.
+    [[nodiscard]] constexpr bool runtime_layout_changed() const noexcept {
+        return full_rebuild || chunk_count_changed || workspace_changed;
+    }
+
+    // Compute arguments of a core holding chunks [chunk_begin, chunk_begin + chunk_count).
+    [[nodiscard]] constexpr bool compute_args_changed(
+        const size_t core_chunk_begin, const size_t core_chunk_count) const noexcept {
+        return runtime_layout_changed() ||
+               (core_chunk_count > 0 && chunk_changed(core_chunk_begin + core_chunk_count - 1));
+    }
+
+    // Chunk pages, then (chunk, route) pages, that must be uploaded again.
+    [[nodiscard]] constexpr IndexInterval chunk_pages() const noexcept {
+        return IndexInterval{.begin = first_changed_chunk, .end = chunk_count};
+    }
+    [[nodiscard]] constexpr IndexInterval route_pages() const noexcept {
+        return IndexInterval{.begin = first_changed_chunk * route_count, .end = chunk_count * route_count};
+    }
+};
+
+struct LwtReplan {
+    LwtExecutionPlan plan{};
+    LwtPlanDelta delta{};
+};
+
+namespace incremental_detail {
+
+/**
+ * A new length keeps every chunk cone of the previous plan when the boundary
+ * extension, terminal shifts and route offsets all match: chunk geometry is
+ * then a function of the canonical output interval alone.
+ */
+[[nodiscard]] inline bool same_chunk_geometry(const LiftingForwardPlan& lhs, const LiftingForwardPlan& rhs) {
+    const Pad1DConfig& lhs_pad = lhs.preprocess_layout.pad_config;
+    const Pad1DConfig& rhs_pad = rhs.preprocess_layout.pad_config;
+    if (lhs_pad.mode != rhs_pad.mode || lhs_pad.left != rhs_pad.left || lhs_pad.right != rhs_pad.right ||
+        lhs.final_even_shift != rhs.final_even_shift || lhs.final_odd_shift != rhs.final_odd_shift ||
+        lhs.routes.size() != rhs.routes.size()) {
+        return false;
+    }
+    return std::equal(lhs.routes.begin(), lhs.routes.end(), rhs.routes.begin(), same_route_geometry);
+}
+
+[[nodiscard]] inline LwtReplan rebuild(
+    const LwtExecutionPlan& previous,
+    LiftingForwardPlan full_plan,
+    const uint32_t core_limit,
+    const uint32_t l1_signal_budget_bytes) {
+    const bool input_length_changed =
+        full_plan.preprocess_layout.input.length != previous.full_plan.preprocess_layout.input.length;
+    LwtExecutionPlan plan = make_lwt_execution_plan(
+        std::move(full_plan), core_limit, l1_signal_budget_bytes, previous.workspace_layout, previous.page_geometry);
+    const LwtPlanDelta delta{
+        .previous_chunk_count = previous.chunks.size(),
+        .chunk_count = plan.chunks.size(),
+        .first_changed_chunk = 0,
+        .route_count = execution_detail::chunk_route_count(plan.full_plan),
+        .full_rebuild = true,
+        .chunk_count_changed = plan.chunks.size() != previous.chunks.size(),
+        .workspace_changed = plan.workspace_elements != previous.workspace_elements,
+        .input_length_changed = input_length_changed,
+    };
+    return LwtReplan{.plan = std::move(plan), .delta = delta};
+}
+
+}  // namespace incremental_detail
+
+/**
+ * Replan a full-window 1D executable for a new input length.
+ *
+ * Chunks whose canonical outputs end on a whole group inside the new output
+ * keep their cones: dependency intervals grow monotonically with the chunk's
+ * last output, and the new tail chunk needs a cone at least as far right, so
+ * every kept cone still fits the new streams. Their routes are copied, not
+ * re-derived. The previous tail chunk and any outputs past it are rebuilt
+ * with at most the previous groups per chunk, so the workspace bound holds
+ * unless the new tail needs a wider cone.
+ *
+ * Lengths that change the route geometry (different terminal shifts or
+ * offsets) and tails that overflow the L1 budget fall back to a full
+ * rebuild, reported as such in the delta. Windowed plans are not replanned.
+ */
+[[nodiscard]] inline LwtReplan replan_lwt_execution_plan(
+    const LwtExecutionPlan& previous,
+    LiftingForwardPlan full_plan,
+    const uint32_t core_limit,
+    const uint32_t l1_signal_budget_bytes) {
+    TT_FATAL(core_limit > 0, "LWT requires at least one worker core");
+    TT_FATAL(
+        previous.output_window.begin == 0 && previous.output_window.end == previous.full_plan.output_length,
+        "Incremental LWT replanning requires a full-window plan, got window [{}, {}) of {} outputs",
+        previous.output_window.begin,
+        previous.output_window.end,
+        previous.full_plan.output_length);
+    if (previous.chunks.empty() || !incremental_detail::same_chunk_geometry(previous.full_plan, full_plan)) {
+        return incremental_detail::rebuild(previous, std::move(full_plan), core_limit, l1_signal_budget_bytes);
+    }
+
+    apply_page_geometry(full_plan.preprocess_layout, previous.page_geometry);
+    const size_t group = previous.page_geometry.group_output_elements();
+    const size_t output_length = full_plan.output_length;
+    const int64_t canonical_start = static_cast<int64_t>(full_plan.preprocess_layout.pad_config.left + 1) / 2;
+    const size_t final_even_origin = static_cast<size_t>(canonical_start - full_plan.final_even_shift);
+    const size_t final_odd_origin = static_cast<size_t>(canonical_start - full_plan.final_odd_shift);
+
+    // The previous tail chunk is always rebuilt, so growth fills it first.
+    size_t reused_chunk_count = 0;
+    size_t reused_outputs = 0;
+    size_t reused_max_workspace_elements = 0;
+    for (size_t chunk_index = 0; chunk_index + 1 < previous.chunks.size(); ++chunk_index) {
+        const LwtChunkPlan& chunk = previous.chunks[chunk_index];
+        const size_t chunk_end = chunk.final_even.end - final_even_origin;
+        // Kept chunk pages keep their interior flag too, so a chunk whose cone
+        // now crosses the right edge of the signal, or no longer does, is rebuilt.
+        if (chunk_end > output_length || chunk_end % group != 0 ||
+            chunk.interior != execution_detail::initial_cone_is_interior(
+                                  full_plan, chunk.initial_even, chunk.initial_odd)) {
+            break;
+        }
+        reused_chunk_count = chunk_index + 1;
+        reused_outputs = chunk_end;
+        reused_max_workspace_elements = std::max(reused_max_workspace_elements, chunk.max_workspace_elements);
+    }
+
+    const size_t groups_per_chunk = std::max<size_t>(previous.groups_per_chunk, 1);
+    const size_t remaining_groups = ceil_div(output_length - reused_outputs, group);
+    const size_t rebuilt_chunk_count =
+        reused_chunk_count == 0 ? std::max<size_t>(ceil_div(remaining_groups, groups_per_chunk), 1)
+                                : ceil_div(remaining_groups, groups_per_chunk);
+    const size_t chunk_count = reused_chunk_count + rebuilt_chunk_count;
+    const size_t route_count = execution_detail::chunk_route_count(full_plan);
+
+    LwtRouteTable route_table = make_lwt_route_table(chunk_count * route_count);
+    std::vector<LwtChunkPlan> chunks;
+    chunks.reserve(chunk_count);
+    if (reused_chunk_count > 0) {
+        const RouteRange reused_routes = route_table.append(
+            previous.route_table, RouteRange{.begin = 0, .count = reused_chunk_count * route_count});
+        TT_FATAL(
+            previous.chunks[reused_chunk_count - 1].routes.begin + route_count == reused_routes.count,
+            "LWT route table rows are not in chunk order");
+        chunks.assign(previous.chunks.begin(), previous.chunks.begin() + reused_chunk_count);
+    }
+
+    std::array<std::byte, execution_detail::kChunkScratchBytes> scratch_buffer;
+    std::pmr::monotonic_buffer_resource scratch{scratch_buffer.data(), scratch_buffer.size()};
+    size_t max_workspace_elements = reused_max_workspace_elements;
+    size_t max_groups = reused_chunk_count == 0 ? 0 : groups_per_chunk;
+    size_t output_begin = reused_outputs;
+    for (size_t chunk_index = 0; chunk_index < rebuilt_chunk_count; ++chunk_index) {
+        const size_t group_count =
+            remaining_groups / rebuilt_chunk_count + (chunk_index < remaining_groups % rebuilt_chunk_count ? 1 : 0);
+        const size_t output_end = std::min(output_begin + group_count * group, output_length);
+        chunks.push_back(execution_detail::build_chunk(
+            full_plan,
+            IndexInterval{.begin = output_begin + final_even_origin, .end = output_end + final_even_origin},
+            IndexInterval{.begin = output_begin + final_odd_origin, .end = output_end + final_odd_origin},
+            final_even_origin,
+            final_odd_origin,
+            route_table,
+            &scratch));
+        scratch.release();
+        max_workspace_elements = std::max(max_workspace_elements, chunks.back().max_workspace_elements);
+        max_groups = std::max(max_groups, group_count);
+        output_begin = output_end;
+    }
+    TT_FATAL(output_begin == output_length, "Replanned LWT chunks do not cover every final output group");
+
+    const size_t workspace_alignment = previous.workspace_layout == WorkspaceLayout::kTileNative
+                                           ? group
+                                           : static_cast<size_t>(previous.page_geometry.stick_width);
+    const size_t workspace_elements = round_up(max_workspace_elements, workspace_alignment);
+    if (previous.page_geometry.workspace_bytes(workspace_elements) > l1_signal_budget_bytes ||
+        workspace_elements > static_cast<size_t>(std::numeric_limits<uint32_t>::max())) {
+        return incremental_detail::rebuild(previous, std::move(full_plan), core_limit, l1_signal_budget_bytes);
+    }
+
+    double max_dependency_overhead = 0.0;
+    for (const LwtChunkPlan& chunk : chunks) {
+        max_dependency_overhead = std::max(max_dependency_overhead, chunk.dependency_overhead);
+    }
+    const LwtPlanDelta delta{
+        .previous_chunk_count = previous.chunks.size(),
+        .chunk_count = chunks.size(),
+        .first_changed_chunk = reused_chunk_count,
+        .route_count = route_count,
+        .full_rebuild = false,
+        .chunk_count_changed = chunks.size() != previous.chunks.size(),
+        .workspace_changed = workspace_elements != previous.workspace_elements,
+        .input_length_changed =
+            full_plan.preprocess_layout.input.length != previous.full_plan.preprocess_layout.input.length,
+    };
+    const uint32_t active_core_count = static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit)));
+    return LwtReplan{
+        .plan =
+            LwtExecutionPlan{
+                .full_plan = std::move(full_plan),
+                .output_window = IndexInterval{.begin = 0, .end = output_length},
+                .chunks = std::move(chunks),
+                .route_table = std::move(route_table),
+                .groups_per_chunk = static_cast<uint32_t>(max_groups),
+                .workspace_elements = static_cast<uint32_t>(workspace_elements),
+                .max_workspace_elements = static_cast<uint32_t>(max_workspace_elements),
+                .active_core_count = active_core_count,
+                .max_dependency_overhead = max_dependency_overhead,
+                .workspace_layout = previous.workspace_layout,
+                .page_geometry = previous.page_geometry,
+            },
+        .delta = delta,
+    };
+}
+
+}  // namespace ttwv
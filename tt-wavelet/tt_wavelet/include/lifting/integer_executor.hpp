@@ -0,0 +1,431 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <vector>
+
+#include "tt_wavelet/include/common/signal_extension.hpp"
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/inverse_plan.hpp"
+#include "tt_wavelet/include/lifting/static_scheme.hpp"
+
+namespace ttwv {
+
+/**
+ * Integer counterpart of HostRouteCoefficients for one chunk route.
+ *
+ * Rounded predict/update routes compute
+ * base + sign * ((sum_j taps[j] * src[n - j] + round_offset) >> round_shift);
+ * scale routes multiply by `output_sign`, and the terminal scale folded into
+ * the last rounded route is carried the same way. Integer schemes only scale
+ * by +1 or -1, so every step stays exactly invertible.
+ */
+struct HostIntegerRouteCoefficients {
+    StepType type{StepType::kRoundedPredict};
+    uint32_t k{0};
+    std::array<int32_t, device_protocol::kStepCoeffCapacity> taps{};
+    int32_t sign{1};
+    uint32_t round_shift{0};
+    int32_t round_offset{0};
+    int32_t output_sign{1};
+};
+
+/**
+ * Inverse coefficients: the reciprocal terminal scales applied to the loaded
+ * approximation/detail windows and the rounded routes in ILWT chunk order.
+ */
+struct HostIntegerIlwtCoefficients {
+    int32_t approximation_sign{1};
+    int32_t detail_sign{1};
+    std::vector<HostIntegerRouteCoefficients> routes;
+};
+
+/**
+ * Reusable int32 storage for the three workspace slots of one chunk.
+ */
+struct HostIntegerLwtWorkspace {
+    std::array<std::vector<int32_t>, 3> slots;
+
+    [[nodiscard]] std::vector<int32_t>& at(const StorageSlot slot) noexcept {
+        return slots[static_cast<size_t>(slot)];
+    }
+
+    void grow_slots(const size_t elements) {
+        for (std::vector<int32_t>& slot : slots) {
+            if (slot.size() < elements) {
+                slot.resize(elements);
+            }
+        }
+    }
+};
+
+namespace integer_executor_detail {
+
+template <typename Step>
+[[nodiscard]] constexpr int32_t integer_scale_sign() noexcept {
+    static_assert(
+        Step::coeff_bits[0] == 0x3f800000U || Step::coeff_bits[0] == 0xbf800000U,
+        "Integer schemes may only scale by +1 or -1");
+    return Step::coeff_bits[0] == 0x3f800000U ? 1 : -1;
+}
+
+template <typename Scheme, size_t Index = 0>
+void append_scheme_coefficients(std::vector<HostIntegerRouteCoefficients>& steps) {
+    if constexpr (Index < Scheme::num_steps) {
+        using Step = SchemeStep<Scheme, Index>;
+        static_assert(
+            Step::type == StepType::kSwap || is_scale_step(Step::type) || is_rounded_step(Step::type),
+            "Integer schemes use rounded predict/update steps only");
+        if constexpr (is_rounded_step(Step::type)) {
+            HostIntegerRouteCoefficients step{
+                .type = Step::type,
+                .k = Step::k,
+                .sign = Step::sign,
+                .round_shift = Step::round_shift,
+                .round_offset = Step::round_offset,
+            };
+            std::copy(Step::taps.begin(), Step::taps.end(), step.taps.begin());
+            steps.push_back(step);
+        } else if constexpr (is_scale_step(Step::type)) {
+            steps.push_back(
+                HostIntegerRouteCoefficients{.type = Step::type, .k = 1, .output_sign = integer_scale_sign<Step>()});
+        }
+        append_scheme_coefficients<Scheme, Index + 1>(steps);
+    }
+}
+
+/**
+ * Sample `index` of the boundary-extended int32 signal. The smooth and
+ * antireflect extrapolations are evaluated in 64-bit integers; planned pads
+ * are a few taps wide, so they stay within int32 for in-range signals.
+ */
+[[nodiscard]] inline int32_t read_extended_sample(
+    const std::span<const int32_t> input, const BoundaryMode mode, const int64_t index) {
+    if (index >= 0 && static_cast<uint64_t>(index) < input.size()) {
+        return input[static_cast<size_t>(index)];
+    }
+    const uint32_t length = static_cast<uint32_t>(input.size());
+    const ExtendedIndex extended = make_extended_index(mode, index, length);
+    const int64_t first = input.front();
+    const int64_t last = input.back();
+    switch (extended.operation) {
+        case ExtensionOperation::kZero: return 0;
+        case ExtensionOperation::kSample: return input[extended.source_index];
+        case ExtensionOperation::kNegatedSample: return -input[extended.source_index];
+        case ExtensionOperation::kSmooth: {
+            const int64_t edge = input[extended.source_index];
+            return static_cast<int32_t>(
+                edge + static_cast<int64_t>(extended.distance) * (edge - input[extended.auxiliary_index]));
+        }
+        case ExtensionOperation::kAntireflect: {
+            const int64_t source = input[extended.source_index];
+            const int64_t base = extended.reflected ? 2 * last - source : source;
+            return static_cast<int32_t>(base + extended.period_quotient * 2 * (last - first));
+        }
+    }
+    return 0;
+}
+
+inline void load_initial_stream(
+    std::vector<int32_t>& slot,
+    const IndexInterval interval,
+    const size_t phase,
+    const std::span<const int32_t> input,
+    const BoundaryMode mode,
+    const uint32_t left_pad,
+    const bool interior) {
+    const int64_t first = static_cast<int64_t>(2 * interval.begin + phase) - static_cast<int64_t>(left_pad);
+    if (interior) {
+        const int32_t* const source = input.data() + first;
+        for (size_t i = 0; i < interval.length(); ++i) {
+            slot[i] = source[2 * i];
+        }
+        return;
+    }
+    for (size_t i = 0; i < interval.length(); ++i) {
+        slot[i] = read_extended_sample(input, mode, first + static_cast<int64_t>(2 * i));
+    }
+}
+
+/**
+ * Run the rounded and scale routes of one chunk over int32 workspace slots.
+ * Each output is one int32 multiply-add chain, an arithmetic shift and an
+ * add, so the loops vectorise on integer lanes; the stencil sum must fit in
+ * int32, which holds for the small taps of reversible schemes on inputs of
+ * up to 28 bits.
+ */
+template <typename StoreTerminal>
+inline void execute_chunk_routes(
+    const LwtRouteTable& route_table,
+    const RouteRange routes,
+    const std::span<const HostIntegerRouteCoefficients> coefficients,
+    HostIntegerLwtWorkspace& workspace,
+    const StoreTerminal& store_terminal) {
+    for (size_t route_index = 0; route_index < routes.size(); ++route_index) {
+        const LwtStepRoute route = route_table.at(routes, route_index);
+        const HostIntegerRouteCoefficients& step = coefficients[route_index];
+        TT_FATAL(step.type == route.type, "Host integer LWT coefficient set {} has the wrong step type", route_index);
+        const int32_t* source = workspace.at(route.source.slot).data() + route.source_offset_elements;
+        const int32_t* base = workspace.at(route.base.slot).data() + route.base_offset_elements;
+        int32_t* workspace_output = route.output.storage == RouteOutputStorage::kWorkspaceSlot
+                                        ? workspace.at(route.output.slot).data()
+                                        : nullptr;
+        const auto emit = [&](const size_t i, const int32_t value) {
+            if (workspace_output != nullptr) {
+                workspace_output[i] = value;
+            } else {
+                store_terminal(route.output.storage, route.output_offset_elements, i, value);
+            }
+        };
+
+        if (!is_rounded_step(route.type)) {
+            for (size_t i = 0; i < route.output_length; ++i) {
+                emit(i, source[i] * step.output_sign);
+            }
+            continue;
+        }
+        for (size_t i = 0; i < route.output_length; ++i) {
+            int32_t sum = step.round_offset;
+            for (uint32_t j = 0; j < step.k; ++j) {
+                sum += step.taps[j] * source[i + step.k - 1 - j];
+            }
+            emit(i, (base[i] + step.sign * (sum >> step.round_shift)) * step.output_sign);
+        }
+    }
+}
+
+}  // namespace integer_executor_detail
+
+/**
+ * Resolve the rounded steps and ±1 scales of an integer scheme for every
+ * executable route of `plan`, folding the inline terminal scale into the last
+ * rounded route exactly as make_host_lwt_route_coefficients does.
+ */
+template <typename Scheme>
+[[nodiscard]] std::vector<HostIntegerRouteCoefficients> make_host_integer_lwt_route_coefficients(
+    const LiftingForwardPlan& plan) {
+    static_assert(rounded_step_count<Scheme>() > 0, "Integer LWT requires a scheme with rounded steps");
+    std::vector<HostIntegerRouteCoefficients> steps;
+    steps.reserve(Scheme::num_steps);
+    integer_executor_detail::append_scheme_coefficients<Scheme>(steps);
+
+    const execution_detail::TerminalScaleInline inline_scale = execution_detail::terminal_scale_inline(plan);
+    int32_t terminal_sign = 1;
+    for (const HostIntegerRouteCoefficients& step : steps) {
+        if (step.type == inline_scale.scale_type) {
+            terminal_sign = step.output_sign;
+        }
+    }
+
+    std::vector<HostIntegerRouteCoefficients> routes;
+    routes.reserve(steps.size());
+    size_t step_index = 0;
+    for (size_t route_index = 0; route_index < plan.routes.size(); ++route_index) {
+        const StepType type = plan.routes[route_index].type;
+        if (type == StepType::kSwap) {
+            continue;
+        }
+        TT_FATAL(
+            step_index < steps.size() && steps[step_index].type == type,
+            "Host integer LWT route {} does not match the static scheme step order",
+            route_index);
+        HostIntegerRouteCoefficients route = steps[step_index++];
+        if (type == inline_scale.scale_type) {
+            continue;
+        }
+        if (route_index == inline_scale.predict_update_route_index) {
+            route.output_sign = terminal_sign;
+        }
+        routes.push_back(route);
+    }
+    TT_FATAL(step_index == steps.size(), "Host integer LWT plan does not consume every static scheme step");
+    return routes;
+}
+
+/**
+ * Resolve `Scheme::inverse` for an ILWT plan: the two leading reciprocal
+ * scales become load signs and the rounded steps follow in chunk-route order.
+ */
+template <typename Scheme>
+[[nodiscard]] HostIntegerIlwtCoefficients make_host_integer_ilwt_coefficients(const IlwtExecutionPlan& plan) {
+    using InverseScheme = typename Scheme::inverse;
+    static_assert(rounded_step_count<InverseScheme>() > 0, "Integer ILWT requires a scheme with rounded steps");
+    std::vector<HostIntegerRouteCoefficients> steps;
+    steps.reserve(InverseScheme::num_steps);
+    integer_executor_detail::append_scheme_coefficients<InverseScheme>(steps);
+
+    HostIntegerIlwtCoefficients coefficients;
+    for (const HostIntegerRouteCoefficients& step : steps) {
+        if (step.type == StepType::kScaleEven) {
+            coefficients.approximation_sign = step.output_sign;
+        } else if (step.type == StepType::kScaleOdd) {
+            coefficients.detail_sign = step.output_sign;
+        } else {
+            coefficients.routes.push_back(step);
+        }
+    }
+    TT_FATAL(
+        steps.size() == coefficients.routes.size() + 2,
+        "Integer inverse scheme must start with one scale-even and one scale-odd step");
+    TT_FATAL(
+        plan.chunks.empty() || plan.chunks.front().routes.size() == coefficients.routes.size(),
+        "Integer ILWT plan has {} routes but the inverse scheme {} rounded steps",
+        plan.chunks.empty() ? 0 : plan.chunks.front().routes.size(),
+        coefficients.routes.size());
+    return coefficients;
+}
+
+/**
+ * Execute an integer forward LWT on the host, chunk by chunk.
+ *
+ * The data flow is that of execute_lwt_chunk_on_host on int32 slots: the
+ * initial cones are read through the integer boundary extension, every
+ * rounded route reads its local source/base windows, and terminal routes
+ * store the canonical approximation/detail prefix.
+ */
+inline void execute_integer_lwt_on_host(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostIntegerRouteCoefficients> coefficients,
+    const std::span<const int32_t> input,
+    const std::span<int32_t> approximation,
+    const std::span<int32_t> detail,
+    HostIntegerLwtWorkspace& workspace) {
+    const PadSplit1DLayout& layout = plan.full_plan.preprocess_layout;
+    TT_FATAL(
+        input.size() == layout.input.length,
+        "Integer LWT input has {} samples but the plan expects {}",
+        input.size(),
+        layout.input.length);
+    TT_FATAL(
+        input.size() <= std::numeric_limits<uint32_t>::max(),
+        "Integer LWT input of {} samples exceeds uint32_t runtime limits",
+        input.size());
+
+    for (const LwtChunkPlan& chunk : plan.chunks) {
+        TT_FATAL(
+            chunk.routes.size() == coefficients.size(),
+            "Host integer LWT chunk has {} routes but {} coefficient sets",
+            chunk.routes.size(),
+            coefficients.size());
+        workspace.grow_slots(std::max<size_t>(plan.workspace_elements, chunk.max_workspace_elements));
+        integer_executor_detail::load_initial_stream(
+            workspace.at(StorageSlot::kA),
+            chunk.initial_even,
+            0,
+            input,
+            layout.pad_config.mode,
+            layout.pad_config.left,
+            chunk.interior);
+        integer_executor_detail::load_initial_stream(
+            workspace.at(StorageSlot::kB),
+            chunk.initial_odd,
+            1,
+            input,
+            layout.pad_config.mode,
+            layout.pad_config.left,
+            chunk.interior);
+        integer_executor_detail::execute_chunk_routes(
+            plan.route_table,
+            chunk.routes,
+            coefficients,
+            workspace,
+            [&](const RouteOutputStorage storage, const size_t offset, const size_t index, const int32_t value) {
+                const std::span<int32_t> output =
+                    storage == RouteOutputStorage::kFinalEvenDram ? approximation : detail;
+                if (offset + index < output.size()) {
+                    output[offset + index] = value;
+                }
+            });
+    }
+}
+
+inline void execute_integer_lwt_on_host(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostIntegerRouteCoefficients> coefficients,
+    const std::span<const int32_t> input,
+    const std::span<int32_t> approximation,
+    const std::span<int32_t> detail) {
+    HostIntegerLwtWorkspace workspace;
+    execute_integer_lwt_on_host(plan, coefficients, input, approximation, detail, workspace);
+}
+
+/**
+ * Execute an integer inverse LWT on the host, chunk by chunk.
+ *
+ * Each chunk loads its canonical approximation/detail windows with the
+ * reciprocal terminal signs, undoes the rounded routes in reverse scheme
+ * order and interleaves its reconstructed even/odd streams into `output`.
+ * Paired with execute_integer_lwt_on_host it reproduces the input exactly.
+ */
+inline void execute_integer_ilwt_on_host(
+    const IlwtExecutionPlan& plan,
+    const HostIntegerIlwtCoefficients& coefficients,
+    const std::span<const int32_t> approximation,
+    const std::span<const int32_t> detail,
+    const std::span<int32_t> output,
+    HostIntegerLwtWorkspace& workspace) {
+    const LiftingInversePlan& full_plan = plan.full_plan;
+    TT_FATAL(
+        approximation.size() >= full_plan.coefficient_length && detail.size() >= full_plan.coefficient_length,
+        "Integer ILWT coefficients must hold {} samples",
+        full_plan.coefficient_length);
+    TT_FATAL(
+        output.size() >= full_plan.original_length,
+        "Integer ILWT output must hold {} samples",
+        full_plan.original_length);
+
+    const size_t pad = full_plan.forward_trace.preprocess_layout.pad_config.left;
+    const size_t period = ilwt_coefficient_period(full_plan);
+    for (const IlwtChunkPlan& chunk : plan.chunks) {
+        TT_FATAL(
+            chunk.routes.size() == coefficients.routes.size(),
+            "Host integer ILWT chunk has {} routes but {} coefficient sets",
+            chunk.routes.size(),
+            coefficients.routes.size());
+        workspace.grow_slots(std::max<size_t>(plan.workspace_elements, chunk.max_workspace_elements));
+        std::vector<int32_t>& even = workspace.at(StorageSlot::kA);
+        std::vector<int32_t>& odd = workspace.at(StorageSlot::kB);
+        for (size_t i = 0; i < chunk.canonical_approximation.length(); ++i) {
+            even[i] = approximation[(chunk.canonical_approximation.begin + i) % period] *
+                      coefficients.approximation_sign;
+        }
+        for (size_t i = 0; i < chunk.canonical_detail.length(); ++i) {
+            odd[i] = detail[(chunk.canonical_detail.begin + i) % period] * coefficients.detail_sign;
+        }
+        integer_executor_detail::execute_chunk_routes(
+            plan.route_table,
+            chunk.routes,
+            coefficients.routes,
+            workspace,
+            [](RouteOutputStorage, size_t, size_t, int32_t) {
+                TT_THROW("Integer ILWT routes write workspace slots only");
+            });
+
+        const int32_t* const final_even =
+            workspace.at(chunk.final_even.slot).data() + chunk.final_even_offset_elements;
+        const int32_t* const final_odd = workspace.at(chunk.final_odd.slot).data() + chunk.final_odd_offset_elements;
+        for (size_t j = chunk.output_signal.begin; j < chunk.output_signal.end; ++j) {
+            const size_t padded = j + pad;
+            output[j] = padded % 2 == 0 ? final_even[padded / 2 - chunk.reconstructed_even.begin]
+                                        : final_odd[padded / 2 - chunk.reconstructed_odd.begin];
+        }
+    }
+}
+
+inline void execute_integer_ilwt_on_host(
+    const IlwtExecutionPlan& plan,
+    const HostIntegerIlwtCoefficients& coefficients,
+    const std::span<const int32_t> approximation,
+    const std::span<const int32_t> detail,
+    const std::span<int32_t> output) {
+    HostIntegerLwtWorkspace workspace;
+    execute_integer_ilwt_on_host(plan, coefficients, approximation, detail, output, workspace);
+}
+
+}  // namespace ttwv
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory_resource>
 #include <tt_stl/assert.hpp>
 #include <tuple>
 #include <utility>
@@ -22,13 +24,25 @@ struct LiftingInversePlan {
     size_t coefficient_length{0};
 };
 
+/**
+ * Length modulo which an ILWT reads its coefficients. Periodization bands
+ * are periodic in their ceil(N / 2) coefficients, so a chunk near either
+ * end reads past it and wraps. Padded modes never read past their
+ * coefficient buffer, which is the period they report.
+ */
+[[nodiscard]] inline size_t ilwt_coefficient_period(const LiftingInversePlan& plan) noexcept {
+    return plan.forward_trace.preprocess_layout.pad_config.mode == BoundaryMode::kPeriodization
+               ? plan.forward_trace.output_length
+               : plan.coefficient_length;
+}
+
 struct IlwtChunkPlan {
     IndexInterval output_signal{};
     IndexInterval reconstructed_even{};
     IndexInterval reconstructed_odd{};
     IndexInterval canonical_approximation{};
     IndexInterval canonical_detail{};
-    std::vector<LwtStepRoute> routes;
+    RouteRange routes{};
     StreamRef final_even{};
     StreamRef final_odd{};
     size_t final_even_storage_length{0};
@@ -42,6 +56,7 @@ struct IlwtChunkPlan {
 struct IlwtExecutionPlan {
     LiftingInversePlan full_plan{};
     std::vector<IlwtChunkPlan> chunks;
+    LwtRouteTable route_table{};
     uint32_t output_groups_per_chunk{0};
     uint32_t workspace_elements{0};
     uint32_t max_workspace_elements{0};
@@ -105,9 +120,26 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
     return IndexInterval{.begin = static_cast<size_t>(begin), .end = static_cast<size_t>(end)};
 }
 
-[[nodiscard]] inline std::vector<RequiredStreams> propagate_requirements(
-    const LiftingForwardPlan& plan, const IndexInterval target_even, const IndexInterval target_odd) {
-    std::vector<RequiredStreams> required(plan.routes.size() + 1);
+// Periodization coefficients repeat every `period`, so the interval starts
+// at its begin modulo the period and may run past it; readers wrap.
+[[nodiscard]] inline IndexInterval wrapped_canonical_interval(
+    const IndexInterval internal, const int stream_shift, const int canonical_start, const size_t period) {
+    if (internal.empty()) {
+        return internal;
+    }
+    TT_FATAL(period > 0, "Periodic ILWT coefficients require a positive period");
+    const int64_t begin = static_cast<int64_t>(internal.begin) + static_cast<int64_t>(stream_shift) - canonical_start;
+    const int64_t signed_period = static_cast<int64_t>(period);
+    const size_t wrapped = static_cast<size_t>(((begin % signed_period) + signed_period) % signed_period);
+    return IndexInterval{.begin = wrapped, .end = wrapped + internal.length()};
+}
+
+[[nodiscard]] inline std::pmr::vector<RequiredStreams> propagate_requirements(
+    const LiftingForwardPlan& plan,
+    const IndexInterval target_even,
+    const IndexInterval target_odd,
+    std::pmr::memory_resource* const resource = std::pmr::get_default_resource()) {
+    std::pmr::vector<RequiredStreams> required(plan.routes.size() + 1, resource);
     required.front() = RequiredStreams{.even = target_even, .odd = target_odd};
 
     size_t even_length = plan.preprocess_layout.output.even.length;
@@ -123,7 +155,8 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
 
         RequiredStreams after{};
         switch (route.type) {
-            case StepType::kPredict: {
+            case StepType::kPredict:
+            case StepType::kRoundedPredict: {
                 TT_FATAL(
                     even_length == route.source_length && odd_length == route.base_length,
                     "Inverse predict length state is inconsistent with the forward trace");
@@ -145,7 +178,8 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
                 odd_length = route.output_length;
                 break;
             }
-            case StepType::kUpdate: {
+            case StepType::kUpdate:
+            case StepType::kRoundedUpdate: {
                 TT_FATAL(
                     odd_length == route.source_length && even_length == route.base_length,
                     "Inverse update length state is inconsistent with the forward trace");
@@ -197,8 +231,22 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
     return required;
 }
 
+// Inverse routes executed by every chunk: all but swaps and the two terminal
+// scales, which are applied inline.
+[[nodiscard]] inline size_t chunk_route_count(const LiftingForwardPlan& plan) {
+    const auto data_routes = static_cast<size_t>(
+        std::count_if(plan.routes.begin(), plan.routes.end(), [](const LiftingStepRoute& route) {
+            return route.type != StepType::kSwap;
+        }));
+    TT_FATAL(data_routes >= 2, "ILWT plan has no terminal scales");
+    return data_routes - 2;
+}
+
 [[nodiscard]] inline IlwtChunkPlan build_chunk(
-    const LiftingInversePlan& inverse_plan, const IndexInterval output_signal) {
+    const LiftingInversePlan& inverse_plan,
+    const IndexInterval output_signal,
+    LwtRouteTable& route_table,
+    std::pmr::memory_resource* const scratch) {
     const auto& plan = inverse_plan.forward_trace;
     const size_t pad = plan.preprocess_layout.pad_config.left;
     TT_FATAL(
@@ -212,14 +260,28 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
     const size_t padded_end = output_signal.end + pad;
     const IndexInterval target_even{.begin = (padded_begin + 1) / 2, .end = (padded_end + 1) / 2};
     const IndexInterval target_odd{.begin = padded_begin / 2, .end = padded_end / 2};
-    const std::vector<RequiredStreams> required = propagate_requirements(plan, target_even, target_odd);
+    const std::pmr::vector<RequiredStreams> required =
+        propagate_requirements(plan, target_even, target_odd, scratch);
 
     const int canonical_start = static_cast<int>(plan.preprocess_layout.pad_config.left + 1) / 2;
-    // tap_size / 2 equals (left_pad + 1) / 2 because left_pad = tap_size - 1.
-    const IndexInterval canonical_approximation = canonical_interval(
-        required.back().even, plan.final_even_shift, canonical_start, inverse_plan.coefficient_length, "approximation");
-    const IndexInterval canonical_detail = canonical_interval(
-        required.back().odd, plan.final_odd_shift, canonical_start, inverse_plan.coefficient_length, "detail");
+    const bool periodic = plan.preprocess_layout.pad_config.mode == BoundaryMode::kPeriodization;
+    const size_t period = ilwt_coefficient_period(inverse_plan);
+    const IndexInterval canonical_approximation =
+        periodic ? wrapped_canonical_interval(required.back().even, plan.final_even_shift, canonical_start, period)
+                 : canonical_interval(
+                       required.back().even,
+                       plan.final_even_shift,
+                       canonical_start,
+                       inverse_plan.coefficient_length,
+                       "approximation");
+    const IndexInterval canonical_detail =
+        periodic ? wrapped_canonical_interval(required.back().odd, plan.final_odd_shift, canonical_start, period)
+                 : canonical_interval(
+                       required.back().odd,
+                       plan.final_odd_shift,
+                       canonical_start,
+                       inverse_plan.coefficient_length,
+                       "detail");
     TT_FATAL(
         canonical_approximation.length() == required.back().even.length() &&
             canonical_detail.length() == required.back().odd.length(),
@@ -229,8 +291,7 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
     StoredStream active_odd{.slot = StorageSlot::kB, .storage = required.back().odd};
     StorageSlot free_slot = StorageSlot::kScratch;
     size_t max_workspace_elements = std::max(active_even.storage.length(), active_odd.storage.length());
-    std::vector<LwtStepRoute> routes;
-    routes.reserve(plan.routes.size());
+    const size_t route_begin = route_table.rows;
 
     validate_inverse_scale_inline(plan);
 
@@ -254,7 +315,7 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
         }
 
         if (is_predict_update_step(forward_route.type)) {
-            const bool predict = forward_route.type == StepType::kPredict;
+            const bool predict = is_predict_step(forward_route.type);
             const IndexInterval output = predict ? before.odd : before.even;
             const IndexInterval target =
                 subtract_offset(output, forward_route.base_offset, "inverse predict/update route");
@@ -265,7 +326,7 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
             const StoredStream& source = predict ? active_even : active_odd;
             const StoredStream& base = predict ? active_odd : active_even;
 
-            routes.push_back(LwtStepRoute{
+            route_table.push_back(LwtStepRoute{
                 .type = forward_route.type,
                 .source = StreamRef{.slot = source.slot},
                 .base = StreamRef{.slot = base.slot},
@@ -295,7 +356,7 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
         TT_FATAL(scale_even || forward_route.type == StepType::kScaleOdd, "Unsupported inverse route type");
         const IndexInterval output = scale_even ? before.even : before.odd;
         const StoredStream& source = scale_even ? active_even : active_odd;
-        routes.push_back(LwtStepRoute{
+        route_table.push_back(LwtStepRoute{
             .type = forward_route.type,
             .source = StreamRef{.slot = source.slot},
             .base = StreamRef{.slot = source.slot},
@@ -338,7 +399,7 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
         .reconstructed_odd = target_odd,
         .canonical_approximation = canonical_approximation,
         .canonical_detail = canonical_detail,
-        .routes = std::move(routes),
+        .routes = route_table.range_since(route_begin),
         .final_even = StreamRef{.slot = active_even.slot},
         .final_odd = StreamRef{.slot = active_odd.slot},
         .final_even_storage_length = active_even.storage.length(),
@@ -351,7 +412,7 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
 }
 
 [[nodiscard]] inline std::vector<IlwtChunkPlan> build_chunks(
-    const LiftingInversePlan& plan, const uint32_t requested_chunk_count) {
+    const LiftingInversePlan& plan, const uint32_t requested_chunk_count, LwtRouteTable& route_table) {
     TT_FATAL(requested_chunk_count > 0, "ILWT chunk count must be non-zero");
     constexpr size_t output_group_elements = 2 * device_protocol::kLwtGroupOutputElements;
     const size_t output_group_count = std::max(ceil_div(plan.original_length, output_group_elements), size_t{1});
@@ -359,6 +420,9 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
     const size_t base_groups = output_group_count / chunk_count;
     const size_t extra_groups = output_group_count % chunk_count;
 
+    route_table = make_lwt_route_table(chunk_count * chunk_route_count(plan.forward_trace));
+    std::array<std::byte, execution_detail::kChunkScratchBytes> scratch_buffer;
+    std::pmr::monotonic_buffer_resource scratch{scratch_buffer.data(), scratch_buffer.size()};
     std::vector<IlwtChunkPlan> chunks;
     chunks.reserve(chunk_count);
     size_t group_begin = 0;
@@ -366,7 +430,8 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
         const size_t group_count = base_groups + (chunk_index < extra_groups ? 1 : 0);
         const size_t begin = group_begin * output_group_elements;
         const size_t end = std::min((group_begin + group_count) * output_group_elements, plan.original_length);
-        chunks.push_back(build_chunk(plan, IndexInterval{.begin = begin, .end = end}));
+        chunks.push_back(build_chunk(plan, IndexInterval{.begin = begin, .end = end}, route_table, &scratch));
+        scratch.release();
         group_begin += group_count;
     }
     TT_FATAL(group_begin == output_group_count, "ILWT chunks do not cover every output group");
@@ -375,6 +440,24 @@ inline void validate_inverse_scale_inline(const LiftingForwardPlan& plan) {
 
 }  // namespace inverse_detail
 
+/**
+ * The forward trace an inverse plan walks back. Padded modes reuse the
+ * forward pads. Periodization pads only the forward cones, which is too
+ * short for the inverse; both pads grow by an even count to at least
+ * tap_size - 1, which keeps the split parity and moves the canonical
+ * origin by whole coefficients.
+ */
+template <typename Scheme>
+[[nodiscard]] constexpr Pad1DConfig inverse_lifting_pad_config(const BoundaryMode boundary_mode) noexcept {
+    Pad1DConfig pad = forward_lifting_pad_config<Scheme>(boundary_mode);
+    if (boundary_mode == BoundaryMode::kPeriodization) {
+        const uint32_t widening = 2 * static_cast<uint32_t>(Scheme::tap_size / 4);
+        pad.left += widening;
+        pad.right += widening;
+    }
+    return pad;
+}
+
 template <typename Scheme>
 [[nodiscard]] LiftingInversePlan make_inverse_lifting_plan(
     const size_t original_length,
@@ -388,7 +471,8 @@ template <typename Scheme>
         .stick_width = kStickWidth,
         .element_size_bytes = sizeof(float),
     };
-    LiftingForwardPlan trace = make_forward_lifting_plan<Scheme>(original, 0, 0, boundary_mode);
+    LiftingForwardPlan trace =
+        detail::make_forward_lifting_trace<Scheme>(original, 0, 0, inverse_lifting_pad_config<Scheme>(boundary_mode));
     const bool length_valid = coefficient_length == trace.output_length ||
                               (coefficient_length >= trace.output_length && coefficient_length % kStickWidth == 0 &&
                                (coefficient_length - trace.output_length) < kStickWidth);
@@ -419,11 +503,12 @@ template <typename Scheme>
         static_cast<uint32_t>(std::max(ceil_div(full_plan.original_length, output_group_elements), size_t{1}));
     uint32_t chunk_count = std::min(final_group_count, core_limit);
     std::vector<IlwtChunkPlan> chunks;
+    LwtRouteTable route_table;
     uint32_t workspace_elements = 0;
     uint32_t max_workspace_elements = 0;
 
     const auto build_candidate = [&](const uint32_t candidate_chunk_count) {
-        auto candidate_chunks = inverse_detail::build_chunks(full_plan, candidate_chunk_count);
+        auto candidate_chunks = inverse_detail::build_chunks(full_plan, candidate_chunk_count, route_table);
         size_t candidate_max_workspace_elements = 0;
         for (const auto& chunk : candidate_chunks) {
             candidate_max_workspace_elements = std::max(candidate_max_workspace_elements, chunk.max_workspace_elements);
@@ -468,11 +553,11 @@ template <typename Scheme>
         max_dependency_overhead = std::max(max_dependency_overhead, chunk.dependency_overhead);
         TT_FATAL(!chunk.routes.empty(), "ILWT requires at least one inverse predict/update route");
         if (final_interleave_direct) {
-            const auto& final_route = chunk.routes.back();
+            const LwtStepRoute final_route = route_table.at(chunk.routes, chunk.routes.size() - 1);
             TT_FATAL(
                 is_predict_update_step(final_route.type),
                 "Direct ILWT interleave requires the final inverse route to be predict/update");
-            const bool updates_even = final_route.type == StepType::kUpdate;
+            const bool updates_even = is_update_step(final_route.type);
             const StreamRef final_stream = updates_even ? chunk.final_even : chunk.final_odd;
             const size_t final_offset =
                 updates_even ? chunk.final_even_offset_elements : chunk.final_odd_offset_elements;
@@ -488,6 +573,7 @@ template <typename Scheme>
     return IlwtExecutionPlan{
         .full_plan = std::move(full_plan),
         .chunks = std::move(chunks),
+        .route_table = std::move(route_table),
         .output_groups_per_chunk = groups_per_chunk,
         .workspace_elements = workspace_elements,
         .max_workspace_elements = max_workspace_elements,
@@ -9,6 +9,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <utility>
 #include <vector>
@@ -31,6 +34,7 @@ struct Ilwt2DExecutionPlan {
     uint32_t active_core_count{0};
     uint32_t executable_route_count{0};
     std::vector<Lwt2DChunkPlan> chunks;
+    Lwt2DRouteTable route_table{};
     double max_dependency_overhead{0.0};
     uint64_t max_l1_bytes{0};
     uint64_t estimated_latency_cycles{0};
@@ -53,17 +57,20 @@ namespace inverse_2d_detail {
 }
 
 [[nodiscard]] inline AxisConePlan build_axis_cone(
-    const LiftingInversePlan& inverse_plan, const IndexInterval target_even, const IndexInterval target_odd) {
+    const LiftingInversePlan& inverse_plan,
+    const IndexInterval target_even,
+    const IndexInterval target_odd,
+    std::pmr::memory_resource* const resource) {
     const LiftingForwardPlan& forward = inverse_plan.forward_trace;
-    const std::vector<AxisRequiredStreams> required =
-        inverse_detail::propagate_requirements(forward, target_even, target_odd);
+    const std::pmr::vector<AxisRequiredStreams> required =
+        inverse_detail::propagate_requirements(forward, target_even, target_odd, resource);
 
     AxisConePlan cone{
         .final_even = target_even,
         .final_odd = target_odd,
         .initial_even = required.back().even,
         .initial_odd = required.back().odd,
-        .routes = {},
+        .routes = std::pmr::vector<AxisRouteRequirement>(resource),
         .max_workspace_elements = std::max(required.back().even.length(), required.back().odd.length()),
         .base_transitions_aligned_32 = false,
     };
@@ -105,7 +112,7 @@ inline void append_axis_routes(
     const Lwt2DAxis axis,
     const IndexInterval transverse,
     plan_2d_detail::AxisPairSlots& slots,
-    std::vector<Lwt2DRoutePlan>& routes) {
+    std::pmr::vector<Lwt2DRoutePlan>& routes) {
     const size_t route_count = cone.routes.size();
     for (size_t inverse_index = 0; inverse_index < route_count; ++inverse_index) {
         const AxisRouteRequirement& requirement = cone.routes[inverse_index];
@@ -171,9 +178,10 @@ inline void append_axis_routes(
     }
 }
 
-[[nodiscard]] inline std::pair<std::vector<Lwt2DRoutePlan>, Lwt2DBandSlots> build_route_schedule(
-    const AxisConePlan& y_cone, const AxisConePlan& x_cone) {
-    std::vector<Lwt2DRoutePlan> routes;
+// Fills `routes`, which callers reuse across chunks, and returns the parity slots.
+inline Lwt2DBandSlots build_route_schedule(
+    const AxisConePlan& y_cone, const AxisConePlan& x_cone, std::pmr::vector<Lwt2DRoutePlan>& routes) {
+    routes.clear();
     routes.reserve(2 * x_cone.routes.size() + 2 * y_cone.routes.size());
 
     // LL/LH -> Le/Lo.
@@ -219,24 +227,29 @@ inline void append_axis_routes(
     TT_FATAL(
         std::adjacent_find(slots.begin(), slots.end()) == slots.end(),
         "2D ILWT route schedule aliases two final parity planes");
-    return {std::move(routes), parity};
+    return parity;
 }
 
 [[nodiscard]] inline Lwt2DChunkPlan build_chunk(
     const LiftingInversePlan& y_plan,
     const LiftingInversePlan& x_plan,
     const IndexRectangle output,
-    const uint64_t l1_budget_bytes) {
+    const uint64_t l1_budget_bytes,
+    Lwt2DRouteTable& route_table,
+    std::pmr::vector<Lwt2DRoutePlan>& routes,
+    std::pmr::memory_resource* const resource) {
     const size_t pad_y = y_plan.forward_trace.preprocess_layout.pad_config.left;
     const size_t pad_x = x_plan.forward_trace.preprocess_layout.pad_config.left;
-    const AxisConePlan y_cone = build_axis_cone(
+    AxisConePlan y_cone = build_axis_cone(
         y_plan,
         reconstructed_parity_interval(output.y, pad_y, true),
-        reconstructed_parity_interval(output.y, pad_y, false));
-    const AxisConePlan x_cone = build_axis_cone(
+        reconstructed_parity_interval(output.y, pad_y, false),
+        resource);
+    AxisConePlan x_cone = build_axis_cone(
         x_plan,
         reconstructed_parity_interval(output.x, pad_x, true),
-        reconstructed_parity_interval(output.x, pad_x, false));
+        reconstructed_parity_interval(output.x, pad_x, false),
+        resource);
 
     const PolyphaseDependencyRectangles initial{
         .ee = interval_product(y_cone.initial_even, x_cone.initial_even),
@@ -244,7 +257,7 @@ inline void append_axis_routes(
         .oe = interval_product(y_cone.initial_odd, x_cone.initial_even),
         .oo = interval_product(y_cone.initial_odd, x_cone.initial_odd),
     };
-    auto [routes, parity_slots] = build_route_schedule(y_cone, x_cone);
+    const Lwt2DBandSlots parity_slots = build_route_schedule(y_cone, x_cone, routes);
     constexpr Lwt2DWorkspacePolicy workspace_policy = Lwt2DWorkspacePolicy::kFivePlaneGeneric;
     const Lwt2DResourceModel resources =
         plan_2d_detail::make_resource_model(initial, routes, workspace_policy, l1_budget_bytes);
@@ -281,11 +294,11 @@ inline void append_axis_routes(
                         .end = round_up(output.x.end, kTileWidth2D),
                     },
             },
-        .y_cone = y_cone,
-        .x_cone = x_cone,
+        .y_cone = std::move(y_cone),
+        .x_cone = std::move(x_cone),
         .initial = initial,
         .workspace_policy = workspace_policy,
-        .routes = std::move(routes),
+        .routes = route_table.append(routes),
         .final_bands = parity_slots,
         .final_band_sources = parity_sources,
         .resources = resources,
@@ -306,13 +319,19 @@ inline void append_axis_routes(
     const LiftingInversePlan& x_plan,
     const uint32_t chunk_tiles_y,
     const uint32_t chunk_tiles_x,
-    const uint64_t l1_budget_bytes) {
+    const uint64_t l1_budget_bytes,
+    Lwt2DRouteTable& route_table,
+    std::pmr::memory_resource* const scratch = nullptr) {
     const size_t chunk_height = static_cast<size_t>(chunk_tiles_y) * kTileHeight2D;
     const size_t chunk_width = static_cast<size_t>(chunk_tiles_x) * kTileWidth2D;
     std::vector<Lwt2DChunkPlan> chunks;
     const size_t chunk_rows = ceil_div(y_plan.original_length, chunk_height);
     const size_t chunk_columns = ceil_div(x_plan.original_length, chunk_width);
-    chunks.reserve(plan_2d_detail::checked_area(chunk_rows, chunk_columns, "2D ILWT chunk grid"));
+    const size_t chunk_count = plan_2d_detail::checked_area(chunk_rows, chunk_columns, "2D ILWT chunk grid");
+    std::pmr::memory_resource* const resource = scratch == nullptr ? std::pmr::get_default_resource() : scratch;
+    route_table.reset(chunk_count * (2 * y_plan.forward_trace.routes.size() + 2 * x_plan.forward_trace.routes.size()));
+    std::pmr::vector<Lwt2DRoutePlan> schedule(resource);
+    chunks.reserve(chunk_count);
     for (size_t y = 0; y < y_plan.original_length; y += chunk_height) {
         for (size_t x = 0; x < x_plan.original_length; x += chunk_width) {
             chunks.push_back(build_chunk(
@@ -322,7 +341,10 @@ inline void append_axis_routes(
                     .y = IndexInterval{.begin = y, .end = std::min(y + chunk_height, y_plan.original_length)},
                     .x = IndexInterval{.begin = x, .end = std::min(x + chunk_width, x_plan.original_length)},
                 },
-                l1_budget_bytes));
+                l1_budget_bytes,
+                route_table,
+                schedule,
+                resource));
         }
     }
     return chunks;
@@ -343,45 +365,63 @@ inline void append_axis_routes(
         plan_2d_detail::checked_u32(ceil_div(y_plan.original_length, kTileHeight2D), "2D ILWT output tile rows");
     const uint32_t output_tiles_x =
         plan_2d_detail::checked_u32(ceil_div(x_plan.original_length, kTileWidth2D), "2D ILWT output tile columns");
+    // As in make_lwt_2d_execution_plan, candidates live in an arena rewound
+    // per tile shape, reuse one route table, and only the winner is rebuilt
+    // for the plan.
+    std::pmr::monotonic_buffer_resource candidate_arena;
+    Lwt2DRouteTable candidate_routes;
+    const auto evaluate = [&](const uint32_t tiles_y,
+                              const uint32_t tiles_x) -> std::optional<plan_2d_detail::Candidate> {
+        const std::vector<Lwt2DChunkPlan> chunks = inverse_2d_detail::build_chunks(
+            y_plan, x_plan, tiles_y, tiles_x, l1_budget_bytes, candidate_routes, &candidate_arena);
+        uint64_t max_l1 = 0;
+        double max_overhead = 0.0;
+        for (const Lwt2DChunkPlan& chunk : chunks) {
+            if (chunk.resources.total_l1_bytes > l1_budget_bytes) {
+                return std::nullopt;
+            }
+            max_l1 = std::max(max_l1, chunk.resources.total_l1_bytes);
+            max_overhead = std::max(max_overhead, chunk.dependency_overhead);
+        }
+        const uint32_t active_core_count =
+            static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit)));
+        return plan_2d_detail::Candidate{
+            .chunk_tiles_y = tiles_y,
+            .chunk_tiles_x = tiles_x,
+            .active_core_count = active_core_count,
+            .max_l1_bytes = max_l1,
+            .max_dependency_overhead = max_overhead,
+            .estimated_latency_cycles = plan_2d_detail::estimate_candidate_latency_cycles(
+                chunks,
+                candidate_routes,
+                active_core_count,
+                y_plan.forward_trace,
+                x_plan.forward_trace,
+                true,
+                inverse_coordination_penalty_cycles_per_core),
+            .chunks = {},
+        };
+    };
+
     plan_2d_detail::Candidate best{};
     bool found = false;
     for (uint32_t tiles_y = 1; tiles_y <= output_tiles_y; ++tiles_y) {
         for (uint32_t tiles_x = 1; tiles_x <= output_tiles_x; ++tiles_x) {
-            std::vector<Lwt2DChunkPlan> chunks =
-                inverse_2d_detail::build_chunks(y_plan, x_plan, tiles_y, tiles_x, l1_budget_bytes);
-            uint64_t max_l1 = 0;
-            double max_overhead = 0.0;
-            bool fits = true;
-            for (const Lwt2DChunkPlan& chunk : chunks) {
-                max_l1 = std::max(max_l1, chunk.resources.total_l1_bytes);
-                max_overhead = std::max(max_overhead, chunk.dependency_overhead);
-                fits = fits && chunk.resources.total_l1_bytes <= l1_budget_bytes;
-            }
-            if (!fits) {
+            std::optional<plan_2d_detail::Candidate> candidate = evaluate(tiles_y, tiles_x);
+            candidate_arena.release();
+            if (!candidate.has_value()) {
                 continue;
             }
-            plan_2d_detail::Candidate candidate{
-                .chunk_tiles_y = tiles_y,
-                .chunk_tiles_x = tiles_x,
-                .active_core_count = static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit))),
-                .max_l1_bytes = max_l1,
-                .max_dependency_overhead = max_overhead,
-                .estimated_latency_cycles = plan_2d_detail::estimate_candidate_latency_cycles(
-                    chunks,
-                    static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit))),
-                    y_plan.forward_trace,
-                    x_plan.forward_trace,
-                    true,
-                    inverse_coordination_penalty_cycles_per_core),
-                .chunks = std::move(chunks),
-            };
-            if (!found || plan_2d_detail::is_better_candidate(candidate, best, true)) {
-                best = std::move(candidate);
+            if (!found || plan_2d_detail::is_better_candidate(*candidate, best, true)) {
+                best = std::move(*candidate);
                 found = true;
             }
         }
     }
     TT_FATAL(found, "No 2D ILWT chunk fits the {}-byte L1 budget", l1_budget_bytes);
+    Lwt2DRouteTable route_table;
+    best.chunks = inverse_2d_detail::build_chunks(
+        y_plan, x_plan, best.chunk_tiles_y, best.chunk_tiles_x, l1_budget_bytes, route_table);
 
     std::array<uint32_t, 5> heights{};
     std::array<uint32_t, 5> widths{};
@@ -406,10 +446,10 @@ inline void append_axis_routes(
         .band = make_tiled_shape_2d(Shape2D{.height = y_plan.coefficient_length, .width = x_plan.coefficient_length}),
         .padding_precedes_split = true,
     };
+    const std::span<const IndexRectangle> first_outputs =
+        route_table.rows_of(route_table.output, best.chunks.front().routes);
     const uint32_t executable_routes = static_cast<uint32_t>(std::count_if(
-        best.chunks.front().routes.begin(), best.chunks.front().routes.end(), [](const Lwt2DRoutePlan& route) {
-            return !route.output.empty();
-        }));
+        first_outputs.begin(), first_outputs.end(), [](const IndexRectangle output) { return !output.empty(); }));
     return Ilwt2DExecutionPlan{
         .y_plan = std::move(y_plan),
         .x_plan = std::move(x_plan),
@@ -423,6 +463,7 @@ inline void append_axis_routes(
         .active_core_count = best.active_core_count,
         .executable_route_count = executable_routes,
         .chunks = std::move(best.chunks),
+        .route_table = std::move(route_table),
         .max_dependency_overhead = best.max_dependency_overhead,
         .max_l1_bytes = best.max_l1_bytes,
         .estimated_latency_cycles = best.estimated_latency_cycles,
@@ -442,33 +483,41 @@ template <typename Scheme>
     const uint64_t l1_budget_bytes,
     const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
     const uint64_t inverse_coordination_penalty_cycles_per_core = 0) {
-    const SignalBuffer y_signal{
-        .length = output_height, .stick_width = kStickWidth, .element_size_bytes = sizeof(float)};
-    const SignalBuffer x_signal{
-        .length = output_width, .stick_width = kStickWidth, .element_size_bytes = sizeof(float)};
-    LiftingForwardPlan y_forward = make_forward_lifting_plan<Scheme>(y_signal, 0, 0, boundary_mode);
-    LiftingForwardPlan x_forward = make_forward_lifting_plan<Scheme>(x_signal, 0, 0, boundary_mode);
-    const size_t y_coefficients = y_forward.output_length;
-    const size_t x_coefficients = x_forward.output_length;
+    static_assert(rounded_step_count<Scheme>() == 0, "Rounded integer schemes run on the integer host executor");
     return make_ilwt_2d_execution_plan(
-        LiftingInversePlan{
-            .forward_trace = std::move(y_forward),
-            .original_length = output_height,
-            .coefficient_length = y_coefficients,
-        },
-        LiftingInversePlan{
-            .forward_trace = std::move(x_forward),
-            .original_length = output_width,
-            .coefficient_length = x_coefficients,
-        },
+        make_inverse_lifting_plan<Scheme>(
+            output_height, forward_lifting_output_length<Scheme>(output_height, boundary_mode), boundary_mode),
+        make_inverse_lifting_plan<Scheme>(
+            output_width, forward_lifting_output_length<Scheme>(output_width, boundary_mode), boundary_mode),
         core_limit,
         l1_budget_bytes,
         inverse_coordination_penalty_cycles_per_core);
 }
 
-[[nodiscard]] inline std::vector<uint32_t> build_ilwt_2d_chunk_config_words(const Ilwt2DExecutionPlan& plan) {
+[[nodiscard]] inline size_t ilwt_2d_chunk_config_word_count(const Ilwt2DExecutionPlan& plan) noexcept {
+    return plan.chunks.size() * device_protocol::kLwt2DChunkConfigWordCount;
+}
+
+[[nodiscard]] inline size_t ilwt_2d_route_config_word_count(const Ilwt2DExecutionPlan& plan) noexcept {
+    return plan.chunks.size() *
+           (2 * plan.y_plan.forward_trace.routes.size() + 2 * plan.x_plan.forward_trace.routes.size()) *
+           device_protocol::kLwt2DRouteConfigWordCount;
+}
+
+[[nodiscard]] inline size_t ilwt_2d_band_config_word_count(const Ilwt2DExecutionPlan& plan) noexcept {
+    return plan.chunks.size() * device_protocol::kLwt2DBandConfigWordCount;
+}
+
+[[nodiscard]] inline size_t ilwt_2d_config_upload_word_count(const Ilwt2DExecutionPlan& plan) noexcept {
+    return ilwt_2d_chunk_config_word_count(plan) + ilwt_2d_route_config_word_count(plan) +
+           ilwt_2d_band_config_word_count(plan);
+}
+
+inline std::span<uint32_t> write_ilwt_2d_chunk_config_words(
+    const Ilwt2DExecutionPlan& plan, const std::span<uint32_t> upload_words) {
     TT_FATAL(!plan.chunks.empty(), "2D ILWT chunk protocol requires at least one chunk");
-    std::vector<uint32_t> words(plan.chunks.size() * device_protocol::kLwt2DChunkConfigWordCount, 0);
+    const std::span<uint32_t> words = plan_2d_detail::prepare_config_words(
+        upload_words, ilwt_2d_chunk_config_word_count(plan), "2D ILWT chunk config");
     for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
         const Lwt2DChunkPlan& chunk = plan.chunks[chunk_index];
         const size_t offset = chunk_index * device_protocol::kLwt2DChunkConfigWordCount;
@@ -496,18 +545,26 @@ template <typename Scheme>
     return words;
 }
 
-[[nodiscard]] inline std::vector<uint32_t> build_ilwt_2d_route_config_words(const Ilwt2DExecutionPlan& plan) {
+[[nodiscard]] inline std::vector<uint32_t> build_ilwt_2d_chunk_config_words(const Ilwt2DExecutionPlan& plan) {
+    std::vector<uint32_t> words(ilwt_2d_chunk_config_word_count(plan));
+    write_ilwt_2d_chunk_config_words(plan, words);
+    return words;
+}
+
+inline std::span<uint32_t> write_ilwt_2d_route_config_words(
+    const Ilwt2DExecutionPlan& plan, const std::span<uint32_t> upload_words) {
     TT_FATAL(!plan.chunks.empty(), "2D ILWT route protocol requires at least one chunk");
     const size_t route_count = plan.chunks.front().routes.size();
     TT_FATAL(
         route_count == 2 * plan.y_plan.forward_trace.routes.size() + 2 * plan.x_plan.forward_trace.routes.size(),
         "2D ILWT route protocol has an unexpected route count");
-    std::vector<uint32_t> words(plan.chunks.size() * route_count * device_protocol::kLwt2DRouteConfigWordCount, 0);
+    const std::span<uint32_t> words = plan_2d_detail::prepare_config_words(
+        upload_words, ilwt_2d_route_config_word_count(plan), "2D ILWT route config");
     for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
         const Lwt2DChunkPlan& chunk = plan.chunks[chunk_index];
         TT_FATAL(chunk.routes.size() == route_count, "2D ILWT chunks have inconsistent route counts");
         for (size_t route_index = 0; route_index < route_count; ++route_index) {
-            const Lwt2DRoutePlan& route = chunk.routes[route_index];
+            const Lwt2DRoutePlan route = plan.route_table.at(chunk.routes, route_index);
             const size_t offset =
                 (chunk_index * route_count + route_index) * device_protocol::kLwt2DRouteConfigWordCount;
             words[offset + device_protocol::kLwt2DRouteAxis] = static_cast<uint32_t>(route.axis);
@@ -535,9 +592,17 @@ template <typename Scheme>
     return words;
 }
 
-[[nodiscard]] inline std::vector<uint32_t> build_ilwt_2d_band_config_words(const Ilwt2DExecutionPlan& plan) {
+[[nodiscard]] inline std::vector<uint32_t> build_ilwt_2d_route_config_words(const Ilwt2DExecutionPlan& plan) {
+    std::vector<uint32_t> words(ilwt_2d_route_config_word_count(plan));
+    write_ilwt_2d_route_config_words(plan, words);
+    return words;
+}
+
+inline std::span<uint32_t> write_ilwt_2d_band_config_words(
+    const Ilwt2DExecutionPlan& plan, const std::span<uint32_t> upload_words) {
     TT_FATAL(!plan.chunks.empty(), "2D ILWT terminal protocol requires at least one chunk");
-    std::vector<uint32_t> words(plan.chunks.size() * device_protocol::kLwt2DBandConfigWordCount, 0);
+    const std::span<uint32_t> words = plan_2d_detail::prepare_config_words(
+        upload_words, ilwt_2d_band_config_word_count(plan), "2D ILWT terminal config");
     for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
         const Lwt2DChunkPlan& chunk = plan.chunks[chunk_index];
         const size_t offset = chunk_index * device_protocol::kLwt2DBandConfigWordCount;
@@ -563,4 +628,10 @@ template <typename Scheme>
     return words;
 }
 
+[[nodiscard]] inline std::vector<uint32_t> build_ilwt_2d_band_config_words(const Ilwt2DExecutionPlan& plan) {
+    std::vector<uint32_t> words(ilwt_2d_band_config_word_count(plan));
+    write_ilwt_2d_band_config_words(plan, words);
+    return words;
+}
+
 }  // namespace ttwv
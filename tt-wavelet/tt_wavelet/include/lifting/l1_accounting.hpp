@@ -44,7 +44,8 @@ static_assert(kOutputTileCircularBufferBytes == 12288);
     const uint32_t workspace_mirror_elements,
     const uint32_t interleave_batch_sticks,
     const uint32_t architecture_scratch_bytes,
-    const uint32_t capacity_bytes) {
+    const uint32_t capacity_bytes,
+    const uint32_t extension_table_bytes = 0) {
     TT_FATAL(
         max_workspace_elements <= workspace_elements,
         "Logical workspace length {} exceeds allocated workspace length {}",
@@ -59,10 +60,13 @@ static_assert(kOutputTileCircularBufferBytes == 12288);
         l1_detail::kSourceTileCircularBuffersBytes + l1_detail::kBaseTileCircularBufferBytes;
     const uint64_t output_bytes =
         l1_detail::kOutputTileCircularBufferBytes + uint64_t{interleave_batch_sticks} * device_protocol::kStickBytes;
+    // Config pages staged by the reader and writer, plus the forward reader's
+    // resident halo table.
+    const uint64_t metadata_bytes = l1_detail::kMetadataBytes + extension_table_bytes;
     constexpr uint64_t alignment_bytes = 0;
     const uint64_t total_bytes = slots_bytes + workspace_mirror_bytes + circular_buffers_bytes +
                                  l1_detail::kCacheBytes + output_bytes + l1_detail::kSynchronizationBytes +
-                                 l1_detail::kMetadataBytes + alignment_bytes + padding_bytes +
+                                 metadata_bytes + alignment_bytes + padding_bytes +
                                  architecture_scratch_bytes;
     TT_FATAL(
         total_bytes <= capacity_bytes,
@@ -78,7 +82,7 @@ static_assert(kOutputTileCircularBufferBytes == 12288);
         .cache_bytes = l1_detail::kCacheBytes,
         .output_bytes = output_bytes,
         .synchronization_bytes = l1_detail::kSynchronizationBytes,
-        .metadata_bytes = l1_detail::kMetadataBytes,
+        .metadata_bytes = metadata_bytes,
         .alignment_bytes = alignment_bytes,
         .padding_bytes = padding_bytes,
         .architecture_scratch_bytes = architecture_scratch_bytes,
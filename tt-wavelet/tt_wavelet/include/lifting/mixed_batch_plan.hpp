@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/host_executor.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+
+namespace ttwv {
+
+/**
+ * One signal of a mixed-scheme batch: its forward plan and the runtime
+ * coefficients of its scheme, aligned with the plan's chunk routes.
+ *
+ * Only make_lwt_batch_item needs the scheme type; everything after it works
+ * on the coefficients as data, so one batch may mix any registered schemes.
+ */
+struct LwtBatchItem {
+    LiftingForwardPlan forward_plan{};
+    std::vector<HostRouteCoefficients> coefficients;
+};
+
+template <typename Scheme>
+[[nodiscard]] LwtBatchItem make_lwt_batch_item(
+    const size_t length, const BoundaryMode boundary_mode = BoundaryMode::kSymmetric) {
+    LiftingForwardPlan forward_plan =
+        make_forward_lifting_plan<Scheme>(SignalBuffer{.length = length}, 0, 0, boundary_mode);
+    std::vector<HostRouteCoefficients> coefficients = make_host_lwt_route_coefficients<Scheme>(forward_plan);
+    return LwtBatchItem{.forward_plan = std::move(forward_plan), .coefficients = std::move(coefficients)};
+}
+
+/**
+ * One scheduled chunk of a mixed-scheme batch.
+ */
+struct LwtBatchWork {
+    uint32_t item{0};
+    uint32_t chunk{0};
+    uint64_t cost{0};
+};
+
+/**
+ * Contiguous range of `LwtMixedBatchPlan::work` run by one core slot.
+ */
+struct LwtBatchSlot {
+    uint32_t begin{0};
+    uint32_t count{0};
+    uint64_t cost{0};
+};
+
+/**
+ * Chunks of several independently planned signals packed onto one set of
+ * cores.
+ *
+ * Every item keeps its own execution plan and runtime coefficients. Config
+ * pages are laid out item after item; the `*_page_begin` vectors hold each
+ * item's first chunk, route and coefficient page, with the total page count
+ * as a final entry. The cores share one workspace size, the largest any item
+ * needs, so a core can run chunks of any item back to back.
+ */
+struct LwtMixedBatchPlan {
+    std::vector<LwtExecutionPlan> plans;
+    std::vector<std::vector<HostRouteCoefficients>> coefficients;
+    std::vector<LwtBatchWork> work;
+    std::vector<LwtBatchSlot> slots;
+    std::vector<size_t> chunk_page_begin;
+    std::vector<size_t> route_page_begin;
+    std::vector<size_t> coefficient_page_begin;
+    uint32_t workspace_elements{0};
+    uint64_t total_cost{0};
+
+    [[nodiscard]] size_t item_count() const noexcept { return plans.size(); }
+    [[nodiscard]] uint64_t max_slot_cost() const noexcept {
+        uint64_t cost = 0;
+        for (const LwtBatchSlot& slot : slots) {
+            cost = std::max(cost, slot.cost);
+        }
+        return cost;
+    }
+    // Busiest core over the mean: 1.0 is a perfect split.
+    [[nodiscard]] double imbalance() const noexcept {
+        return total_cost == 0 ? 1.0
+                               : static_cast<double>(max_slot_cost()) * static_cast<double>(slots.size()) /
+                                     static_cast<double>(total_cost);
+    }
+};
+
+namespace mixed_batch_detail {
+
+// Initial cone loads plus every route's outputs times its taps; only the
+// relative sizes matter for packing.
+[[nodiscard]] inline uint64_t chunk_cost(
+    const LwtExecutionPlan& plan,
+    const LwtChunkPlan& chunk,
+    const std::span<const HostRouteCoefficients> coefficients) {
+    uint64_t cost = chunk.initial_even.length() + chunk.initial_odd.length();
+    for (size_t route_index = 0; route_index < chunk.routes.size(); ++route_index) {
+        const LwtStepRoute route = plan.route_table.at(chunk.routes, route_index);
+        const uint64_t taps = is_predict_update_step(route.type) ? std::max(coefficients[route_index].k, 1U) : 1U;
+        cost += uint64_t{route.output_length} * taps;
+    }
+    return cost;
+}
+
+}  // namespace mixed_batch_detail
+
+/**
+ * Plan a batch of signals that may each use a different scheme, length and
+ * boundary mode, and pack all their chunks onto at most `core_limit` cores.
+ *
+ * Each item is planned on its own as make_lwt_execution_plan does. Chunks
+ * are then placed longest first on the least loaded core slot, and each
+ * slot's chunks are ordered by item and chunk, so a slot runs one
+ * contiguous range of the work list as the device core partition does.
+ */
+[[nodiscard]] inline LwtMixedBatchPlan make_lwt_mixed_batch_plan(
+    std::vector<LwtBatchItem> items, const uint32_t core_limit, const uint32_t l1_signal_budget_bytes) {
+    TT_FATAL(!items.empty(), "Mixed LWT batch requires at least one item");
+    TT_FATAL(core_limit > 0, "LWT requires at least one worker core");
+    LwtMixedBatchPlan batch;
+    batch.plans.reserve(items.size());
+    batch.coefficients.reserve(items.size());
+    batch.chunk_page_begin.push_back(0);
+    batch.route_page_begin.push_back(0);
+    batch.coefficient_page_begin.push_back(0);
+    std::vector<LwtBatchWork> work;
+    for (size_t item_index = 0; item_index < items.size(); ++item_index) {
+        LwtBatchItem& item = items[item_index];
+        LwtExecutionPlan plan =
+            make_lwt_execution_plan(std::move(item.forward_plan), core_limit, l1_signal_budget_bytes);
+        const size_t route_count = execution_detail::chunk_route_count(plan.full_plan);
+        TT_FATAL(
+            item.coefficients.size() == route_count,
+            "Mixed LWT batch item {} has {} coefficient sets for {} routes",
+            item_index,
+            item.coefficients.size(),
+            route_count);
+        for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
+            work.push_back(LwtBatchWork{
+                .item = static_cast<uint32_t>(item_index),
+                .chunk = static_cast<uint32_t>(chunk_index),
+                .cost = mixed_batch_detail::chunk_cost(plan, plan.chunks[chunk_index], item.coefficients),
+            });
+        }
+        batch.workspace_elements = std::max(batch.workspace_elements, plan.workspace_elements);
+        batch.chunk_page_begin.push_back(batch.chunk_page_begin.back() + plan.chunks.size());
+        batch.route_page_begin.push_back(batch.route_page_begin.back() + plan.chunks.size() * route_count);
+        batch.coefficient_page_begin.push_back(batch.coefficient_page_begin.back() + route_count);
+        batch.plans.push_back(std::move(plan));
+        batch.coefficients.push_back(std::move(item.coefficients));
+    }
+    TT_FATAL(
+        work.size() <= std::numeric_limits<uint32_t>::max(), "Mixed LWT batch of {} chunks is too large", work.size());
+
+    const uint32_t slot_count = static_cast<uint32_t>(std::min(work.size(), static_cast<size_t>(core_limit)));
+    std::vector<uint32_t> by_cost(work.size());
+    std::iota(by_cost.begin(), by_cost.end(), 0U);
+    std::stable_sort(by_cost.begin(), by_cost.end(), [&](const uint32_t lhs, const uint32_t rhs) {
+        return work[lhs].cost > work[rhs].cost;
+    });
+    std::vector<uint32_t> slot_of(work.size());
+    std::vector<uint64_t> slot_cost(slot_count, 0);
+    for (const uint32_t index : by_cost) {
+        const uint32_t slot =
+            static_cast<uint32_t>(std::min_element(slot_cost.begin(), slot_cost.end()) - slot_cost.begin());
+        slot_of[index] = slot;
+        slot_cost[slot] += work[index].cost;
+        batch.total_cost += work[index].cost;
+    }
+
+    std::vector<uint32_t> order(work.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(), [&](const uint32_t lhs, const uint32_t rhs) {
+        return slot_of[lhs] < slot_of[rhs];
+    });
+    batch.work.reserve(work.size());
+    batch.slots.assign(slot_count, LwtBatchSlot{});
+    for (const uint32_t index : order) {
+        LwtBatchSlot& slot = batch.slots[slot_of[index]];
+        if (slot.count == 0) {
+            slot.begin = static_cast<uint32_t>(batch.work.size());
+        }
+        ++slot.count;
+        slot.cost += work[index].cost;
+        batch.work.push_back(work[index]);
+    }
+    return batch;
+}
+
+/**
+ * Run a mixed-scheme batch on the host, core slot by core slot.
+ *
+ * Every slot reuses one workspace across the chunks of all items it owns,
+ * and each chunk reads its item's coefficients as data, as a core would read
+ * them from the batch's coefficient pages. Item i reads `inputs[i]` and
+ * writes `approximations[i]` and `details[i]`.
+ */
+inline void execute_lwt_mixed_batch_on_host(
+    const LwtMixedBatchPlan& batch,
+    const std::span<const std::span<const float>> inputs,
+    const std::span<const std::span<float>> approximations,
+    const std::span<const std::span<float>> details) {
+    TT_FATAL(
+        inputs.size() == batch.item_count() && approximations.size() == batch.item_count() &&
+            details.size() == batch.item_count(),
+        "Mixed LWT batch of {} items received {} inputs, {} approximations and {} details",
+        batch.item_count(),
+        inputs.size(),
+        approximations.size(),
+        details.size());
+    HostLwtWorkspace workspace;
+    for (const LwtBatchSlot& slot : batch.slots) {
+        for (uint32_t index = slot.begin; index < slot.begin + slot.count; ++index) {
+            const LwtBatchWork& work = batch.work[index];
+            execute_lwt_chunk_on_host(
+                batch.plans[work.item],
+                batch.coefficients[work.item],
+                work.chunk,
+                inputs[work.item],
+                approximations[work.item],
+                details[work.item],
+                workspace);
+        }
+    }
+}
+
+}  // namespace ttwv
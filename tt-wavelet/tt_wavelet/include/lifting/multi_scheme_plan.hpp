@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/host_executor.hpp"
+#include "tt_wavelet/include/lifting/mixed_batch_plan.hpp"
+
+namespace ttwv {
+
+/**
+ * One chunk of a multi-scheme forward LWT.
+ *
+ * Chunk i of every scheme computes the same canonical outputs, so all their
+ * initial cones fall inside one hull of the extended input. The hull starts
+ * on an even sample and is split once into even and odd halves; each scheme
+ * reads its initial even and odd streams as contiguous slices of the halves.
+ */
+struct LwtSharedChunk {
+    IndexInterval outputs{};
+    int64_t hull_begin{0};
+    size_t hull_length{0};
+    uint64_t separate_input_elements{0};
+
+    [[nodiscard]] double input_reduction() const noexcept {
+        return separate_input_elements == 0
+                   ? 0.0
+                   : 1.0 - static_cast<double>(hull_length) / static_cast<double>(separate_input_elements);
+    }
+};
+
+/**
+ * Forward LWTs of several schemes over one input signal.
+ *
+ * `plans[s].chunks[i]` covers `chunks[i].outputs` of scheme s; the last
+ * chunk runs to each scheme's own output length, which differs with the
+ * filter length. A core holds the shared halves next to the three
+ * workspace slots of the largest scheme.
+ */
+struct LwtMultiSchemePlan {
+    std::vector<LwtExecutionPlan> plans;
+    std::vector<std::vector<HostRouteCoefficients>> coefficients;
+    std::vector<LwtSharedChunk> chunks;
+    uint32_t workspace_elements{0};
+    uint32_t shared_elements{0};
+
+    [[nodiscard]] size_t scheme_count() const noexcept { return plans.size(); }
+    [[nodiscard]] uint64_t shared_input_elements() const noexcept {
+        uint64_t elements = 0;
+        for (const LwtSharedChunk& chunk : chunks) {
+            elements += chunk.hull_length;
+        }
+        return elements;
+    }
+    [[nodiscard]] uint64_t separate_input_elements() const noexcept {
+        uint64_t elements = 0;
+        for (const LwtSharedChunk& chunk : chunks) {
+            elements += chunk.separate_input_elements;
+        }
+        return elements;
+    }
+};
+
+namespace multi_scheme_detail {
+
+// Extended input index of the first sample of an initial stream.
+[[nodiscard]] inline int64_t stream_input_begin(
+    const IndexInterval stream, const size_t phase, const uint32_t left_pad) {
+    return static_cast<int64_t>(2 * stream.begin + phase) - static_cast<int64_t>(left_pad);
+}
+
+[[nodiscard]] inline int64_t floor_even(const int64_t value) noexcept { return value - (value & 1); }
+
+struct SharedStreamSlice {
+    size_t half{0};
+    size_t offset{0};
+};
+
+// Half (0 even, 1 odd) of the shared split and offset into it of a stream
+// whose first sample is extended input `first`.
+[[nodiscard]] inline SharedStreamSlice shared_stream_slice(const LwtSharedChunk& chunk, const int64_t first) noexcept {
+    const int64_t relative = first - chunk.hull_begin;
+    return SharedStreamSlice{.half = static_cast<size_t>(relative & 1), .offset = static_cast<size_t>(relative / 2)};
+}
+
+}  // namespace multi_scheme_detail
+
+/**
+ * Plan the forward LWT of every item over one shared input.
+ *
+ * All items must have the same input length and boundary mode. Output
+ * groups of the shortest output are split over as many chunks as cores,
+ * doubling the chunk count until the shared halves and three workspace
+ * slots of every scheme fit the L1 budget.
+ */
+[[nodiscard]] inline LwtMultiSchemePlan make_lwt_multi_scheme_plan(
+    std::vector<LwtBatchItem> items, const uint32_t core_limit, const uint32_t l1_signal_budget_bytes) {
+    TT_FATAL(!items.empty(), "Multi-scheme LWT requires at least one scheme");
+    TT_FATAL(core_limit > 0, "LWT requires at least one worker core");
+    const PadSplit1DLayout& first_layout = items.front().forward_plan.preprocess_layout;
+    size_t min_output_length = std::numeric_limits<size_t>::max();
+    for (size_t item_index = 0; item_index < items.size(); ++item_index) {
+        const LiftingForwardPlan& forward_plan = items[item_index].forward_plan;
+        const PadSplit1DLayout& layout = forward_plan.preprocess_layout;
+        TT_FATAL(
+            layout.input.length == first_layout.input.length && layout.pad_config.mode == first_layout.pad_config.mode,
+            "Multi-scheme LWT scheme {} does not share the input length and boundary mode of scheme 0",
+            item_index);
+        TT_FATAL(
+            items[item_index].coefficients.size() == execution_detail::chunk_route_count(forward_plan),
+            "Multi-scheme LWT scheme {} has {} coefficient sets for {} routes",
+            item_index,
+            items[item_index].coefficients.size(),
+            execution_detail::chunk_route_count(forward_plan));
+        min_output_length = std::min(min_output_length, forward_plan.output_length);
+    }
+
+    const size_t group_elements = device_protocol::kLwtGroupOutputElements;
+    const size_t group_count = std::max(ceil_div(min_output_length, group_elements), size_t{1});
+    size_t chunk_count = std::min(group_count, static_cast<size_t>(core_limit));
+    LwtMultiSchemePlan plan;
+    for (;;) {
+        plan.plans.clear();
+        plan.chunks.assign(chunk_count, LwtSharedChunk{});
+        plan.workspace_elements = 0;
+        std::vector<int64_t> hull_end(chunk_count, std::numeric_limits<int64_t>::min());
+        for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+            plan.chunks[chunk_index].hull_begin = std::numeric_limits<int64_t>::max();
+        }
+
+        std::array<std::byte, execution_detail::kChunkScratchBytes> scratch_buffer;
+        std::pmr::monotonic_buffer_resource scratch{scratch_buffer.data(), scratch_buffer.size()};
+        for (const LwtBatchItem& item : items) {
+            const LiftingForwardPlan& forward_plan = item.forward_plan;
+            const execution_detail::FinalStreamOrigins origins = execution_detail::final_stream_origins(forward_plan);
+            const uint32_t left_pad = forward_plan.preprocess_layout.pad_config.left;
+            LwtRouteTable route_table =
+                make_lwt_route_table(chunk_count * execution_detail::chunk_route_count(forward_plan));
+            std::vector<LwtChunkPlan> chunks;
+            chunks.reserve(chunk_count);
+            size_t max_workspace_elements = 0;
+            double max_dependency_overhead = 0.0;
+            const size_t base_groups = group_count / chunk_count;
+            const size_t extra_groups = group_count % chunk_count;
+            size_t group_begin = 0;
+            for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+                const size_t chunk_groups = base_groups + (chunk_index < extra_groups ? 1 : 0);
+                const size_t begin = group_begin * group_elements;
+                const size_t end = chunk_index + 1 == chunk_count ? forward_plan.output_length
+                                                                  : (group_begin + chunk_groups) * group_elements;
+                group_begin += chunk_groups;
+                LwtChunkPlan chunk = execution_detail::build_chunk(
+                    forward_plan,
+                    IndexInterval{.begin = begin + origins.even, .end = end + origins.even},
+                    IndexInterval{.begin = begin + origins.odd, .end = end + origins.odd},
+                    origins.even,
+                    origins.odd,
+                    route_table,
+                    &scratch);
+                scratch.release();
+
+                LwtSharedChunk& shared = plan.chunks[chunk_index];
+                shared.outputs = IndexInterval{.begin = begin, .end = std::max(shared.outputs.end, end)};
+                const auto add_stream = [&](const IndexInterval stream, const size_t phase) {
+                    if (stream.empty()) {
+                        return;
+                    }
+                    const int64_t first = multi_scheme_detail::stream_input_begin(stream, phase, left_pad);
+                    shared.hull_begin = std::min(shared.hull_begin, first);
+                    hull_end[chunk_index] =
+                        std::max(hull_end[chunk_index], first + 2 * static_cast<int64_t>(stream.length()) - 1);
+                    shared.separate_input_elements += stream.length();
+                };
+                add_stream(chunk.initial_even, 0);
+                add_stream(chunk.initial_odd, 1);
+                max_workspace_elements = std::max(max_workspace_elements, chunk.max_workspace_elements);
+                max_dependency_overhead = std::max(max_dependency_overhead, chunk.dependency_overhead);
+                chunks.push_back(std::move(chunk));
+            }
+
+            const size_t workspace_elements = round_up(max_workspace_elements, kStickWidth);
+            TT_FATAL(
+                workspace_elements <= std::numeric_limits<uint32_t>::max(),
+                "LWT workspace length {} overflows uint32_t",
+                workspace_elements);
+            plan.workspace_elements = std::max(plan.workspace_elements, static_cast<uint32_t>(workspace_elements));
+            plan.plans.push_back(LwtExecutionPlan{
+                .full_plan = forward_plan,
+                .output_window = IndexInterval{.begin = 0, .end = forward_plan.output_length},
+                .chunks = std::move(chunks),
+                .route_table = std::move(route_table),
+                .groups_per_chunk = static_cast<uint32_t>(ceil_div(group_count, chunk_count)),
+                .workspace_elements = static_cast<uint32_t>(workspace_elements),
+                .max_workspace_elements = static_cast<uint32_t>(max_workspace_elements),
+                .active_core_count = static_cast<uint32_t>(chunk_count),
+                .max_dependency_overhead = max_dependency_overhead,
+            });
+        }
+
+        size_t shared_elements = 0;
+        for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+            LwtSharedChunk& shared = plan.chunks[chunk_index];
+            shared.hull_begin = multi_scheme_detail::floor_even(shared.hull_begin);
+            shared.hull_length = static_cast<size_t>(hull_end[chunk_index] + 1 - shared.hull_begin);
+            shared_elements = std::max(shared_elements, shared.hull_length);
+        }
+        plan.shared_elements = static_cast<uint32_t>(round_up(shared_elements, 2 * kStickWidth));
+        const uint64_t bytes_per_core = (uint64_t{3} * plan.workspace_elements + plan.shared_elements) * sizeof(float);
+        if (bytes_per_core <= l1_signal_budget_bytes) {
+            break;
+        }
+        TT_FATAL(
+            chunk_count < group_count,
+            "One-group multi-scheme LWT requires {} bytes/core, exceeding the {}-byte L1 signal budget",
+            bytes_per_core,
+            l1_signal_budget_bytes);
+        chunk_count = std::min(group_count, 2 * chunk_count);
+    }
+
+    plan.coefficients.reserve(items.size());
+    for (LwtBatchItem& item : items) {
+        plan.coefficients.push_back(std::move(item.coefficients));
+    }
+    return plan;
+}
+
+/**
+ * Run a multi-scheme forward LWT on the host.
+ *
+ * Each chunk evaluates the boundary extension once over its hull and
+ * splits it into even and odd halves; every scheme then copies its initial
+ * streams out of the halves and runs its own routes. Scheme s writes
+ * `approximations[s]` and `details[s]`, bit for bit as execute_lwt_on_host
+ * would.
+ */
+inline void execute_lwt_multi_scheme_on_host(
+    const LwtMultiSchemePlan& plan,
+    const std::span<const float> input,
+    const std::span<const std::span<float>> approximations,
+    const std::span<const std::span<float>> details) {
+    TT_FATAL(!input.empty(), "Host LWT input must be non-empty");
+    TT_FATAL(
+        approximations.size() == plan.scheme_count() && details.size() == plan.scheme_count(),
+        "Multi-scheme LWT of {} schemes received {} approximations and {} details",
+        plan.scheme_count(),
+        approximations.size(),
+        details.size());
+    const BoundaryMode mode = plan.plans.front().full_plan.preprocess_layout.pad_config.mode;
+    std::array<std::vector<float>, 2> halves;
+    HostLwtWorkspace workspace;
+    for (std::vector<float>& slot : workspace.slots) {
+        slot.resize(plan.workspace_elements);
+    }
+
+    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
+        const LwtSharedChunk& shared = plan.chunks[chunk_index];
+        for (size_t half = 0; half < halves.size(); ++half) {
+            halves[half].resize((shared.hull_length + 1 - half) / 2);
+            host_executor_detail::gather_extended(
+                input, mode, shared.hull_begin + static_cast<int64_t>(half), 2, halves[half]);
+        }
+
+        for (size_t scheme = 0; scheme < plan.scheme_count(); ++scheme) {
+            const LwtExecutionPlan& scheme_plan = plan.plans[scheme];
+            const LwtChunkPlan& chunk = scheme_plan.chunks[chunk_index];
+            const uint32_t left_pad = scheme_plan.full_plan.preprocess_layout.pad_config.left;
+            const auto load_stream = [&](const StorageSlot slot, const IndexInterval stream, const size_t phase) {
+                if (stream.empty()) {
+                    return;
+                }
+                const multi_scheme_detail::SharedStreamSlice slice = multi_scheme_detail::shared_stream_slice(
+                    shared, multi_scheme_detail::stream_input_begin(stream, phase, left_pad));
+                const auto source = halves[slice.half].begin() + static_cast<std::ptrdiff_t>(slice.offset);
+                std::copy(source, source + static_cast<std::ptrdiff_t>(stream.length()), workspace.at(slot).begin());
+            };
+            load_stream(StorageSlot::kA, chunk.initial_even, 0);
+            load_stream(StorageSlot::kB, chunk.initial_odd, 1);
+
+            host_executor_detail::execute_chunk_routes(
+                scheme_plan.route_table,
+                chunk.routes,
+                plan.coefficients[scheme],
+                workspace,
+                [&](const RouteOutputStorage storage, const size_t offset, const size_t index, const float value) {
+                    host_executor_detail::store_final(
+                        storage == RouteOutputStorage::kFinalEvenDram ? approximations[scheme] : details[scheme],
+                        offset,
+                        index,
+                        value);
+                });
+        }
+    }
+}
+
+}  // namespace ttwv
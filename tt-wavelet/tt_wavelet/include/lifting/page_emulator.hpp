@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <vector>
+
+#include "tt_wavelet/include/common/sample_format.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/common/signal_extension.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/host_executor.hpp"
+#include "tt_wavelet/include/lifting/page_geometry.hpp"
+
+namespace ttwv {
+
+/**
+ * One signal laid out as DRAM pages of a page geometry: `stick_width`
+ * samples per page, zero padded to `page_elements`, and a zero-padded tail
+ * stick, as the device buffers hold it. Pages keep FP32 values rounded to
+ * the geometry's sample format, i.e. what a widening load would return.
+ */
+struct HostPagedSignal {
+    SignalBuffer layout{};
+    uint32_t page_elements{0};
+    std::vector<float> pages;
+
+    [[nodiscard]] size_t page_of(const size_t index) const noexcept { return index / layout.stick_width; }
+    [[nodiscard]] size_t slot_of(const size_t index) const noexcept {
+        return page_of(index) * page_elements + index % layout.stick_width;
+    }
+};
+
+[[nodiscard]] inline HostPagedSignal make_host_paged_signal(
+    const std::span<const float> values, const LwtPageGeometry geometry) {
+    validate_page_geometry(geometry);
+    const SignalBuffer layout = geometry.signal(values.size());
+    HostPagedSignal signal{
+        .layout = layout,
+        .page_elements = geometry.page_elements(),
+        .pages = std::vector<float>(layout.stick_count() * geometry.page_elements(), 0.0F),
+    };
+    for (size_t i = 0; i < values.size(); ++i) {
+        signal.pages[signal.slot_of(i)] = round_to_sample_format(values[i], geometry.sample_format);
+    }
+    return signal;
+}
+
+inline void unpack_host_paged_signal(const HostPagedSignal& signal, const std::span<float> values) {
+    TT_FATAL(
+        values.size() == signal.layout.length,
+        "Paged signal holds {} samples, {} requested",
+        signal.layout.length,
+        values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = signal.pages[signal.slot_of(i)];
+    }
+}
+
+/**
+ * DRAM pages moved by one emulated forward LWT.
+ *
+ * Reads count each input page once per chunk that touches it, so halo and
+ * boundary-extension pages shared by neighbouring chunks are counted for
+ * each of them; the stick cache never re-reads a page within a chunk.
+ */
+struct LwtPageTraffic {
+    LwtPageGeometry geometry{};
+    uint64_t input_pages{0};
+    uint64_t output_pages{0};
+    uint64_t input_page_reads{0};
+    uint64_t output_page_writes{0};
+    uint64_t max_chunk_input_pages{0};
+
+    [[nodiscard]] uint64_t bytes_read() const noexcept { return input_page_reads * geometry.page_bytes(); }
+    [[nodiscard]] uint64_t bytes_written() const noexcept { return output_page_writes * geometry.page_bytes(); }
+    [[nodiscard]] double read_amplification() const noexcept {
+        return static_cast<double>(input_page_reads) / static_cast<double>(std::max<uint64_t>(input_pages, 1));
+    }
+};
+
+/**
+ * Execute `plan` on the host through paged DRAM images of its geometry.
+ *
+ * Every chunk reads the input page by page through the boundary extension
+ * and writes its terminal samples into paged approximation/detail images,
+ * which are unpacked into `approximation` and `detail` at the end. The
+ * results match execute_lwt_on_host bit for bit for any FP32 geometry. A
+ * 16-bit geometry rounds only the input and output pages to its sample
+ * format; the workspace and the stencil stay FP32.
+ * An output page written by two chunks means a chunk boundary is not page
+ * aligned, which would race on device, and fails.
+ */
+inline LwtPageTraffic emulate_paged_lwt_on_host(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const std::span<const float> input,
+    const std::span<float> approximation,
+    const std::span<float> detail) {
+    TT_FATAL(!input.empty(), "Paged LWT input must be non-empty");
+    TT_FATAL(
+        input.size() <= std::numeric_limits<uint32_t>::max(),
+        "Paged LWT input of {} samples is too long",
+        input.size());
+    const LwtPageGeometry geometry = plan.page_geometry;
+    const HostPagedSignal paged_input = make_host_paged_signal(input, geometry);
+    std::vector<float> zeros(std::max(approximation.size(), detail.size()), 0.0F);
+    HostPagedSignal paged_even = make_host_paged_signal(std::span(zeros).first(approximation.size()), geometry);
+    HostPagedSignal paged_odd = make_host_paged_signal(std::span(zeros).first(detail.size()), geometry);
+
+    constexpr size_t kNoChunk = std::numeric_limits<size_t>::max();
+    std::vector<size_t> input_reader(paged_input.layout.stick_count(), kNoChunk);
+    std::vector<size_t> even_writer(paged_even.layout.stick_count(), kNoChunk);
+    std::vector<size_t> odd_writer(paged_odd.layout.stick_count(), kNoChunk);
+    LwtPageTraffic traffic{
+        .geometry = geometry,
+        .input_pages = paged_input.layout.stick_count(),
+        .output_pages = std::max(paged_even.layout.stick_count(), paged_odd.layout.stick_count()),
+    };
+
+    const Pad1DConfig& pad = plan.full_plan.preprocess_layout.pad_config;
+    const uint32_t length = static_cast<uint32_t>(input.size());
+    HostLwtWorkspace workspace;
+    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
+        const LwtChunkPlan& chunk = plan.chunks[chunk_index];
+        TT_FATAL(
+            chunk.routes.size() == coefficients.size(),
+            "Paged LWT chunk has {} routes but {} coefficient sets",
+            chunk.routes.size(),
+            coefficients.size());
+        const size_t slot_elements = std::max<size_t>(plan.workspace_elements, chunk.max_workspace_elements);
+        for (std::vector<float>& slot : workspace.slots) {
+            slot.resize(std::max(slot.size(), slot_elements));
+        }
+
+        uint64_t chunk_pages = 0;
+        const auto read_page = [&](const uint32_t index) {
+            const size_t page = paged_input.page_of(index);
+            if (input_reader[page] != chunk_index) {
+                input_reader[page] = chunk_index;
+                ++chunk_pages;
+            }
+            return paged_input.pages[paged_input.slot_of(index)];
+        };
+        const auto load_stream = [&](std::vector<float>& slot, const IndexInterval interval, const size_t phase) {
+            for (size_t i = 0; i < interval.length(); ++i) {
+                const int64_t padded_index = static_cast<int64_t>(2 * (interval.begin + i) + phase);
+                if (chunk.interior) {
+                    slot[i] = read_page(static_cast<uint32_t>(padded_index - static_cast<int64_t>(pad.left)));
+                    continue;
+                }
+                const ExtendedIndex extended =
+                    make_extended_index(pad.mode, padded_index - static_cast<int64_t>(pad.left), length);
+                slot[i] = evaluate_extended_index(extended, length, read_page);
+            }
+        };
+        load_stream(workspace.at(StorageSlot::kA), chunk.initial_even, 0);
+        load_stream(workspace.at(StorageSlot::kB), chunk.initial_odd, 1);
+        traffic.input_page_reads += chunk_pages;
+        traffic.max_chunk_input_pages = std::max(traffic.max_chunk_input_pages, chunk_pages);
+
+        host_executor_detail::execute_chunk_routes(
+            plan.route_table,
+            chunk.routes,
+            coefficients,
+            workspace,
+            [&](const RouteOutputStorage storage, const size_t offset, const size_t index, const float value) {
+                const bool even = storage == RouteOutputStorage::kFinalEvenDram;
+                HostPagedSignal& output = even ? paged_even : paged_odd;
+                std::vector<size_t>& writer = even ? even_writer : odd_writer;
+                const size_t output_index = offset + index;
+                if (output_index >= output.layout.length) {
+                    return;
+                }
+                const size_t page = output.page_of(output_index);
+                if (writer[page] == kNoChunk) {
+                    writer[page] = chunk_index;
+                    ++traffic.output_page_writes;
+                }
+                TT_FATAL(
+                    writer[page] == chunk_index,
+                    "Output page {} is written by chunks {} and {}; chunk boundaries must be page aligned",
+                    page,
+                    writer[page],
+                    chunk_index);
+                output.pages[output.slot_of(output_index)] = round_to_sample_format(value, geometry.sample_format);
+            });
+    }
+
+    unpack_host_paged_signal(paged_even, approximation);
+    unpack_host_paged_signal(paged_odd, detail);
+    return traffic;
+}
+
+}  // namespace ttwv
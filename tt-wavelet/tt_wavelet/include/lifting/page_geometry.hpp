@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tt_stl/assert.hpp>
+
+#include "tt_wavelet/include/common/constants.hpp"
+#include "tt_wavelet/include/common/sample_format.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/pad_split/layout.hpp"
+
+namespace ttwv {
+
+/**
+ * Stick width, sample format and DRAM page size a 1D LWT plan is laid out for.
+ *
+ * An output group is kLwtRowsPerGroup rows of kLwtOutputBlocksPerRow
+ * half-stick blocks, so the group size, the chunk boundaries, the row-major
+ * workspace alignment and the page count of every signal follow the stick
+ * width. The sample format sets the bytes of every DRAM page element; L1
+ * workspace slots hold FP32 whatever the format, so 16-bit samples are
+ * widened once on load and rounded once on the final store. The defaults
+ * are the geometry the device kernels are compiled for; other geometries are
+ * planned and emulated on the host only, for page-size and storage-precision
+ * sweeps.
+ */
+struct LwtPageGeometry {
+    uint32_t stick_width{kStickWidth};
+    uint32_t alignment_bytes{kNocAlignmentBytes};
+    SampleFormat sample_format{SampleFormat::kFloat32};
+
+    [[nodiscard]] constexpr uint32_t element_bytes() const noexcept { return sample_format_bytes(sample_format); }
+    [[nodiscard]] constexpr uint32_t half_stick_elements() const noexcept { return stick_width / 2; }
+    [[nodiscard]] constexpr uint32_t group_output_elements() const noexcept {
+        return device_protocol::kLwtRowsPerGroup * device_protocol::kLwtOutputBlocksPerRow * half_stick_elements();
+    }
+    [[nodiscard]] constexpr uint32_t stick_bytes() const noexcept {
+        return stick_width * element_bytes();
+    }
+    // DRAM page of one stick, padded to the transfer alignment.
+    [[nodiscard]] constexpr uint32_t page_bytes() const noexcept {
+        return static_cast<uint32_t>(round_up(stick_bytes(), alignment_bytes));
+    }
+    [[nodiscard]] constexpr uint32_t page_elements() const noexcept {
+        return page_bytes() / element_bytes();
+    }
+    // The three FP32 workspace slots of one chunk, as allocated in L1.
+    [[nodiscard]] constexpr uint64_t workspace_bytes(const size_t workspace_elements) const noexcept {
+        return uint64_t{3} * workspace_elements * sizeof(float);
+    }
+    [[nodiscard]] constexpr bool device_native() const noexcept { return *this == LwtPageGeometry{}; }
+    [[nodiscard]] constexpr SignalBuffer signal(const size_t length) const noexcept {
+        return SignalBuffer{.length = length, .stick_width = stick_width, .element_size_bytes = element_bytes()};
+    }
+
+    friend constexpr bool operator==(const LwtPageGeometry&, const LwtPageGeometry&) = default;
+};
+
+static_assert(LwtPageGeometry{}.group_output_elements() == device_protocol::kLwtGroupOutputElements);
+static_assert(LwtPageGeometry{}.half_stick_elements() == device_protocol::kLwtHalfStickElements);
+static_assert(LwtPageGeometry{}.stick_bytes() == device_protocol::kStickBytes);
+
+inline void validate_page_geometry(const LwtPageGeometry geometry) {
+    TT_FATAL(
+        geometry.stick_width >= 2 && geometry.stick_width % 2 == 0,
+        "LWT stick width must be a positive even number of elements, got {}",
+        geometry.stick_width);
+    TT_FATAL(
+        geometry.alignment_bytes > 0 && geometry.alignment_bytes % geometry.element_bytes() == 0,
+        "LWT page alignment must be a positive multiple of {} bytes, got {}",
+        geometry.element_bytes(),
+        geometry.alignment_bytes);
+}
+
+// Lay the input and the split even/odd signals out in `geometry`'s sticks.
+inline void apply_page_geometry(PadSplit1DLayout& layout, const LwtPageGeometry geometry) noexcept {
+    for (SignalBuffer* signal : {&layout.input, &layout.output.even, &layout.output.odd}) {
+        signal->stick_width = geometry.stick_width;
+        signal->element_size_bytes = geometry.element_bytes();
+    }
+}
+
+}  // namespace ttwv
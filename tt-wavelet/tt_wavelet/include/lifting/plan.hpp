@@ -4,8 +4,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "tt_wavelet/include/common/boundary.hpp"
@@ -67,6 +69,17 @@ struct LiftingForwardPlan {
     size_t output_length{0};
 };
 
+/**
+ * Routes with equal slots and local offsets read and write the same stream
+ * positions relative to their stream origins; only their lengths may differ.
+ */
+[[nodiscard]] inline bool same_route_geometry(const LiftingStepRoute& lhs, const LiftingStepRoute& rhs) noexcept {
+    return lhs.type == rhs.type && lhs.source.slot == rhs.source.slot && lhs.base.slot == rhs.base.slot &&
+           lhs.output.storage == rhs.output.storage && lhs.output.slot == rhs.output.slot &&
+           lhs.source_offset == rhs.source_offset && lhs.base_offset == rhs.base_offset &&
+           lhs.source_left_pad == rhs.source_left_pad;
+}
+
 namespace detail {
 
 struct StreamState {
@@ -78,7 +91,7 @@ struct StreamState {
     return RouteOutputRef{.storage = RouteOutputStorage::kWorkspaceSlot, .slot = slot};
 }
 
-[[nodiscard]] inline std::tuple<int, size_t, size_t, size_t> compute_step_geometry(
+[[nodiscard]] constexpr std::tuple<int, size_t, size_t, size_t> compute_step_geometry(
     const StreamState& source, const int kernel_shift, const size_t k, const StreamState& base) {
     const int conv_shift = source.shift + kernel_shift + static_cast<int>(std::min(source.length, k)) - 1;
     const size_t conv_length = source.length >= k ? source.length - k + 1 : 0;
@@ -95,14 +108,12 @@ struct StreamState {
 }
 
 template <typename Scheme, size_t Index>
-void append_forward_route(
-    std::vector<LiftingStepRoute>& routes,
-    LiftingActiveStreams& active,
-    StreamState& even_state,
-    StreamState& odd_state) {
+[[nodiscard]] constexpr LiftingStepRoute make_forward_route(
+    LiftingActiveStreams& active, StreamState& even_state, StreamState& odd_state) {
     using Step = SchemeStep<Scheme, Index>;
+    LiftingStepRoute route{};
 
-    if constexpr (Step::type == StepType::kPredict) {
+    if constexpr (is_predict_step(Step::type)) {
         static_assert(Step::k > 0, "Predict steps must have at least one coefficient");
         static_assert(
             Step::k <= device_protocol::kStepCoeffCapacity, "Predict step exceeds device coefficient capacity");
@@ -110,7 +121,7 @@ void append_forward_route(
             compute_step_geometry(even_state, Step::shift, Step::k, odd_state);
         const StreamRef output{.slot = active.free};
         const StorageSlot released = active.odd.slot;
-        routes.push_back(LiftingStepRoute{
+        route = LiftingStepRoute{
             .type = Step::type,
             .source = active.even,
             .base = active.odd,
@@ -121,11 +132,11 @@ void append_forward_route(
             .base_offset = base_off,
             .source_left_pad = device_protocol::kStepCoeffCapacity - Step::k,
             .output_length = out_length,
-        });
+        };
         odd_state = StreamState{.shift = out_shift, .length = out_length};
         active.odd = output;
         active.free = released;
-    } else if constexpr (Step::type == StepType::kUpdate) {
+    } else if constexpr (is_update_step(Step::type)) {
         static_assert(Step::k > 0, "Update steps must have at least one coefficient");
         static_assert(
             Step::k <= device_protocol::kStepCoeffCapacity, "Update step exceeds device coefficient capacity");
@@ -133,7 +144,7 @@ void append_forward_route(
             compute_step_geometry(odd_state, Step::shift, Step::k, even_state);
         const StreamRef output{.slot = active.free};
         const StorageSlot released = active.even.slot;
-        routes.push_back(LiftingStepRoute{
+        route = LiftingStepRoute{
             .type = Step::type,
             .source = active.odd,
             .base = active.even,
@@ -144,7 +155,7 @@ void append_forward_route(
             .base_offset = base_off,
             .source_left_pad = device_protocol::kStepCoeffCapacity - Step::k,
             .output_length = out_length,
-        });
+        };
         even_state = StreamState{.shift = out_shift, .length = out_length};
         active.even = output;
         active.free = released;
@@ -152,7 +163,7 @@ void append_forward_route(
         static_assert(Step::k == 1, "Scale odd steps must have exactly one coefficient");
         const StreamRef output{.slot = active.free};
         const StorageSlot released = active.odd.slot;
-        routes.push_back(LiftingStepRoute{
+        route = LiftingStepRoute{
             .type = Step::type,
             .source = active.odd,
             .base = active.odd,
@@ -163,14 +174,14 @@ void append_forward_route(
             .base_offset = 0,
             .source_left_pad = 0,
             .output_length = odd_state.length,
-        });
+        };
         active.odd = output;
         active.free = released;
     } else if constexpr (Step::type == StepType::kScaleEven) {
         static_assert(Step::k == 1, "Scale even steps must have exactly one coefficient");
         const StreamRef output{.slot = active.free};
         const StorageSlot released = active.even.slot;
-        routes.push_back(LiftingStepRoute{
+        route = LiftingStepRoute{
             .type = Step::type,
             .source = active.even,
             .base = active.even,
@@ -181,13 +192,13 @@ void append_forward_route(
             .base_offset = 0,
             .source_left_pad = 0,
             .output_length = even_state.length,
-        });
+        };
         active.even = output;
         active.free = released;
     } else {
         static_assert(Step::type == StepType::kSwap, "Unsupported static lifting step type");
         static_assert(Step::k == 0, "Swap steps must not have coefficients");
-        routes.push_back(LiftingStepRoute{
+        route = LiftingStepRoute{
             .type = Step::type,
             .source = active.even,
             .base = active.odd,
@@ -198,25 +209,31 @@ void append_forward_route(
             .base_offset = 0,
             .source_left_pad = 0,
             .output_length = 0,
-        });
+        };
         std::swap(active.even, active.odd);
         std::swap(even_state, odd_state);
     }
+    return route;
 }
 
-template <typename Scheme, size_t Index = 0>
-void append_forward_routes(
-    std::vector<LiftingStepRoute>& routes,
-    LiftingActiveStreams& active,
-    StreamState& even_state,
-    StreamState& odd_state) {
+// Routes is a std::vector, grown with push_back, or a std::array with one
+// slot per scheme step, filled in place so that constant evaluation can
+// build fixed-size plans.
+template <typename Scheme, size_t Index = 0, typename Routes>
+constexpr void append_forward_routes(
+    Routes& routes, LiftingActiveStreams& active, StreamState& even_state, StreamState& odd_state) {
     if constexpr (Index < Scheme::num_steps) {
-        append_forward_route<Scheme, Index>(routes, active, even_state, odd_state);
+        LiftingStepRoute route = make_forward_route<Scheme, Index>(active, even_state, odd_state);
+        if constexpr (requires { routes.push_back(route); }) {
+            routes.push_back(route);
+        } else {
+            routes[Index] = route;
+        }
         append_forward_routes<Scheme, Index + 1>(routes, active, even_state, odd_state);
     }
 }
 
-inline void route_terminal_scales_to_final_dram(std::vector<LiftingStepRoute>& routes) {
+constexpr void route_terminal_scales_to_final_dram(const std::span<LiftingStepRoute> routes) {
     TT_FATAL(routes.size() >= 2, "Lifting scheme must end in scale-even and scale-odd routes");
 
     const size_t terminal_begin = routes.size() - 2;
@@ -239,50 +256,103 @@ inline void route_terminal_scales_to_final_dram(std::vector<LiftingStepRoute>& r
     }
 }
 
+template <typename Scheme, typename Routes>
+constexpr std::pair<StreamState, StreamState> plan_forward_routes(Routes& routes, const PadSplit1DLayout& layout) {
+    StreamState even_state{.shift = Scheme::delay_even, .length = layout.output.even.length};
+    StreamState odd_state{.shift = Scheme::delay_odd, .length = layout.output.odd.length};
+    LiftingActiveStreams active{};
+    append_forward_routes<Scheme>(routes, active, even_state, odd_state);
+    route_terminal_scales_to_final_dram(routes);
+    return {even_state, odd_state};
+}
+
 }  // namespace detail
 
+/**
+ * Padded modes centre output m on input sample 2m + 1; PyWavelets centres
+ * periodization output o on sample 2o + tap_size / 2. The parity of the
+ * periodization left pad supplies the odd part of that offset and the final
+ * shifts move the canonical origin by the remaining tap_size / 4 outputs.
+ */
 template <typename Scheme>
-[[nodiscard]] LiftingForwardPlan make_forward_lifting_plan(
+[[nodiscard]] constexpr int forward_lifting_output_phase(const BoundaryMode boundary_mode) noexcept {
+    return boundary_mode == BoundaryMode::kPeriodization ? static_cast<int>(Scheme::tap_size / 4) : 0;
+}
+
+/**
+ * Padded modes grow the signal by tap_size - 1 samples on each side.
+ * Periodization only pads the cones of its ceil(N / 2) outputs, which the
+ * reader wraps modulo the even-rounded length rather than extending.
+ */
+template <typename Scheme>
+[[nodiscard]] constexpr Pad1DConfig forward_lifting_pad_config(const BoundaryMode boundary_mode) noexcept {
+    if (boundary_mode == BoundaryMode::kPeriodization) {
+        const uint32_t half_taps = static_cast<uint32_t>(Scheme::tap_size / 2);
+        return Pad1DConfig{.mode = boundary_mode, .left = half_taps, .right = half_taps};
+    }
+    const uint32_t wavelet_pad = static_cast<uint32_t>(Scheme::tap_size - 1);
+    return Pad1DConfig{.mode = boundary_mode, .left = wavelet_pad, .right = wavelet_pad};
+}
+
+template <typename Scheme>
+[[nodiscard]] constexpr size_t forward_lifting_output_length(
+    const size_t input_length, const BoundaryMode boundary_mode = BoundaryMode::kSymmetric) noexcept {
+    if (boundary_mode == BoundaryMode::kPeriodization) {
+        return (input_length + 1) / size_t{2};
+    }
+    return (input_length + static_cast<size_t>(Scheme::tap_size) - 1) / size_t{2};
+}
+
+namespace detail {
+
+// Trace the forward routes over `pad_config`; the output length and phase
+// follow the pad mode, so a trace may pad wider than its cones need.
+template <typename Scheme>
+[[nodiscard]] LiftingForwardPlan make_forward_lifting_trace(
     const SignalBuffer& input,
-    uint64_t initial_even_addr,
-    uint64_t initial_odd_addr,
-    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric) {
+    const uint64_t initial_even_addr,
+    const uint64_t initial_odd_addr,
+    const Pad1DConfig pad_config) {
     static_assert(Scheme::tap_size > 0, "Static lifting schemes must have a positive tap size");
     static_assert(Scheme::num_steps > 0, "Static lifting schemes must have at least one step");
-    TT_FATAL(input.element_size_bytes == sizeof(float), "Forward lifting plan currently supports fp32 only");
+    TT_FATAL(
+        input.element_size_bytes == sizeof(float) || input.element_size_bytes == sizeof(uint16_t),
+        "Forward lifting plan supports 32-bit and 16-bit samples only, got {} bytes",
+        input.element_size_bytes);
     TT_FATAL(
         input.length <= static_cast<size_t>(std::numeric_limits<uint32_t>::max()),
         "Input length {} exceeds uint32_t runtime limits",
         input.length);
 
-    const uint32_t wavelet_pad = static_cast<uint32_t>(Scheme::tap_size - 1);
-    const PadSplit1DLayout preprocess_layout = make_pad_split_1d_layout(
-        input,
-        initial_even_addr,
-        initial_odd_addr,
-        Pad1DConfig{.mode = boundary_mode, .left = wavelet_pad, .right = wavelet_pad});
-
-    const SignalBuffer initial_even = preprocess_layout.output.even;
-    const SignalBuffer initial_odd = preprocess_layout.output.odd;
-    detail::StreamState even_state{.shift = Scheme::delay_even, .length = initial_even.length};
-    detail::StreamState odd_state{.shift = Scheme::delay_odd, .length = initial_odd.length};
+    const PadSplit1DLayout preprocess_layout =
+        make_pad_split_1d_layout(input, initial_even_addr, initial_odd_addr, pad_config);
 
     std::vector<LiftingStepRoute> routes;
     routes.reserve(Scheme::num_steps);
-
-    LiftingActiveStreams active{};
-    detail::append_forward_routes<Scheme>(routes, active, even_state, odd_state);
-    detail::route_terminal_scales_to_final_dram(routes);
+    const auto [even_state, odd_state] = plan_forward_routes<Scheme>(routes, preprocess_layout);
+    const int output_phase = forward_lifting_output_phase<Scheme>(pad_config.mode);
 
     return LiftingForwardPlan{
         .preprocess_layout = preprocess_layout,
         .routes = std::move(routes),
         .final_even_length = even_state.length,
         .final_odd_length = odd_state.length,
-        .final_even_shift = even_state.shift,
-        .final_odd_shift = odd_state.shift,
-        .output_length = (input.length + static_cast<size_t>(Scheme::tap_size) - 1) / size_t{2},
+        .final_even_shift = even_state.shift - output_phase,
+        .final_odd_shift = odd_state.shift - output_phase,
+        .output_length = forward_lifting_output_length<Scheme>(input.length, pad_config.mode),
     };
 }
 
+}  // namespace detail
+
+template <typename Scheme>
+[[nodiscard]] LiftingForwardPlan make_forward_lifting_plan(
+    const SignalBuffer& input,
+    uint64_t initial_even_addr,
+    uint64_t initial_odd_addr,
+    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric) {
+    return detail::make_forward_lifting_trace<Scheme>(
+        input, initial_even_addr, initial_odd_addr, forward_lifting_pad_config<Scheme>(boundary_mode));
+}
+
 }  // namespace ttwv
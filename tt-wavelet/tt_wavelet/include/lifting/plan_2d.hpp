@@ -6,6 +6,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <tuple>
 #include <utility>
@@ -16,6 +20,7 @@
 #include "tt_wavelet/include/device_protocol/lwt_2d_config.hpp"
 #include "tt_wavelet/include/lifting/execution_plan.hpp"
 #include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/route_table.hpp"
 
 namespace ttwv {
 
@@ -86,6 +91,194 @@ struct Lwt2DRoutePlan {
     bool inline_terminal_scale{false};
 };
 
+namespace plan_2d_detail {
+
+inline constexpr size_t kRouteColumnCount = 11;
+inline constexpr size_t kRouteRowBytes = sizeof(Lwt2DAxis) + sizeof(size_t) + sizeof(StepType) +
+                                         3 * sizeof(Lwt2DPlaneSlot) + 3 * sizeof(IndexRectangle) + 2 * sizeof(bool);
+
+}  // namespace plan_2d_detail
+
+/**
+ * Structure-of-arrays route storage shared by every chunk of a 2D plan.
+ *
+ * The 2D counterpart of LwtRouteTable: one column per Lwt2DRoutePlan field,
+ * sized for chunk count times routes per chunk, with each chunk holding a
+ * RouteRange into it. Plan tables own a monotonic arena; candidate tables
+ * borrow the planner's scratch arena instead. A copy allocates fresh owned
+ * columns and copies the rows; a moved-from table is left empty.
+ */
+struct Lwt2DRouteTable {
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+    size_t capacity{0};
+    size_t rows{0};
+    std::span<Lwt2DAxis> axis;
+    std::span<size_t> axis_route_index;
+    std::span<StepType> type;
+    std::span<Lwt2DPlaneSlot> source_slot;
+    std::span<Lwt2DPlaneSlot> base_slot;
+    std::span<Lwt2DPlaneSlot> output_slot;
+    std::span<IndexRectangle> source;
+    std::span<IndexRectangle> base;
+    std::span<IndexRectangle> output;
+    std::span<bool> in_place;
+    std::span<bool> inline_terminal_scale;
+
+    Lwt2DRouteTable() = default;
+    Lwt2DRouteTable(const Lwt2DRouteTable& other);
+    Lwt2DRouteTable(Lwt2DRouteTable&& other) noexcept { swap(other); }
+    Lwt2DRouteTable& operator=(const Lwt2DRouteTable& other) {
+        if (this != &other) {
+            Lwt2DRouteTable copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    Lwt2DRouteTable& operator=(Lwt2DRouteTable&& other) noexcept {
+        Lwt2DRouteTable moved(std::move(other));
+        swap(moved);
+        return *this;
+    }
+    ~Lwt2DRouteTable() = default;
+
+    void swap(Lwt2DRouteTable& other) noexcept {
+        using std::swap;
+        swap(arena, other.arena);
+        swap(capacity, other.capacity);
+        swap(rows, other.rows);
+        swap(axis, other.axis);
+        swap(axis_route_index, other.axis_route_index);
+        swap(type, other.type);
+        swap(source_slot, other.source_slot);
+        swap(base_slot, other.base_slot);
+        swap(output_slot, other.output_slot);
+        swap(source, other.source);
+        swap(base, other.base);
+        swap(output, other.output);
+        swap(in_place, other.in_place);
+        swap(inline_terminal_scale, other.inline_terminal_scale);
+    }
+
+    void push_back(const Lwt2DRoutePlan& route) {
+        TT_FATAL(rows < capacity, "2D route table is full at {} routes", capacity);
+        const size_t row = rows++;
+        axis[row] = route.axis;
+        axis_route_index[row] = route.axis_route_index;
+        type[row] = route.type;
+        source_slot[row] = route.source_slot;
+        base_slot[row] = route.base_slot;
+        output_slot[row] = route.output_slot;
+        source[row] = route.source;
+        base[row] = route.base;
+        output[row] = route.output;
+        in_place[row] = route.in_place;
+        inline_terminal_scale[row] = route.inline_terminal_scale;
+    }
+
+    // Empty the table for a new chunk grid, keeping its columns when they
+    // already hold `row_capacity` rows.
+    void reset(size_t row_capacity);
+
+    // Store the schedule of the chunk just built and return its rows.
+    RouteRange append(const std::span<const Lwt2DRoutePlan> schedule) {
+        TT_FATAL(schedule.size() <= capacity - rows, "2D route table is full at {} routes", capacity);
+        const size_t begin = rows;
+        for (size_t index = 0; index < schedule.size(); ++index) {
+            const Lwt2DRoutePlan& route = schedule[index];
+            const size_t row = begin + index;
+            axis[row] = route.axis;
+            axis_route_index[row] = route.axis_route_index;
+            type[row] = route.type;
+            source_slot[row] = route.source_slot;
+            base_slot[row] = route.base_slot;
+            output_slot[row] = route.output_slot;
+            source[row] = route.source;
+            base[row] = route.base;
+            output[row] = route.output;
+            in_place[row] = route.in_place;
+            inline_terminal_scale[row] = route.inline_terminal_scale;
+        }
+        rows += schedule.size();
+        return range_since(begin);
+    }
+
+    [[nodiscard]] RouteRange range_since(const size_t begin) const noexcept {
+        return RouteRange{.begin = begin, .count = rows - begin};
+    }
+
+    [[nodiscard]] Lwt2DRoutePlan at(const size_t row) const {
+        TT_FATAL(row < rows, "2D route row {} is out of range for {} rows", row, rows);
+        return Lwt2DRoutePlan{
+            .axis = axis[row],
+            .axis_route_index = axis_route_index[row],
+            .type = type[row],
+            .source_slot = source_slot[row],
+            .base_slot = base_slot[row],
+            .output_slot = output_slot[row],
+            .source = source[row],
+            .base = base[row],
+            .output = output[row],
+            .in_place = in_place[row],
+            .inline_terminal_scale = inline_terminal_scale[row],
+        };
+    }
+
+    [[nodiscard]] Lwt2DRoutePlan at(const RouteRange range, const size_t index) const {
+        TT_FATAL(index < range.count, "2D chunk route {} is out of range for {} routes", index, range.count);
+        return at(range.begin + index);
+    }
+
+    // One column of a chunk, for scans that need a single field.
+    template <typename T>
+    [[nodiscard]] std::span<const T> rows_of(const std::span<T> column, const RouteRange range) const {
+        TT_FATAL(
+            range.begin <= rows && range.count <= rows - range.begin,
+            "2D route range [{}, {}) exceeds {} rows",
+            range.begin,
+            range.begin + range.count,
+            rows);
+        return column.subspan(range.begin, range.count);
+    }
+};
+
+[[nodiscard]] inline Lwt2DRouteTable make_lwt_2d_route_table(const size_t capacity) {
+    Lwt2DRouteTable table;
+    table.capacity = capacity;
+    if (capacity == 0) {
+        return table;
+    }
+    using route_table_detail::allocate_column;
+    table.arena = std::make_unique<std::pmr::monotonic_buffer_resource>(
+        capacity * plan_2d_detail::kRouteRowBytes + plan_2d_detail::kRouteColumnCount * alignof(std::max_align_t));
+    std::pmr::memory_resource& arena = *table.arena;
+    table.axis = allocate_column<Lwt2DAxis>(arena, capacity);
+    table.axis_route_index = allocate_column<size_t>(arena, capacity);
+    table.type = allocate_column<StepType>(arena, capacity);
+    table.source_slot = allocate_column<Lwt2DPlaneSlot>(arena, capacity);
+    table.base_slot = allocate_column<Lwt2DPlaneSlot>(arena, capacity);
+    table.output_slot = allocate_column<Lwt2DPlaneSlot>(arena, capacity);
+    table.source = allocate_column<IndexRectangle>(arena, capacity);
+    table.base = allocate_column<IndexRectangle>(arena, capacity);
+    table.output = allocate_column<IndexRectangle>(arena, capacity);
+    table.in_place = allocate_column<bool>(arena, capacity);
+    table.inline_terminal_scale = allocate_column<bool>(arena, capacity);
+    return table;
+}
+
+inline Lwt2DRouteTable::Lwt2DRouteTable(const Lwt2DRouteTable& other) :
+    Lwt2DRouteTable(make_lwt_2d_route_table(other.capacity)) {
+    for (size_t row = 0; row < other.rows; ++row) {
+        push_back(other.at(row));
+    }
+}
+
+inline void Lwt2DRouteTable::reset(const size_t row_capacity) {
+    if (capacity < row_capacity) {
+        *this = make_lwt_2d_route_table(row_capacity);
+    }
+    rows = 0;
+}
+
 struct Lwt2DBandSlots {
     Lwt2DPlaneSlot ll{Lwt2DPlaneSlot::kP0};
     Lwt2DPlaneSlot lh{Lwt2DPlaneSlot::kP1};
@@ -124,7 +317,7 @@ struct Lwt2DChunkPlan {
     AxisConePlan x_cone{};
     PolyphaseDependencyRectangles initial{};
     Lwt2DWorkspacePolicy workspace_policy{Lwt2DWorkspacePolicy::kFivePlaneGeneric};
-    std::vector<Lwt2DRoutePlan> routes;
+    RouteRange routes{};
     Lwt2DBandSlots final_bands{};
     Lwt2DBandSourceRectangles final_band_sources{};
     Lwt2DResourceModel resources{};
@@ -154,6 +347,7 @@ struct Lwt2DExecutionPlan {
     Lwt2DRouteDomainPolicy route_domain{Lwt2DRouteDomainPolicy::kExact};
     uint64_t estimated_latency_cycles{0};
     std::vector<Lwt2DChunkPlan> chunks;
+    Lwt2DRouteTable route_table{};
     double max_dependency_overhead{0.0};
     uint64_t max_l1_bytes{0};
     std::array<uint32_t, 5> allocated_plane_heights_elements{};
@@ -269,7 +463,7 @@ inline void account_plane_use(
 
 [[nodiscard]] inline Lwt2DResourceModel make_resource_model(
     const PolyphaseDependencyRectangles& initial,
-    const std::vector<Lwt2DRoutePlan>& routes,
+    const std::span<const Lwt2DRoutePlan> routes,
     const Lwt2DWorkspacePolicy workspace_policy,
     const uint64_t l1_budget_bytes) {
     const uint32_t plane_count = workspace_policy == Lwt2DWorkspacePolicy::kFourPlaneAligned ? 4U : 5U;
@@ -355,7 +549,7 @@ inline void append_axis_routes(
     const Lwt2DWorkspacePolicy workspace_policy,
     const TerminalScaleInline* terminal_scale,
     AxisPairSlots& slots,
-    std::vector<Lwt2DRoutePlan>& routes) {
+    std::pmr::vector<Lwt2DRoutePlan>& routes) {
     const bool aligned_in_place = workspace_policy == Lwt2DWorkspacePolicy::kFourPlaneAligned;
     for (size_t route_index = 0; route_index < cone.routes.size(); ++route_index) {
         const AxisRouteRequirement& requirement = cone.routes[route_index];
@@ -424,13 +618,15 @@ inline void append_axis_routes(
     }
 }
 
-[[nodiscard]] inline std::pair<std::vector<Lwt2DRoutePlan>, Lwt2DBandSlots> build_route_schedule(
+// Fills `routes`, which callers reuse across chunks, and returns the band slots.
+inline Lwt2DBandSlots build_route_schedule(
     const AxisConePlan& y_cone,
     const AxisConePlan& x_cone,
     const Lwt2DWorkspacePolicy workspace_policy,
     const TerminalScaleInline* y_terminal_scale,
-    const TerminalScaleInline* x_terminal_scale) {
-    std::vector<Lwt2DRoutePlan> routes;
+    const TerminalScaleInline* x_terminal_scale,
+    std::pmr::vector<Lwt2DRoutePlan>& routes) {
+    routes.clear();
     routes.reserve(2 * y_cone.routes.size() + 2 * x_cone.routes.size());
 
     AxisPairSlots x_even_pair{
@@ -501,7 +697,7 @@ inline void append_axis_routes(
                 [](const Lwt2DPlaneSlot slot) { return slot == Lwt2DPlaneSlot::kScratch; }),
             "Aligned four-plane 2D LWT schedule used the scratch plane");
     }
-    return {std::move(routes), bands};
+    return bands;
 }
 
 [[nodiscard]] inline Lwt2DChunkPlan build_chunk(
@@ -510,26 +706,38 @@ inline void append_axis_routes(
     const IndexRectangle final_band_rect,
     const uint64_t l1_budget_bytes,
     const bool fuse_terminal_scale,
-    const Lwt2DRouteDomainPolicy route_domain) {
-    const size_t y_tap_size = static_cast<size_t>(y_plan.preprocess_layout.pad_config.left) + 1;
-    const size_t x_tap_size = static_cast<size_t>(x_plan.preprocess_layout.pad_config.left) + 1;
+    const Lwt2DRouteDomainPolicy route_domain,
+    Lwt2DRouteTable& route_table,
+    std::pmr::vector<Lwt2DRoutePlan>& routes,
+    std::pmr::memory_resource* const resource) {
+    // Band coefficient 0 sits at padded stream index (left + 1) / 2, which is
+    // tap_size / 2 for the padded modes and tap_size / 4 for periodization.
+    const size_t y_canonical_start = (static_cast<size_t>(y_plan.preprocess_layout.pad_config.left) + 1) / 2;
+    const size_t x_canonical_start = (static_cast<size_t>(x_plan.preprocess_layout.pad_config.left) + 1) / 2;
     const IndexInterval final_y_even = canonical_to_stream_interval(
-        final_band_rect.y, y_plan.final_even_shift, y_plan.final_even_length, y_tap_size / 2, "vertical even");
+        final_band_rect.y, y_plan.final_even_shift, y_plan.final_even_length, y_canonical_start, "vertical even");
     const IndexInterval final_y_odd = canonical_to_stream_interval(
-        final_band_rect.y, y_plan.final_odd_shift, y_plan.final_odd_length, y_tap_size / 2, "vertical odd");
+        final_band_rect.y, y_plan.final_odd_shift, y_plan.final_odd_length, y_canonical_start, "vertical odd");
     const IndexInterval final_x_even = canonical_to_stream_interval(
-        final_band_rect.x, x_plan.final_even_shift, x_plan.final_even_length, x_tap_size / 2, "horizontal even");
+        final_band_rect.x, x_plan.final_even_shift, x_plan.final_even_length, x_canonical_start, "horizontal even");
     const IndexInterval final_x_odd = canonical_to_stream_interval(
-        final_band_rect.x, x_plan.final_odd_shift, x_plan.final_odd_length, x_tap_size / 2, "horizontal odd");
-
-    const AxisConePlan exact_y_cone = build_axis_cone(y_plan, final_y_even, final_y_odd);
-    const AxisConePlan exact_x_cone = build_axis_cone(x_plan, final_x_even, final_x_odd);
-    AxisConePlan y_cone = route_domain == Lwt2DRouteDomainPolicy::kTileClosed
-                              ? build_axis_cone(y_plan, final_y_even, final_y_odd, kTileHeight)
-                              : exact_y_cone;
-    AxisConePlan x_cone = route_domain == Lwt2DRouteDomainPolicy::kTileClosed
-                              ? build_axis_cone(x_plan, final_x_even, final_x_odd, kTileWidth)
-                              : exact_x_cone;
+        final_band_rect.x, x_plan.final_odd_shift, x_plan.final_odd_length, x_canonical_start, "horizontal odd");
+
+    // Exact-domain chunks execute the exact cones themselves; only tile-closed
+    // chunks need a second, exact pass for the traffic counters.
+    const bool tile_closed = route_domain == Lwt2DRouteDomainPolicy::kTileClosed;
+    AxisConePlan y_cone =
+        build_axis_cone(y_plan, final_y_even, final_y_odd, tile_closed ? kTileHeight : 0, resource);
+    AxisConePlan x_cone =
+        build_axis_cone(x_plan, final_x_even, final_x_odd, tile_closed ? kTileWidth : 0, resource);
+    std::optional<AxisConePlan> closed_exact_y_cone;
+    std::optional<AxisConePlan> closed_exact_x_cone;
+    if (tile_closed) {
+        closed_exact_y_cone.emplace(build_axis_cone(y_plan, final_y_even, final_y_odd, 0, resource));
+        closed_exact_x_cone.emplace(build_axis_cone(x_plan, final_x_even, final_x_odd, 0, resource));
+    }
+    const AxisConePlan& exact_y_cone = tile_closed ? *closed_exact_y_cone : y_cone;
+    const AxisConePlan& exact_x_cone = tile_closed ? *closed_exact_x_cone : x_cone;
     const PolyphaseDependencyRectangles initial{
         .ee = interval_product(y_cone.initial_even, x_cone.initial_even),
         .eo = interval_product(y_cone.initial_even, x_cone.initial_odd),
@@ -542,19 +750,13 @@ inline void append_axis_routes(
     constexpr Lwt2DWorkspacePolicy workspace_policy = Lwt2DWorkspacePolicy::kFivePlaneGeneric;
     const TerminalScaleInline y_terminal_scale = execution_detail::terminal_scale_inline(y_plan);
     const TerminalScaleInline x_terminal_scale = execution_detail::terminal_scale_inline(x_plan);
-    auto [routes, final_bands] = build_route_schedule(
+    const Lwt2DBandSlots final_bands = build_route_schedule(
         y_cone,
         x_cone,
         workspace_policy,
         fuse_terminal_scale ? &y_terminal_scale : nullptr,
-        fuse_terminal_scale ? &x_terminal_scale : nullptr);
-    auto [exact_routes, exact_final_bands] = build_route_schedule(
-        exact_y_cone,
-        exact_x_cone,
-        workspace_policy,
-        fuse_terminal_scale ? &y_terminal_scale : nullptr,
-        fuse_terminal_scale ? &x_terminal_scale : nullptr);
-    static_cast<void>(exact_final_bands);
+        fuse_terminal_scale ? &x_terminal_scale : nullptr,
+        routes);
     const Lwt2DResourceModel resources = make_resource_model(initial, routes, workspace_policy, l1_budget_bytes);
     const Lwt2DBandSourceRectangles final_band_sources{
         .ll = interval_product(exact_y_cone.final_even, exact_x_cone.final_even),
@@ -584,7 +786,7 @@ inline void append_axis_routes(
         .oe = interval_product(exact_y_cone.initial_odd, exact_x_cone.initial_even),
         .oo = interval_product(exact_y_cone.initial_odd, exact_x_cone.initial_odd),
     };
-    const auto route_elements = [](const std::vector<Lwt2DRoutePlan>& schedule) {
+    const auto route_elements = [](const std::span<const Lwt2DRoutePlan> schedule) {
         uint64_t elements = 0;
         for (const Lwt2DRoutePlan& route : schedule) {
             elements += route.output.area();
@@ -595,8 +797,21 @@ inline void append_axis_routes(
         return static_cast<uint64_t>(y.final_even.length() + y.final_odd.length()) *
                static_cast<uint64_t>(x.final_even.length() + x.final_odd.length());
     };
-    const uint64_t exact_route_elements = route_elements(exact_routes);
     const uint64_t internal_route_elements = route_elements(routes);
+    uint64_t exact_route_elements = internal_route_elements;
+    if (tile_closed) {
+        std::pmr::vector<Lwt2DRoutePlan> exact_schedule(resource);
+        build_route_schedule(
+            exact_y_cone,
+            exact_x_cone,
+            workspace_policy,
+            fuse_terminal_scale ? &y_terminal_scale : nullptr,
+            fuse_terminal_scale ? &x_terminal_scale : nullptr,
+            exact_schedule);
+        exact_route_elements = route_elements(exact_schedule);
+    }
+    const uint64_t exact_final_elements = final_work_elements(exact_y_cone, exact_x_cone);
+    const uint64_t internal_final_elements = final_work_elements(y_cone, x_cone);
 
     return Lwt2DChunkPlan{
         .final_band_rect = final_band_rect,
@@ -617,7 +832,7 @@ inline void append_axis_routes(
         .x_cone = std::move(x_cone),
         .initial = initial,
         .workspace_policy = workspace_policy,
-        .routes = std::move(routes),
+        .routes = route_table.append(routes),
         .final_bands = final_bands,
         .final_band_sources = final_band_sources,
         .resources = resources,
@@ -626,8 +841,8 @@ inline void append_axis_routes(
         .internal_initial_elements = initial.total_area(),
         .exact_route_elements = exact_route_elements,
         .internal_route_elements = internal_route_elements,
-        .exact_final_elements = final_work_elements(exact_y_cone, exact_x_cone),
-        .internal_final_elements = final_work_elements(y_cone, x_cone),
+        .exact_final_elements = exact_final_elements,
+        .internal_final_elements = internal_final_elements,
     };
 }
 
@@ -638,14 +853,20 @@ inline void append_axis_routes(
     const uint32_t chunk_tiles_x,
     const uint64_t l1_budget_bytes,
     const bool fuse_terminal_scale,
-    const Lwt2DRouteDomainPolicy route_domain) {
+    const Lwt2DRouteDomainPolicy route_domain,
+    Lwt2DRouteTable& route_table,
+    std::pmr::memory_resource* const scratch = nullptr) {
     TT_FATAL(chunk_tiles_y > 0 && chunk_tiles_x > 0, "2D LWT chunk tile dimensions must be positive");
     const size_t chunk_height = static_cast<size_t>(chunk_tiles_y) * kTileHeight;
     const size_t chunk_width = static_cast<size_t>(chunk_tiles_x) * kTileWidth;
     std::vector<Lwt2DChunkPlan> chunks;
     const size_t chunk_rows = ceil_div(y_plan.output_length, chunk_height);
     const size_t chunk_cols = ceil_div(x_plan.output_length, chunk_width);
-    chunks.reserve(checked_area(chunk_rows, chunk_cols, "2D LWT chunk grid"));
+    const size_t chunk_count = checked_area(chunk_rows, chunk_cols, "2D LWT chunk grid");
+    std::pmr::memory_resource* const resource = scratch == nullptr ? std::pmr::get_default_resource() : scratch;
+    route_table.reset(chunk_count * (2 * y_plan.routes.size() + 2 * x_plan.routes.size()));
+    std::pmr::vector<Lwt2DRoutePlan> schedule(resource);
+    chunks.reserve(chunk_count);
     for (size_t y = 0; y < y_plan.output_length;) {
         const size_t y_end = y + std::min(chunk_height, y_plan.output_length - y);
         for (size_t x = 0; x < x_plan.output_length;) {
@@ -659,7 +880,10 @@ inline void append_axis_routes(
                 },
                 l1_budget_bytes,
                 fuse_terminal_scale,
-                route_domain));
+                route_domain,
+                route_table,
+                schedule,
+                resource));
             x = x_end;
         }
         y = y_end;
@@ -725,6 +949,7 @@ enum class AlignmentCostClass : uint8_t {
 
 [[nodiscard]] inline uint64_t estimate_chunk_latency_cycles(
     const Lwt2DChunkPlan& chunk,
+    const Lwt2DRouteTable& route_table,
     const LiftingForwardPlan& y_plan,
     const LiftingForwardPlan& x_plan,
     const bool inverse = false) {
@@ -741,7 +966,8 @@ enum class AlignmentCostClass : uint8_t {
         chunk.initial.oo,
         IndexRectangle{},
     };
-    for (const Lwt2DRoutePlan& route : chunk.routes) {
+    for (size_t route_index = 0; route_index < chunk.routes.size(); ++route_index) {
+        const Lwt2DRoutePlan route = route_table.at(chunk.routes, route_index);
         cycles += route_config_and_sync_cycles;
         if (route.output.empty()) {
             continue;
@@ -815,6 +1041,7 @@ enum class AlignmentCostClass : uint8_t {
 
 [[nodiscard]] inline uint64_t estimate_candidate_latency_cycles(
     const std::vector<Lwt2DChunkPlan>& chunks,
+    const Lwt2DRouteTable& route_table,
     const uint32_t active_core_count,
     const LiftingForwardPlan& y_plan,
     const LiftingForwardPlan& x_plan,
@@ -823,7 +1050,7 @@ enum class AlignmentCostClass : uint8_t {
     std::vector<uint64_t> chunk_costs;
     chunk_costs.reserve(chunks.size());
     for (const Lwt2DChunkPlan& chunk : chunks) {
-        chunk_costs.push_back(estimate_chunk_latency_cycles(chunk, y_plan, x_plan, inverse));
+        chunk_costs.push_back(estimate_chunk_latency_cycles(chunk, route_table, y_plan, x_plan, inverse));
     }
     const size_t base = chunks.size() / active_core_count;
     const size_t extra = chunks.size() % active_core_count;
@@ -919,39 +1146,59 @@ enum class AlignmentCostClass : uint8_t {
     const uint32_t band_tiles_y = static_cast<uint32_t>(band_tiles_y_size);
     const uint32_t band_tiles_x = static_cast<uint32_t>(band_tiles_x_size);
 
+    // Candidate chunks only feed the fit check and the latency model, so they
+    // are built in one arena that is rewound after every tile shape. The
+    // winning shape is rebuilt on the default resource for the returned plan.
+    // Their routes share one table whose columns grow to the largest grid.
+    std::pmr::monotonic_buffer_resource candidate_arena;
+    Lwt2DRouteTable candidate_routes;
+    const auto evaluate = [&](const uint32_t tiles_y,
+                              const uint32_t tiles_x) -> std::optional<plan_2d_detail::Candidate> {
+        const std::vector<Lwt2DChunkPlan> chunks = plan_2d_detail::build_chunks(
+            y_plan,
+            x_plan,
+            tiles_y,
+            tiles_x,
+            l1_budget_bytes,
+            fuse_terminal_scale,
+            route_domain,
+            candidate_routes,
+            &candidate_arena);
+        uint64_t max_l1_bytes = 0;
+        double max_dependency_overhead = 0.0;
+        for (const Lwt2DChunkPlan& chunk : chunks) {
+            if (chunk.resources.total_l1_bytes > l1_budget_bytes) {
+                return std::nullopt;
+            }
+            max_l1_bytes = std::max(max_l1_bytes, chunk.resources.total_l1_bytes);
+            max_dependency_overhead = std::max(max_dependency_overhead, chunk.dependency_overhead);
+        }
+        const uint32_t active_core_count =
+            static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit)));
+        return plan_2d_detail::Candidate{
+            .chunk_tiles_y = tiles_y,
+            .chunk_tiles_x = tiles_x,
+            .active_core_count = active_core_count,
+            .max_l1_bytes = max_l1_bytes,
+            .max_dependency_overhead = max_dependency_overhead,
+            .estimated_latency_cycles =
+                plan_2d_detail::estimate_candidate_latency_cycles(
+                    chunks, candidate_routes, active_core_count, y_plan, x_plan),
+            .chunks = {},
+        };
+    };
+
     plan_2d_detail::Candidate best{};
     bool found = false;
     for (uint32_t tiles_y = 1; tiles_y <= band_tiles_y; ++tiles_y) {
         for (uint32_t tiles_x = 1; tiles_x <= band_tiles_x; ++tiles_x) {
-            std::vector<Lwt2DChunkPlan> chunks = plan_2d_detail::build_chunks(
-                y_plan, x_plan, tiles_y, tiles_x, l1_budget_bytes, fuse_terminal_scale, route_domain);
-            uint64_t max_l1_bytes = 0;
-            double max_dependency_overhead = 0.0;
-            bool fits = true;
-            for (const Lwt2DChunkPlan& chunk : chunks) {
-                max_l1_bytes = std::max(max_l1_bytes, chunk.resources.total_l1_bytes);
-                max_dependency_overhead = std::max(max_dependency_overhead, chunk.dependency_overhead);
-                fits = fits && chunk.resources.total_l1_bytes <= l1_budget_bytes;
-            }
-            if (!fits) {
+            std::optional<plan_2d_detail::Candidate> candidate = evaluate(tiles_y, tiles_x);
+            candidate_arena.release();
+            if (!candidate.has_value()) {
                 continue;
             }
-
-            plan_2d_detail::Candidate candidate{
-                .chunk_tiles_y = tiles_y,
-                .chunk_tiles_x = tiles_x,
-                .active_core_count = static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit))),
-                .max_l1_bytes = max_l1_bytes,
-                .max_dependency_overhead = max_dependency_overhead,
-                .estimated_latency_cycles = plan_2d_detail::estimate_candidate_latency_cycles(
-                    chunks,
-                    static_cast<uint32_t>(std::min(chunks.size(), static_cast<size_t>(core_limit))),
-                    y_plan,
-                    x_plan),
-                .chunks = std::move(chunks),
-            };
-            if (!found || plan_2d_detail::is_better_candidate(candidate, best, latency_oriented_planner)) {
-                best = std::move(candidate);
+            if (!found || plan_2d_detail::is_better_candidate(*candidate, best, latency_oriented_planner)) {
+                best = std::move(*candidate);
                 found = true;
             }
         }
@@ -963,6 +1210,16 @@ enum class AlignmentCostClass : uint8_t {
         l1_budget_bytes,
         y_plan.preprocess_layout.input.length,
         x_plan.preprocess_layout.input.length);
+    Lwt2DRouteTable route_table;
+    best.chunks = plan_2d_detail::build_chunks(
+        y_plan,
+        x_plan,
+        best.chunk_tiles_y,
+        best.chunk_tiles_x,
+        l1_budget_bytes,
+        fuse_terminal_scale,
+        route_domain,
+        route_table);
     const size_t input_height = y_plan.preprocess_layout.input.length;
     const size_t input_width = x_plan.preprocess_layout.input.length;
     const size_t band_height = y_plan.output_length;
@@ -1003,14 +1260,18 @@ enum class AlignmentCostClass : uint8_t {
         "2D uniform workspace allocation requires {} bytes per core, exceeding the {}-byte L1 budget",
         allocated_l1_bytes,
         l1_budget_bytes);
-    const uint32_t executable_route_count = static_cast<uint32_t>(std::count_if(
-        best.chunks.front().routes.begin(), best.chunks.front().routes.end(), [](const Lwt2DRoutePlan& route) {
-            return !route.output.empty();
-        }));
-    const uint32_t scale_routes_removed = static_cast<uint32_t>(std::count_if(
-        best.chunks.front().routes.begin(), best.chunks.front().routes.end(), [](const Lwt2DRoutePlan& route) {
-            return is_scale_step(route.type) && route.output.empty();
-        }));
+    const RouteRange first_routes = best.chunks.front().routes;
+    const std::span<const IndexRectangle> first_outputs = route_table.rows_of(route_table.output, first_routes);
+    const std::span<const StepType> first_types = route_table.rows_of(route_table.type, first_routes);
+    uint32_t executable_route_count = 0;
+    uint32_t scale_routes_removed = 0;
+    for (size_t route_index = 0; route_index < first_routes.size(); ++route_index) {
+        if (!first_outputs[route_index].empty()) {
+            ++executable_route_count;
+        } else if (is_scale_step(first_types[route_index])) {
+            ++scale_routes_removed;
+        }
+    }
     uint64_t exact_initial_elements = 0;
     uint64_t internal_initial_elements = 0;
     uint64_t exact_route_elements = 0;
@@ -1042,6 +1303,7 @@ enum class AlignmentCostClass : uint8_t {
         .route_domain = route_domain,
         .estimated_latency_cycles = best.estimated_latency_cycles,
         .chunks = std::move(best.chunks),
+        .route_table = std::move(route_table),
         .max_dependency_overhead = best.max_dependency_overhead,
         .max_l1_bytes = best.max_l1_bytes,
         .allocated_plane_heights_elements = allocated_plane_heights,
@@ -1068,6 +1330,7 @@ template <typename Scheme>
     const bool fuse_terminal_scale = false,
     const bool latency_oriented_planner = false,
     const Lwt2DRouteDomainPolicy route_domain = Lwt2DRouteDomainPolicy::kExact) {
+    static_assert(rounded_step_count<Scheme>() == 0, "Rounded integer schemes run on the integer host executor");
     TT_FATAL(input_height > 0 && input_width > 0, "2D LWT input dimensions must be positive");
     const SignalBuffer y_input{
         .length = input_height,
@@ -1092,21 +1355,56 @@ template <typename Scheme>
 namespace plan_2d_detail {
 
 inline void write_protocol_rectangle(
-    std::vector<uint32_t>& words, const size_t offset, const IndexRectangle rectangle) {
+    const std::span<uint32_t> words, const size_t offset, const IndexRectangle rectangle) {
     words[offset + device_protocol::kLwt2DRectYBegin] = checked_u32(rectangle.y.begin, "2D rectangle y begin");
     words[offset + device_protocol::kLwt2DRectYLength] = checked_u32(rectangle.y.length(), "2D rectangle height");
     words[offset + device_protocol::kLwt2DRectXBegin] = checked_u32(rectangle.x.begin, "2D rectangle x begin");
     words[offset + device_protocol::kLwt2DRectXLength] = checked_u32(rectangle.x.length(), "2D rectangle width");
 }
 
+inline std::span<uint32_t> prepare_config_words(
+    const std::span<uint32_t> words, const size_t word_count, const char* label) {
+    TT_FATAL(
+        words.size() >= word_count, "{} upload buffer holds {} words, {} required", label, words.size(), word_count);
+    const std::span<uint32_t> output = words.first(word_count);
+    std::fill(output.begin(), output.end(), 0U);
+    return output;
+}
+
 }  // namespace plan_2d_detail
 
-[[nodiscard]] inline std::vector<uint32_t> build_lwt_2d_chunk_config_words(const Lwt2DExecutionPlan& plan) {
+[[nodiscard]] inline size_t lwt_2d_chunk_config_word_count(const Lwt2DExecutionPlan& plan) noexcept {
+    return plan.chunks.size() * device_protocol::kLwt2DChunkConfigWordCount;
+}
+
+[[nodiscard]] inline size_t lwt_2d_route_config_word_count(const Lwt2DExecutionPlan& plan) noexcept {
+    return plan.chunks.size() * (2 * plan.y_plan.routes.size() + 2 * plan.x_plan.routes.size()) *
+           device_protocol::kLwt2DRouteConfigWordCount;
+}
+
+[[nodiscard]] inline size_t lwt_2d_band_config_word_count(const Lwt2DExecutionPlan& plan) noexcept {
+    return plan.chunks.size() * device_protocol::kLwt2DBandConfigWordCount;
+}
+
+// Chunk, route and band pages back to back in one staging buffer.
+[[nodiscard]] inline size_t lwt_2d_config_upload_word_count(const Lwt2DExecutionPlan& plan) noexcept {
+    return lwt_2d_chunk_config_word_count(plan) + lwt_2d_route_config_word_count(plan) +
+           lwt_2d_band_config_word_count(plan);
+}
+
+// The chunk, route and band writers place chunk `chunk_at_page(chunk_order, p)`
+// at page p of their buffers.
+inline std::span<uint32_t> write_lwt_2d_chunk_config_words(
+    const Lwt2DExecutionPlan& plan,
+    const std::span<uint32_t> upload_words,
+    const std::span<const uint32_t> chunk_order = {}) {
     TT_FATAL(!plan.chunks.empty(), "2D LWT chunk protocol requires at least one chunk");
-    std::vector<uint32_t> words(plan.chunks.size() * device_protocol::kLwt2DChunkConfigWordCount, 0);
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const Lwt2DChunkPlan& chunk = plan.chunks[chunk_index];
-        const size_t offset = chunk_index * device_protocol::kLwt2DChunkConfigWordCount;
+    validate_chunk_page_order(chunk_order, plan.chunks.size());
+    const std::span<uint32_t> words = plan_2d_detail::prepare_config_words(
+        upload_words, lwt_2d_chunk_config_word_count(plan), "2D LWT chunk config");
+    for (size_t page_index = 0; page_index < plan.chunks.size(); ++page_index) {
+        const Lwt2DChunkPlan& chunk = plan.chunks[chunk_at_page(chunk_order, page_index)];
+        const size_t offset = page_index * device_protocol::kLwt2DChunkConfigWordCount;
         words[offset + device_protocol::kLwt2DFinalYBegin] =
             plan_2d_detail::checked_u32(chunk.final_band_rect.y.begin, "2D final y begin");
         words[offset + device_protocol::kLwt2DFinalYLength] =
@@ -1131,20 +1429,31 @@ inline void write_protocol_rectangle(
     return words;
 }
 
-[[nodiscard]] inline std::vector<uint32_t> build_lwt_2d_route_config_words(const Lwt2DExecutionPlan& plan) {
+[[nodiscard]] inline std::vector<uint32_t> build_lwt_2d_chunk_config_words(const Lwt2DExecutionPlan& plan) {
+    std::vector<uint32_t> words(lwt_2d_chunk_config_word_count(plan));
+    write_lwt_2d_chunk_config_words(plan, words);
+    return words;
+}
+
+inline std::span<uint32_t> write_lwt_2d_route_config_words(
+    const Lwt2DExecutionPlan& plan,
+    const std::span<uint32_t> upload_words,
+    const std::span<const uint32_t> chunk_order = {}) {
     TT_FATAL(!plan.chunks.empty(), "2D LWT route protocol requires at least one chunk");
+    validate_chunk_page_order(chunk_order, plan.chunks.size());
     const size_t route_count = plan.chunks.front().routes.size();
     TT_FATAL(
         route_count == 2 * plan.y_plan.routes.size() + 2 * plan.x_plan.routes.size(),
         "2D LWT route protocol has an unexpected route count");
-    std::vector<uint32_t> words(plan.chunks.size() * route_count * device_protocol::kLwt2DRouteConfigWordCount, 0);
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const Lwt2DChunkPlan& chunk = plan.chunks[chunk_index];
+    const std::span<uint32_t> words = plan_2d_detail::prepare_config_words(
+        upload_words, lwt_2d_route_config_word_count(plan), "2D LWT route config");
+    for (size_t page_index = 0; page_index < plan.chunks.size(); ++page_index) {
+        const Lwt2DChunkPlan& chunk = plan.chunks[chunk_at_page(chunk_order, page_index)];
         TT_FATAL(chunk.routes.size() == route_count, "2D LWT chunks have inconsistent route counts");
         for (size_t route_index = 0; route_index < route_count; ++route_index) {
-            const Lwt2DRoutePlan& route = chunk.routes[route_index];
+            const Lwt2DRoutePlan route = plan.route_table.at(chunk.routes, route_index);
             const size_t offset =
-                (chunk_index * route_count + route_index) * device_protocol::kLwt2DRouteConfigWordCount;
+                (page_index * route_count + route_index) * device_protocol::kLwt2DRouteConfigWordCount;
             words[offset + device_protocol::kLwt2DRouteAxis] = static_cast<uint32_t>(route.axis);
             words[offset + device_protocol::kLwt2DRouteType] = static_cast<uint32_t>(route.type);
             words[offset + device_protocol::kLwt2DRouteSourceSlot] = static_cast<uint32_t>(route.source_slot);
@@ -1173,12 +1482,23 @@ inline void write_protocol_rectangle(
     return words;
 }
 
-[[nodiscard]] inline std::vector<uint32_t> build_lwt_2d_band_config_words(const Lwt2DExecutionPlan& plan) {
+[[nodiscard]] inline std::vector<uint32_t> build_lwt_2d_route_config_words(const Lwt2DExecutionPlan& plan) {
+    std::vector<uint32_t> words(lwt_2d_route_config_word_count(plan));
+    write_lwt_2d_route_config_words(plan, words);
+    return words;
+}
+
+inline std::span<uint32_t> write_lwt_2d_band_config_words(
+    const Lwt2DExecutionPlan& plan,
+    const std::span<uint32_t> upload_words,
+    const std::span<const uint32_t> chunk_order = {}) {
     TT_FATAL(!plan.chunks.empty(), "2D LWT band protocol requires at least one chunk");
-    std::vector<uint32_t> words(plan.chunks.size() * device_protocol::kLwt2DBandConfigWordCount, 0);
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const Lwt2DChunkPlan& chunk = plan.chunks[chunk_index];
-        const size_t offset = chunk_index * device_protocol::kLwt2DBandConfigWordCount;
+    validate_chunk_page_order(chunk_order, plan.chunks.size());
+    const std::span<uint32_t> words = plan_2d_detail::prepare_config_words(
+        upload_words, lwt_2d_band_config_word_count(plan), "2D LWT band config");
+    for (size_t page_index = 0; page_index < plan.chunks.size(); ++page_index) {
+        const Lwt2DChunkPlan& chunk = plan.chunks[chunk_at_page(chunk_order, page_index)];
+        const size_t offset = page_index * device_protocol::kLwt2DBandConfigWordCount;
         words[offset + device_protocol::kLwt2DBandFinalYBegin] =
             plan_2d_detail::checked_u32(chunk.final_band_rect.y.begin, "2D final band y begin");
         words[offset + device_protocol::kLwt2DBandFinalYLength] =
@@ -1200,4 +1520,10 @@ inline void write_protocol_rectangle(
     return words;
 }
 
+[[nodiscard]] inline std::vector<uint32_t> build_lwt_2d_band_config_words(const Lwt2DExecutionPlan& plan) {
+    std::vector<uint32_t> words(lwt_2d_band_config_word_count(plan));
+    write_lwt_2d_band_config_words(plan, words);
+    return words;
+}
+
 }  // namespace ttwv
@@ -0,0 +1,397 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/lifting/device_planning.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/host_executor.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+#include "tt_wavelet/include/lifting/static_scheme.hpp"
+
+namespace ttwv {
+
+/**
+ * One analysis filter of a polyphase FIR bank.
+ *
+ * Output i is the dot product of `taps` with the boundary-extended input
+ * starting at index 2 * i + offset, so both bands read the signal directly
+ * at stride two instead of through lifting streams.
+ */
+struct PolyphaseFirFilter {
+    int64_t offset{0};
+    std::vector<float> taps;
+};
+
+/**
+ * Analysis filter bank equivalent to a lifting scheme's forward transform.
+ *
+ * The bank computes the same canonical outputs as make_forward_lifting_plan
+ * with the scheme's own wavelet padding; it differs from the lifting result
+ * only by float rounding of the composed taps and of the accumulation.
+ * `lifting_deviation` measures that difference on a probe signal, relative
+ * to the largest lifting output; it stays infinite until measured.
+ */
+struct PolyphaseFirBank {
+    PolyphaseFirFilter approximation{};
+    PolyphaseFirFilter detail{};
+    uint32_t tap_size{0};
+    double lifting_deviation{std::numeric_limits<double>::infinity()};
+
+    [[nodiscard]] size_t tap_count() const noexcept {
+        return approximation.taps.size() + detail.taps.size();
+    }
+    [[nodiscard]] size_t output_length(
+        const size_t input_length, const BoundaryMode mode = BoundaryMode::kSymmetric) const noexcept {
+        if (mode == BoundaryMode::kPeriodization) {
+            return (input_length + 1) / size_t{2};
+        }
+        return (input_length + tap_size - 1) / size_t{2};
+    }
+    // Periodization output i sits tap_size / 2 - 1 samples further along the
+    // input than canonical output i, as in forward_lifting_output_phase.
+    [[nodiscard]] int64_t window_shift(const BoundaryMode mode) const noexcept {
+        return mode == BoundaryMode::kPeriodization ? int64_t{tap_size / 2} - 1 : 0;
+    }
+};
+
+namespace polyphase_fir_detail {
+
+// A stream sample at position n as sum(even[l] * E(n - l)) + sum(odd[l] * O(n - l))
+// over the initial even/odd streams, keyed by lag l.
+struct StreamTerms {
+    std::map<int64_t, double> even;
+    std::map<int64_t, double> odd;
+};
+
+inline void scale_terms(StreamTerms& terms, const double factor) {
+    for (auto& [lag, coefficient] : terms.even) {
+        coefficient *= factor;
+    }
+    for (auto& [lag, coefficient] : terms.odd) {
+        coefficient *= factor;
+    }
+}
+
+inline void accumulate_terms(
+    StreamTerms& base, const StreamTerms& source, const int64_t lag, const double coefficient) {
+    for (const auto& [source_lag, value] : source.even) {
+        base.even[source_lag + lag] += coefficient * value;
+    }
+    for (const auto& [source_lag, value] : source.odd) {
+        base.odd[source_lag + lag] += coefficient * value;
+    }
+}
+
+template <typename Scheme, size_t Index = 0>
+inline void compose_steps(StreamTerms& even, StreamTerms& odd) {
+    if constexpr (Index < Scheme::num_steps) {
+        using Step = SchemeStep<Scheme, Index>;
+        static_assert(!is_rounded_step(Step::type), "Rounded integer steps have no linear FIR equivalent");
+        if constexpr (Step::type == StepType::kSwap) {
+            std::swap(even, odd);
+        } else if constexpr (Step::type == StepType::kScaleEven) {
+            scale_terms(even, std::bit_cast<float>(Step::coeff_bits[0]));
+        } else if constexpr (Step::type == StepType::kScaleOdd) {
+            scale_terms(odd, std::bit_cast<float>(Step::coeff_bits[0]));
+        } else {
+            // out(n) = base(n) + sum_j c[j] * src(n - shift - j), composed in
+            // double so the bank rounds each tap once.
+            StreamTerms& base = Step::type == StepType::kPredict ? odd : even;
+            const StreamTerms source = Step::type == StepType::kPredict ? even : odd;
+            for (uint32_t j = 0; j < Step::k; ++j) {
+                accumulate_terms(
+                    base, source, int64_t{Step::shift} + j, std::bit_cast<float>(Step::coeff_bits[j]));
+            }
+        }
+        compose_steps<Scheme, Index + 1>(even, odd);
+    }
+}
+
+// Canonical output i sits at stream position tap_size / 2 + i; initial
+// stream sample q of phase p is padded sample 2 * (q - delay) + p, and the
+// padded signal starts tap_size - 1 samples before the input.
+template <typename Scheme>
+[[nodiscard]] PolyphaseFirFilter make_filter(const StreamTerms& terms) {
+    const int64_t center = Scheme::tap_size / 2;
+    const int64_t left_pad = int64_t{Scheme::tap_size} - 1;
+    std::map<int64_t, double> by_offset;
+    for (const auto& [lag, coefficient] : terms.even) {
+        by_offset[2 * (center - lag - Scheme::delay_even) - left_pad] += coefficient;
+    }
+    for (const auto& [lag, coefficient] : terms.odd) {
+        by_offset[2 * (center - lag - Scheme::delay_odd) + 1 - left_pad] += coefficient;
+    }
+    std::erase_if(by_offset, [](const auto& entry) { return entry.second == 0.0; });
+    TT_FATAL(!by_offset.empty(), "Polyphase FIR bank of scheme {} has an empty filter", Scheme::name);
+
+    PolyphaseFirFilter filter{.offset = by_offset.begin()->first, .taps = {}};
+    filter.taps.assign(static_cast<size_t>(by_offset.rbegin()->first - filter.offset + 1), 0.0F);
+    for (const auto& [offset, coefficient] : by_offset) {
+        filter.taps[static_cast<size_t>(offset - filter.offset)] = static_cast<float>(coefficient);
+    }
+    return filter;
+}
+
+// Outputs [begin, end) whose window, starting at 2 * i + offset, lies inside
+// an input of `length` samples; the rest read through the boundary extension.
+[[nodiscard]] inline IndexInterval interior_outputs(
+    const PolyphaseFirFilter& filter, const int64_t offset, const size_t length, const size_t count) noexcept {
+    const int64_t last_window = static_cast<int64_t>(length) - static_cast<int64_t>(filter.taps.size()) - offset;
+    const int64_t begin = std::clamp<int64_t>((1 - offset) / 2, 0, static_cast<int64_t>(count));
+    const int64_t end =
+        std::clamp<int64_t>(last_window < 0 ? 0 : last_window / 2 + 1, begin, static_cast<int64_t>(count));
+    return IndexInterval{.begin = static_cast<size_t>(begin), .end = static_cast<size_t>(end)};
+}
+
+inline void apply_filter(
+    const PolyphaseFirFilter& filter,
+    const int64_t offset,
+    const std::span<const float> input,
+    const BoundaryMode mode,
+    const std::span<float> output) {
+    const size_t taps = filter.taps.size();
+    const IndexInterval interior = interior_outputs(filter, offset, input.size(), output.size());
+    const auto edge = [&](const size_t i) {
+        const int64_t first = 2 * static_cast<int64_t>(i) + offset;
+        float value = 0.0F;
+        for (size_t t = 0; t < taps; ++t) {
+            value += filter.taps[t] *
+                     host_executor_detail::read_extended_sample(input, mode, first + static_cast<int64_t>(t));
+        }
+        output[i] = value;
+    };
+    for (size_t i = 0; i < interior.begin; ++i) {
+        edge(i);
+    }
+    for (size_t i = interior.begin; i < interior.end; ++i) {
+        const float* window = input.data() + static_cast<int64_t>(2 * i) + offset;
+        float value = 0.0F;
+        for (size_t t = 0; t < taps; ++t) {
+            value += filter.taps[t] * window[t];
+        }
+        output[i] = value;
+    }
+    for (size_t i = interior.end; i < output.size(); ++i) {
+        edge(i);
+    }
+}
+
+// Long enough for interior outputs to outnumber the edges of every scheme.
+inline constexpr size_t kDeviationProbeMinLength = 512;
+
+// Runs the bank and the lifting host executor over one probe signal and
+// returns their largest difference relative to the largest lifting output.
+template <typename Scheme>
+[[nodiscard]] double measure_lifting_deviation(
+    const PolyphaseFirFilter& approximation_filter, const PolyphaseFirFilter& detail_filter) {
+    const size_t length = std::max(kDeviationProbeMinLength, 8 * size_t{Scheme::tap_size});
+    const LwtExecutionPlan plan = make_lwt_execution_plan(
+        make_forward_lifting_plan<Scheme>(SignalBuffer{.length = length}, 0, 0, BoundaryMode::kSymmetric),
+        1,
+        kDefaultL1SignalBudgetBytes);
+    std::vector<float> input(length);
+    for (size_t n = 0; n < length; ++n) {
+        input[n] = std::sin(0.37F * static_cast<float>(n)) + 0.25F * std::cos(1.9F * static_cast<float>(n));
+    }
+    const size_t output_length = plan.full_plan.output_length;
+    std::vector<float> lifting(2 * output_length);
+    std::vector<float> fir(2 * output_length);
+    const std::span<float> lifting_bands{lifting};
+    const std::span<float> fir_bands{fir};
+    execute_lwt_on_host(
+        plan,
+        make_host_lwt_route_coefficients<Scheme>(plan.full_plan),
+        input,
+        lifting_bands.first(output_length),
+        lifting_bands.last(output_length));
+    apply_filter(
+        approximation_filter,
+        approximation_filter.offset,
+        input,
+        BoundaryMode::kSymmetric,
+        fir_bands.first(output_length));
+    apply_filter(detail_filter, detail_filter.offset, input, BoundaryMode::kSymmetric, fir_bands.last(output_length));
+
+    double largest = 0.0;
+    double difference = 0.0;
+    for (size_t i = 0; i < lifting.size(); ++i) {
+        largest = std::max(largest, static_cast<double>(std::abs(lifting[i])));
+        difference = std::max(difference, static_cast<double>(std::abs(fir[i] - lifting[i])));
+    }
+    return largest > 0.0 ? difference / largest : difference;
+}
+
+}  // namespace polyphase_fir_detail
+
+/**
+ * Compose the forward steps of `Scheme` into its two analysis filters.
+ *
+ * The bank's deviation from lifting depends only on the scheme, so it is
+ * probed on the first call and reused after that.
+ */
+template <typename Scheme>
+[[nodiscard]] PolyphaseFirBank make_polyphase_fir_bank() {
+    polyphase_fir_detail::StreamTerms even{.even = {{0, 1.0}}, .odd = {}};
+    polyphase_fir_detail::StreamTerms odd{.even = {}, .odd = {{0, 1.0}}};
+    polyphase_fir_detail::compose_steps<Scheme>(even, odd);
+    PolyphaseFirBank bank{
+        .approximation = polyphase_fir_detail::make_filter<Scheme>(even),
+        .detail = polyphase_fir_detail::make_filter<Scheme>(odd),
+        .tap_size = Scheme::tap_size,
+    };
+    static const double lifting_deviation =
+        polyphase_fir_detail::measure_lifting_deviation<Scheme>(bank.approximation, bank.detail);
+    bank.lifting_deviation = lifting_deviation;
+    return bank;
+}
+
+/**
+ * Run a polyphase FIR bank on the host.
+ *
+ * As with execute_lwt_on_host, the sizes of `approximation` and `detail`
+ * select how many canonical outputs are computed.
+ */
+inline void execute_polyphase_fir_on_host(
+    const PolyphaseFirBank& bank,
+    const std::span<const float> input,
+    const BoundaryMode boundary_mode,
+    const std::span<float> approximation,
+    const std::span<float> detail) {
+    TT_FATAL(!input.empty(), "Polyphase FIR input must be non-empty");
+    const size_t output_length = bank.output_length(input.size(), boundary_mode);
+    TT_FATAL(
+        approximation.size() <= output_length && detail.size() <= output_length,
+        "Polyphase FIR of {} samples produces at most {} outputs per band",
+        input.size(),
+        output_length);
+    const int64_t shift = bank.window_shift(boundary_mode);
+    polyphase_fir_detail::apply_filter(
+        bank.approximation, bank.approximation.offset + shift, input, boundary_mode, approximation);
+    polyphase_fir_detail::apply_filter(bank.detail, bank.detail.offset + shift, input, boundary_mode, detail);
+}
+
+enum class LwtEngine : uint8_t {
+    kLifting = 0,
+    kPolyphaseFir = 1,
+};
+
+[[nodiscard]] constexpr const char* lwt_engine_name(const LwtEngine engine) noexcept {
+    return engine == LwtEngine::kPolyphaseFir ? "polyphase_fir" : "lifting";
+}
+
+/**
+ * Relative costs of the two host engines, in units of a sixteenth of one
+ * interior FIR tap, and the conditions under which FIR may replace lifting.
+ *
+ * Lifting loads its initial cones through the boundary extension, and
+ * every route reads its base, stores its output to a workspace slot and
+ * pays a fixed setup per chunk; its stencils vectorize across samples, so
+ * a tap is cheaper than an FIR tap. The FIR bank reads interior windows in
+ * place but extends every tap of an edge output, and is composed once per
+ * batch. Fitted by least squares to engine_selection timings of all
+ * schemes at 4096 and 262144 samples, where the per-sample fits leave
+ * about 10% (lifting) and 20% (FIR) residuals at the 90th percentile.
+ *
+ * FIR must therefore undercut lifting by `polyphase_fir_margin_percent`,
+ * and its bank must match lifting within `polyphase_fir_max_deviation`;
+ * long db and coif schemes lose precision when composed or lifted in float
+ * and never qualify.
+ */
+struct LwtEngineCostModel {
+    uint64_t lifting_initial_sample{10};
+    uint64_t lifting_tap{13};
+    uint64_t lifting_route_sample{42};
+    uint64_t lifting_route_setup{400};
+    uint64_t polyphase_fir_tap{16};
+    uint64_t polyphase_fir_edge_tap{120};
+    uint64_t polyphase_fir_sample{12};
+    uint64_t polyphase_fir_compose_tap{16384};
+    uint64_t polyphase_fir_margin_percent{20};
+    double polyphase_fir_max_deviation{1e-5};
+};
+
+/**
+ * Engine chosen for one (scheme, length, batch) and the modeled costs it
+ * was chosen on, for telemetry.
+ */
+struct LwtEngineSelection {
+    LwtEngine engine{LwtEngine::kLifting};
+    uint32_t batch_count{1};
+    uint32_t lifting_route_count{0};
+    uint32_t lifting_taps{0};
+    uint32_t polyphase_fir_taps{0};
+    uint64_t polyphase_fir_edge_outputs{0};
+    uint64_t lifting_cost{0};
+    uint64_t polyphase_fir_cost{0};
+    double polyphase_fir_deviation{0.0};
+};
+
+/**
+ * Pick the cheaper host engine for `batch_count` signals of the planned
+ * length. `coefficients` are the plan's route coefficients, as passed to
+ * execute_lwt_on_host. Near-ties and inaccurate banks keep lifting, which
+ * runs on device as well.
+ */
+[[nodiscard]] inline LwtEngineSelection select_lwt_engine(
+    const LwtExecutionPlan& plan,
+    const std::span<const HostRouteCoefficients> coefficients,
+    const PolyphaseFirBank& bank,
+    const uint32_t batch_count,
+    const LwtEngineCostModel& model = {}) {
+    TT_FATAL(batch_count > 0, "LWT engine selection requires at least one signal");
+    LwtEngineSelection selection{
+        .batch_count = batch_count,
+        .lifting_route_count = static_cast<uint32_t>(coefficients.size()),
+        .polyphase_fir_taps = static_cast<uint32_t>(bank.tap_count()),
+        .polyphase_fir_deviation = bank.lifting_deviation,
+    };
+    for (const HostRouteCoefficients& route : coefficients) {
+        selection.lifting_taps += is_predict_update_step(route.type) ? route.k : 1U;
+    }
+
+    uint64_t lifting_cost = 0;
+    for (const LwtChunkPlan& chunk : plan.chunks) {
+        lifting_cost += (chunk.initial_even.length() + chunk.initial_odd.length()) * model.lifting_initial_sample;
+        for (size_t route_index = 0; route_index < chunk.routes.size(); ++route_index) {
+            const LwtStepRoute route = plan.route_table.at(chunk.routes, route_index);
+            const uint64_t taps = is_predict_update_step(route.type) ? coefficients[route_index].k : 1U;
+            lifting_cost += uint64_t{route.output_length} * (taps * model.lifting_tap + model.lifting_route_sample) +
+                            model.lifting_route_setup;
+        }
+    }
+
+    const size_t input_length = plan.full_plan.preprocess_layout.input.length;
+    const size_t output_length = plan.full_plan.output_length;
+    const int64_t shift = bank.window_shift(plan.full_plan.preprocess_layout.pad_config.mode);
+    uint64_t fir_cost = 0;
+    for (const PolyphaseFirFilter* filter : {&bank.approximation, &bank.detail}) {
+        const uint64_t interior =
+            polyphase_fir_detail::interior_outputs(*filter, filter->offset + shift, input_length, output_length)
+                .length();
+        const uint64_t edge = output_length - interior;
+        selection.polyphase_fir_edge_outputs += edge;
+        fir_cost += filter->taps.size() * (interior * model.polyphase_fir_tap + edge * model.polyphase_fir_edge_tap) +
+                    output_length * model.polyphase_fir_sample;
+    }
+
+    selection.lifting_cost = lifting_cost * batch_count;
+    selection.polyphase_fir_cost = fir_cost * batch_count + bank.tap_count() * model.polyphase_fir_compose_tap;
+    const bool fir_cheaper =
+        selection.polyphase_fir_cost * 100 < selection.lifting_cost * (100 - model.polyphase_fir_margin_percent);
+    const bool fir_accurate = bank.lifting_deviation <= model.polyphase_fir_max_deviation;
+    selection.engine = fir_cheaper && fir_accurate ? LwtEngine::kPolyphaseFir : LwtEngine::kLifting;
+    return selection;
+}
+
+}  // namespace ttwv
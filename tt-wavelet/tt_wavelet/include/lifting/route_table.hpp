@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <tt_stl/assert.hpp>
+#include <utility>
+
+#include "tt_wavelet/include/lifting/plan.hpp"
+
+namespace ttwv {
+
+/**
+ * Executable 1D route of one chunk, as written to one device route page.
+ *
+ * LwtRouteTable stores these field by field; this struct is the gathered
+ * row that planners append and readers get back from `LwtRouteTable::at`.
+ */
+struct LwtStepRoute {
+    StepType type{StepType::kPredict};
+    StreamRef source{};
+    StreamRef base{};
+    RouteOutputRef output{};
+    size_t source_storage_length{0};
+    size_t base_storage_length{0};
+    size_t source_offset_elements{0};
+    size_t base_offset_elements{0};
+    uint32_t source_left_pad_elements{0};
+    size_t output_length{0};
+    size_t output_offset_elements{0};
+};
+
+/**
+ * Rows of one chunk in its plan's LwtRouteTable.
+ */
+struct RouteRange {
+    size_t begin{0};
+    size_t count{0};
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return count; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
+};
+
+namespace route_table_detail {
+
+inline constexpr size_t kColumnCount = 11;
+inline constexpr size_t kRowBytes =
+    sizeof(StepType) + 2 * sizeof(StreamRef) + sizeof(RouteOutputRef) + 7 * sizeof(size_t) + sizeof(uint32_t);
+
+template <typename T>
+[[nodiscard]] std::span<T> allocate_column(std::pmr::memory_resource& arena, const size_t capacity) {
+    T* data = static_cast<T*>(arena.allocate(capacity * sizeof(T), alignof(T)));
+    std::uninitialized_default_construct_n(data, capacity);
+    return {data, capacity};
+}
+
+}  // namespace route_table_detail
+
+/**
+ * Structure-of-arrays route storage shared by every chunk of a 1D plan.
+ *
+ * The planner sizes the table once (chunk count times routes per chunk) and
+ * carves one column per LwtStepRoute field from a single monotonic arena, so
+ * a plan costs one allocation for all its routes instead of one per chunk.
+ * Rows are appended while the chunks are built and are read-only afterwards.
+ * Each table owns its arena: a copy allocates fresh columns of the same
+ * capacity and copies the rows, and a moved-from table is left empty.
+ */
+struct LwtRouteTable {
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+    size_t capacity{0};
+    size_t rows{0};
+    std::span<StepType> type;
+    std::span<StreamRef> source;
+    std::span<StreamRef> base;
+    std::span<RouteOutputRef> output;
+    std::span<size_t> source_storage_length;
+    std::span<size_t> base_storage_length;
+    std::span<size_t> source_offset_elements;
+    std::span<size_t> base_offset_elements;
+    std::span<uint32_t> source_left_pad_elements;
+    std::span<size_t> output_length;
+    std::span<size_t> output_offset_elements;
+
+    LwtRouteTable() = default;
+    LwtRouteTable(const LwtRouteTable& other);
+    LwtRouteTable(LwtRouteTable&& other) noexcept { swap(other); }
+    LwtRouteTable& operator=(const LwtRouteTable& other) {
+        if (this != &other) {
+            LwtRouteTable copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    LwtRouteTable& operator=(LwtRouteTable&& other) noexcept {
+        LwtRouteTable moved(std::move(other));
+        swap(moved);
+        return *this;
+    }
+    ~LwtRouteTable() = default;
+
+    void swap(LwtRouteTable& other) noexcept {
+        using std::swap;
+        swap(arena, other.arena);
+        swap(capacity, other.capacity);
+        swap(rows, other.rows);
+        swap(type, other.type);
+        swap(source, other.source);
+        swap(base, other.base);
+        swap(output, other.output);
+        swap(source_storage_length, other.source_storage_length);
+        swap(base_storage_length, other.base_storage_length);
+        swap(source_offset_elements, other.source_offset_elements);
+        swap(base_offset_elements, other.base_offset_elements);
+        swap(source_left_pad_elements, other.source_left_pad_elements);
+        swap(output_length, other.output_length);
+        swap(output_offset_elements, other.output_offset_elements);
+    }
+
+    void push_back(const LwtStepRoute& route) {
+        TT_FATAL(rows < capacity, "LWT route table is full at {} routes", capacity);
+        const size_t row = rows++;
+        type[row] = route.type;
+        source[row] = route.source;
+        base[row] = route.base;
+        output[row] = route.output;
+        source_storage_length[row] = route.source_storage_length;
+        base_storage_length[row] = route.base_storage_length;
+        source_offset_elements[row] = route.source_offset_elements;
+        base_offset_elements[row] = route.base_offset_elements;
+        source_left_pad_elements[row] = route.source_left_pad_elements;
+        output_length[row] = route.output_length;
+        output_offset_elements[row] = route.output_offset_elements;
+    }
+
+    // Copy rows of another table column by column, e.g. the chunks a
+    // replanned plan keeps unchanged. Returns where they landed.
+    RouteRange append(const LwtRouteTable& source_table, const RouteRange range) {
+        TT_FATAL(
+            range.begin <= source_table.rows && range.count <= source_table.rows - range.begin,
+            "LWT route range [{}, {}) exceeds {} source rows",
+            range.begin,
+            range.begin + range.count,
+            source_table.rows);
+        TT_FATAL(range.count <= capacity - rows, "LWT route table is full at {} routes", capacity);
+        const auto copy_column = [&](const auto from, const auto to) {
+            std::copy_n(from.begin() + range.begin, range.count, to.begin() + rows);
+        };
+        copy_column(source_table.type, type);
+        copy_column(source_table.source, source);
+        copy_column(source_table.base, base);
+        copy_column(source_table.output, output);
+        copy_column(source_table.source_storage_length, source_storage_length);
+        copy_column(source_table.base_storage_length, base_storage_length);
+        copy_column(source_table.source_offset_elements, source_offset_elements);
+        copy_column(source_table.base_offset_elements, base_offset_elements);
+        copy_column(source_table.source_left_pad_elements, source_left_pad_elements);
+        copy_column(source_table.output_length, output_length);
+        copy_column(source_table.output_offset_elements, output_offset_elements);
+        const size_t begin = rows;
+        rows += range.count;
+        return range_since(begin);
+    }
+
+    // Rows appended since `begin`, i.e. the routes of the chunk just built.
+    [[nodiscard]] RouteRange range_since(const size_t begin) const noexcept {
+        return RouteRange{.begin = begin, .count = rows - begin};
+    }
+
+    [[nodiscard]] LwtStepRoute at(const size_t row) const {
+        TT_FATAL(row < rows, "LWT route row {} is out of range for {} rows", row, rows);
+        return LwtStepRoute{
+            .type = type[row],
+            .source = source[row],
+            .base = base[row],
+            .output = output[row],
+            .source_storage_length = source_storage_length[row],
+            .base_storage_length = base_storage_length[row],
+            .source_offset_elements = source_offset_elements[row],
+            .base_offset_elements = base_offset_elements[row],
+            .source_left_pad_elements = source_left_pad_elements[row],
+            .output_length = output_length[row],
+            .output_offset_elements = output_offset_elements[row],
+        };
+    }
+
+    [[nodiscard]] LwtStepRoute at(const RouteRange range, const size_t index) const {
+        TT_FATAL(index < range.count, "LWT chunk route {} is out of range for {} routes", index, range.count);
+        return at(range.begin + index);
+    }
+
+    // One column of a chunk, for scans that need a single field.
+    template <typename T>
+    [[nodiscard]] std::span<const T> rows_of(const std::span<T> column, const RouteRange range) const {
+        TT_FATAL(
+            range.begin <= rows && range.count <= rows - range.begin,
+            "LWT route range [{}, {}) exceeds {} rows",
+            range.begin,
+            range.begin + range.count,
+            rows);
+        return column.subspan(range.begin, range.count);
+    }
+};
+
+[[nodiscard]] inline LwtRouteTable make_lwt_route_table(const size_t capacity) {
+    LwtRouteTable table;
+    table.capacity = capacity;
+    if (capacity == 0) {
+        return table;
+    }
+    using route_table_detail::allocate_column;
+    table.arena = std::make_unique<std::pmr::monotonic_buffer_resource>(
+        capacity * route_table_detail::kRowBytes + route_table_detail::kColumnCount * alignof(std::max_align_t));
+    std::pmr::memory_resource& arena = *table.arena;
+    table.type = allocate_column<StepType>(arena, capacity);
+    table.source = allocate_column<StreamRef>(arena, capacity);
+    table.base = allocate_column<StreamRef>(arena, capacity);
+    table.output = allocate_column<RouteOutputRef>(arena, capacity);
+    table.source_storage_length = allocate_column<size_t>(arena, capacity);
+    table.base_storage_length = allocate_column<size_t>(arena, capacity);
+    table.source_offset_elements = allocate_column<size_t>(arena, capacity);
+    table.base_offset_elements = allocate_column<size_t>(arena, capacity);
+    table.source_left_pad_elements = allocate_column<uint32_t>(arena, capacity);
+    table.output_length = allocate_column<size_t>(arena, capacity);
+    table.output_offset_elements = allocate_column<size_t>(arena, capacity);
+    return table;
+}
+
+inline LwtRouteTable::LwtRouteTable(const LwtRouteTable& other) : LwtRouteTable(make_lwt_route_table(other.capacity)) {
+    append(other, RouteRange{.begin = 0, .count = other.rows});
+}
+
+}  // namespace ttwv
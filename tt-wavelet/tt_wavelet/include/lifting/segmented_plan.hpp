@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tt_stl/assert.hpp>
+#include <utility>
+#include <vector>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/lifting/execution_plan.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+
+namespace ttwv {
+
+/**
+ * One 32-bit sub-transform of a segmented forward LWT.
+ *
+ * The segment transforms input samples [window_begin, window_begin +
+ * window_length) of the boundary-extended signal and keeps the canonical
+ * outputs [output_begin, output_begin + output_length). window_begin may be
+ * negative, or the window may end past the signal, only for the first and
+ * last segments; those samples come from the signal's own extension.
+ */
+struct LwtSegment {
+    int64_t window_begin{0};
+    size_t window_length{0};
+    uint64_t output_begin{0};
+    size_t output_length{0};
+    uint32_t plan_index{0};
+};
+
+struct SegmentedLwtPlan {
+    uint64_t input_length{0};
+    uint64_t output_length{0};
+    BoundaryMode boundary_mode{BoundaryMode::kSymmetric};
+    size_t left_halo_outputs{0};
+    size_t window_overlap_samples{0};
+    std::vector<LwtExecutionPlan> plans;
+    std::vector<LwtSegment> segments;
+};
+
+namespace segment_detail {
+
+struct PaddedCone {
+    size_t begin{0};
+    size_t end{0};
+};
+
+/**
+ * Padded-input interval read by the canonical outputs `outputs` of `plan`.
+ */
+[[nodiscard]] inline PaddedCone padded_cone(const LiftingForwardPlan& plan, const IndexInterval outputs) {
+    const int64_t canonical_start = static_cast<int64_t>(plan.preprocess_layout.pad_config.left + 1) / 2;
+    const size_t even_origin = static_cast<size_t>(canonical_start - plan.final_even_shift);
+    const size_t odd_origin = static_cast<size_t>(canonical_start - plan.final_odd_shift);
+    const AxisRequiredStreams initial =
+        execution_detail::backpropagate_requirements(
+            plan,
+            IndexInterval{.begin = outputs.begin + even_origin, .end = outputs.end + even_origin},
+            IndexInterval{.begin = outputs.begin + odd_origin, .end = outputs.end + odd_origin})
+            .front();
+    TT_FATAL(!initial.even.empty() || !initial.odd.empty(), "Segment output cone is empty");
+    PaddedCone cone{.begin = std::numeric_limits<size_t>::max(), .end = 0};
+    if (!initial.even.empty()) {
+        cone.begin = std::min(cone.begin, 2 * initial.even.begin);
+        cone.end = std::max(cone.end, 2 * initial.even.end - 1);
+    }
+    if (!initial.odd.empty()) {
+        cone.begin = std::min(cone.begin, 2 * initial.odd.begin + 1);
+        cone.end = std::max(cone.end, 2 * initial.odd.end);
+    }
+    return cone;
+}
+
+[[nodiscard]] constexpr uint64_t forward_output_length(
+    const uint64_t input_length, const uint32_t tap_size, const BoundaryMode boundary_mode) noexcept {
+    if (boundary_mode == BoundaryMode::kPeriodization) {
+        return (input_length + 1) / 2;
+    }
+    return (input_length + tap_size - 1) / 2;
+}
+
+}  // namespace segment_detail
+
+/**
+ * Longest segment window the 1D device ABI accepts for `Scheme`: the padded
+ * window must stay addressable by the reader's signed 32-bit indices.
+ */
+template <typename Scheme>
+[[nodiscard]] constexpr size_t max_lwt_segment_length() noexcept {
+    constexpr size_t padded_limit = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+    return (padded_limit - 2 * static_cast<size_t>(Scheme::tap_size - 1)) & ~size_t{1};
+}
+
+/**
+ * Split a forward LWT of any 64-bit length into 32-bit segments.
+ *
+ * Signals that fit one segment keep the ordinary plan. Longer signals use
+ * one window length for every segment. The halo comes from the exact
+ * dependency cone of the window's plan: each segment keeps only the
+ * canonical outputs whose cone lies inside the window's real samples, so
+ * kept samples never see the window's own extension and are bit-identical
+ * to an unsegmented transform. Kept ranges tile the canonical stream, and
+ * windowed plans compute no output outside them.
+ */
+template <typename Scheme>
+[[nodiscard]] SegmentedLwtPlan make_segmented_lwt_plan(
+    const uint64_t input_length,
+    const uint32_t core_limit,
+    const uint32_t l1_signal_budget_bytes,
+    const BoundaryMode boundary_mode = BoundaryMode::kSymmetric,
+    const size_t max_segment_length = max_lwt_segment_length<Scheme>(),
+    const WorkspaceLayout workspace_layout = WorkspaceLayout::kRowMajor) {
+    TT_FATAL(input_length > 0, "Segmented LWT input must be non-empty");
+    TT_FATAL(
+        !boundary_mode_requires_multiple_samples(boundary_mode) || input_length > 1,
+        "reflect and antireflect boundary modes require an input length greater than one");
+    TT_FATAL(
+        max_segment_length <= max_lwt_segment_length<Scheme>(),
+        "Segment length {} exceeds the 32-bit device limit {}",
+        max_segment_length,
+        max_lwt_segment_length<Scheme>());
+    const uint64_t output_length = segment_detail::forward_output_length(input_length, Scheme::tap_size, boundary_mode);
+
+    if (input_length <= max_segment_length) {
+        std::vector<LwtExecutionPlan> plans;
+        plans.push_back(make_lwt_execution_plan(
+            make_forward_lifting_plan<Scheme>(
+                SignalBuffer{.length = static_cast<size_t>(input_length)}, 0, 0, boundary_mode),
+            core_limit,
+            l1_signal_budget_bytes,
+            workspace_layout));
+        return SegmentedLwtPlan{
+            .input_length = input_length,
+            .output_length = output_length,
+            .boundary_mode = boundary_mode,
+            .plans = std::move(plans),
+            .segments = {LwtSegment{
+                .window_length = static_cast<size_t>(input_length),
+                .output_length = static_cast<size_t>(output_length),
+            }},
+        };
+    }
+
+    // Even windows keep the polyphase phase: local output m is global output
+    // m + window_begin / 2.
+    const size_t window_length = max_segment_length & ~size_t{1};
+    LiftingForwardPlan window_plan =
+        make_forward_lifting_plan<Scheme>(SignalBuffer{.length = window_length}, 0, 0, boundary_mode);
+    const size_t pad = window_plan.preprocess_layout.pad_config.left;
+    const size_t window_outputs = window_plan.output_length;
+
+    // Interior cones are shift-invariant, so one probe output gives both
+    // cone reaches in padded samples relative to 2 * m.
+    const size_t probe = window_outputs / 2;
+    const segment_detail::PaddedCone probe_cone =
+        segment_detail::padded_cone(window_plan, IndexInterval{.begin = probe, .end = probe + 1});
+    const int64_t left_reach = static_cast<int64_t>(probe_cone.begin) - 2 * static_cast<int64_t>(probe);
+    const int64_t right_reach = static_cast<int64_t>(probe_cone.end) - 2 * static_cast<int64_t>(probe);
+    const int64_t first_kept = std::max<int64_t>(0, (static_cast<int64_t>(pad) - left_reach + 1) / 2);
+    const int64_t kept_end = std::min<int64_t>(
+        static_cast<int64_t>(window_outputs), (static_cast<int64_t>(pad + window_length) - right_reach) / 2 + 1);
+    TT_FATAL(
+        kept_end > first_kept,
+        "Segment length {} is shorter than the {}-sample dependency cone",
+        window_length,
+        probe_cone.end - probe_cone.begin);
+    const size_t left_halo_outputs = static_cast<size_t>(first_kept);
+    const size_t kept_per_segment = static_cast<size_t>(kept_end - first_kept);
+
+    const segment_detail::PaddedCone kept_cone = segment_detail::padded_cone(
+        window_plan, IndexInterval{.begin = left_halo_outputs, .end = left_halo_outputs + kept_per_segment});
+    TT_FATAL(
+        kept_cone.begin >= pad && kept_cone.end <= pad + window_length,
+        "Segment cone [{}, {}) leaves the real window samples [{}, {})",
+        kept_cone.begin,
+        kept_cone.end,
+        pad,
+        pad + window_length);
+
+    const uint64_t segment_count = ceil_div(output_length, static_cast<uint64_t>(kept_per_segment));
+    TT_FATAL(
+        segment_count <= std::numeric_limits<uint32_t>::max() &&
+            input_length <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) / 2,
+        "Segmented LWT length {} needs too many segments",
+        input_length);
+    const size_t last_kept = static_cast<size_t>(output_length - (segment_count - 1) * kept_per_segment);
+
+    std::vector<LwtExecutionPlan> plans;
+    const auto window_plan_for = [&](const size_t kept) {
+        return make_lwt_execution_plan(
+            window_plan,
+            IndexInterval{.begin = left_halo_outputs, .end = left_halo_outputs + kept},
+            core_limit,
+            l1_signal_budget_bytes,
+            workspace_layout);
+    };
+    plans.push_back(window_plan_for(kept_per_segment));
+    if (last_kept != kept_per_segment) {
+        plans.push_back(window_plan_for(last_kept));
+    }
+
+    std::vector<LwtSegment> segments;
+    segments.reserve(static_cast<size_t>(segment_count));
+    for (uint64_t segment = 0; segment < segment_count; ++segment) {
+        const uint64_t output_begin = segment * kept_per_segment;
+        const bool last = segment + 1 == segment_count;
+        segments.push_back(LwtSegment{
+            .window_begin = 2 * (static_cast<int64_t>(output_begin) - static_cast<int64_t>(left_halo_outputs)),
+            .window_length = window_length,
+            .output_begin = output_begin,
+            .output_length = last ? last_kept : kept_per_segment,
+            .plan_index = last && last_kept != kept_per_segment ? 1U : 0U,
+        });
+    }
+    return SegmentedLwtPlan{
+        .input_length = input_length,
+        .output_length = output_length,
+        .boundary_mode = boundary_mode,
+        .left_halo_outputs = left_halo_outputs,
+        .window_overlap_samples = window_length - 2 * kept_per_segment,
+        .plans = std::move(plans),
+        .segments = std::move(segments),
+    };
+}
+
+}  // namespace ttwv
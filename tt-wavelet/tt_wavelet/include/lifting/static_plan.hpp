@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tt_stl/assert.hpp>
+#include <vector>
+
+#include "tt_wavelet/include/common/boundary.hpp"
+#include "tt_wavelet/include/common/signal.hpp"
+#include "tt_wavelet/include/lifting/plan.hpp"
+
+namespace ttwv {
+
+/**
+ * Forward lifting plan for a signal length known at compile time.
+ *
+ * Holds the same geometry as LiftingForwardPlan, but the routes live in a
+ * std::array so the whole plan is a constant expression. DRAM addresses are
+ * zero: the plan describes stream geometry only, and to_forward_lifting_plan
+ * attaches real buffers when a runtime plan is needed.
+ */
+template <size_t RouteCount>
+struct StaticLiftingForwardPlan {
+    PadSplit1DLayout preprocess_layout{};
+    std::array<LiftingStepRoute, RouteCount> routes{};
+    size_t final_even_length{0};
+    size_t final_odd_length{0};
+    int final_even_shift{0};
+    int final_odd_shift{0};
+    size_t output_length{0};
+
+    [[nodiscard]] constexpr size_t input_length() const noexcept { return preprocess_layout.input.length; }
+
+    // First final-stream index of canonical output 0, as in plan_lwt_chunks.
+    [[nodiscard]] constexpr size_t final_even_origin() const noexcept {
+        return static_cast<size_t>(static_cast<int>(preprocess_layout.pad_config.left + 1) / 2 - final_even_shift);
+    }
+
+    [[nodiscard]] constexpr size_t final_odd_origin() const noexcept {
+        return static_cast<size_t>(static_cast<int>(preprocess_layout.pad_config.left + 1) / 2 - final_odd_shift);
+    }
+
+    // Largest stream any route reads or writes; sizes each workspace slot.
+    [[nodiscard]] constexpr size_t workspace_elements() const noexcept {
+        size_t elements = std::max(preprocess_layout.output.even.length, preprocess_layout.output.odd.length);
+        for (const LiftingStepRoute& route : routes) {
+            elements = std::max({elements, route.source_length, route.base_length, route.output_length});
+        }
+        return elements;
+    }
+};
+
+/**
+ * Build the forward plan of `Scheme` for a `Length`-sample signal during
+ * constant evaluation.
+ *
+ * Route emission is shared with make_forward_lifting_plan, so the result
+ * matches the runtime plan route for route.
+ */
+template <typename Scheme, size_t Length, BoundaryMode Mode = BoundaryMode::kSymmetric>
+[[nodiscard]] consteval StaticLiftingForwardPlan<Scheme::num_steps> make_static_forward_lifting_plan() {
+    static_assert(Scheme::tap_size > 0, "Static lifting schemes must have a positive tap size");
+    static_assert(Scheme::num_steps > 0, "Static lifting schemes must have at least one step");
+    static_assert(Length > 0, "Static forward plans require a non-empty signal");
+    static_assert(
+        Length <= static_cast<size_t>(std::numeric_limits<uint32_t>::max()),
+        "Static forward plan length exceeds uint32_t runtime limits");
+    static_assert(is_supported_lwt_boundary_mode(Mode), "Unsupported LWT boundary mode");
+    static_assert(
+        !boundary_mode_requires_multiple_samples(Mode) || Length > 1,
+        "Reflect and antireflect boundary modes require at least two samples");
+
+    const SignalBuffer input{.dram_address = 0, .length = Length};
+    StaticLiftingForwardPlan<Scheme::num_steps> plan{
+        .preprocess_layout = make_pad_split_1d_layout(input, 0, 0, forward_lifting_pad_config<Scheme>(Mode)),
+    };
+    const auto [even_state, odd_state] = detail::plan_forward_routes<Scheme>(plan.routes, plan.preprocess_layout);
+    plan.final_even_length = even_state.length;
+    plan.final_odd_length = odd_state.length;
+    plan.final_even_shift = even_state.shift - forward_lifting_output_phase<Scheme>(Mode);
+    plan.final_odd_shift = odd_state.shift - forward_lifting_output_phase<Scheme>(Mode);
+    plan.output_length = forward_lifting_output_length<Scheme>(Length, Mode);
+
+    const int canonical_start = static_cast<int>(plan.preprocess_layout.pad_config.left + 1) / 2;
+    TT_FATAL(
+        canonical_start >= plan.final_even_shift && canonical_start >= plan.final_odd_shift,
+        "LWT canonical output requires a negative origin");
+    TT_FATAL(
+        plan.final_even_origin() + plan.output_length <= plan.final_even_length &&
+            plan.final_odd_origin() + plan.output_length <= plan.final_odd_length,
+        "LWT terminal streams do not cover the canonical output interval");
+    return plan;
+}
+
+template <typename Scheme, size_t Length, BoundaryMode Mode = BoundaryMode::kSymmetric>
+inline constexpr StaticLiftingForwardPlan<Scheme::num_steps> kStaticForwardLiftingPlan =
+    make_static_forward_lifting_plan<Scheme, Length, Mode>();
+
+/**
+ * Attach DRAM buffers to a static plan.
+ *
+ * The chunk planners take a runtime LiftingForwardPlan, so fixed-length
+ * callers can skip route emission and still reuse them unchanged.
+ */
+template <size_t RouteCount>
+[[nodiscard]] LiftingForwardPlan to_forward_lifting_plan(
+    const StaticLiftingForwardPlan<RouteCount>& plan,
+    const SignalBuffer& input,
+    const uint64_t initial_even_addr,
+    const uint64_t initial_odd_addr) {
+    TT_FATAL(
+        input.length == plan.input_length(),
+        "Static forward plan was built for {} samples but the input has {}",
+        plan.input_length(),
+        input.length);
+    TT_FATAL(input.element_size_bytes == sizeof(float), "Forward lifting plan currently supports fp32 only");
+
+    return LiftingForwardPlan{
+        .preprocess_layout = make_pad_split_1d_layout(
+            input, initial_even_addr, initial_odd_addr, plan.preprocess_layout.pad_config),
+        .routes = std::vector<LiftingStepRoute>(plan.routes.begin(), plan.routes.end()),
+        .final_even_length = plan.final_even_length,
+        .final_odd_length = plan.final_odd_length,
+        .final_even_shift = plan.final_even_shift,
+        .final_odd_shift = plan.final_odd_shift,
+        .output_length = plan.output_length,
+    };
+}
+
+}  // namespace ttwv
@@ -17,11 +17,49 @@ struct StaticStep {
     static constexpr std::array<uint32_t, k> coeff_bits = {CoeffBits...};
 };
 
+[[nodiscard]] constexpr bool is_rounded_step(const StepType type) noexcept {
+    return type == StepType::kRoundedPredict || type == StepType::kRoundedUpdate;
+}
+
+/**
+ * Integer-to-integer predict/update step:
+ * out[n] = base[n] + Sign * ((sum_j Taps[j] * src[n - Shift - j] + RoundOffset) >> RoundShift).
+ *
+ * The shift rounds toward minus infinity, so the inverse step repeats the
+ * same taps, shift and offset with the opposite sign and restores the base
+ * exactly. `coeff_bits` carries the taps as raw bits so that geometry and
+ * symmetry helpers treat both step families alike.
+ */
+template <StepType Type, int32_t Shift, int32_t Sign, uint32_t RoundShift, int32_t RoundOffset, int32_t... Taps>
+struct StaticRoundedStep {
+    static_assert(is_rounded_step(Type), "StaticRoundedStep requires a rounded predict/update type");
+    static_assert(Sign == 1 || Sign == -1, "Rounded steps add or subtract their rounded stencil");
+    static_assert(RoundShift < 31, "Rounded step shift must leave an int32 result");
+    static constexpr StepType type = Type;
+    static constexpr int32_t shift = Shift;
+    static constexpr uint32_t k = sizeof...(Taps);
+    static constexpr std::array<uint32_t, k> coeff_bits = {static_cast<uint32_t>(Taps)...};
+    static constexpr std::array<int32_t, k> taps = {Taps...};
+    static constexpr int32_t sign = Sign;
+    static constexpr uint32_t round_shift = RoundShift;
+    static constexpr int32_t round_offset = RoundOffset;
+};
+
 template <typename Scheme, size_t Index>
 using SchemeStep = typename Scheme::template step<Index>::type;
 
+[[nodiscard]] constexpr bool is_predict_step(const StepType type) noexcept {
+    return type == StepType::kPredict || type == StepType::kRoundedPredict;
+}
+
+[[nodiscard]] constexpr bool is_update_step(const StepType type) noexcept {
+    return type == StepType::kUpdate || type == StepType::kRoundedUpdate;
+}
+
+// Rounded steps share the predict/update stream geometry; only their
+// arithmetic differs.
 [[nodiscard]] constexpr bool is_predict_update_step(const StepType type) noexcept {
-    return type == StepType::kPredict || type == StepType::kUpdate;
+    return is_predict_step(type) || is_update_step(type);
 }
 
 [[nodiscard]] constexpr bool is_scale_step(const StepType type) noexcept {
@@ -33,6 +71,44 @@ template <typename Step>
     return is_predict_update_step(Step::type) || is_scale_step(Step::type);
 }
 
+// Predict/update taps that read the same bit for bit in both directions, such
+// as the [a, a] steps of the biorthogonal schemes. Their stencil folds to
+// h[j] * (x[n - j] + x[n - K + 1 + j]), one multiply per tap pair.
+template <typename Step>
+[[nodiscard]] constexpr bool is_palindromic_step() noexcept {
+    if constexpr (!is_predict_update_step(Step::type) || Step::k < 2) {
+        return false;
+    } else {
+        for (size_t j = 0; j < Step::k / 2; ++j) {
+            if (Step::coeff_bits[j] != Step::coeff_bits[Step::k - 1 - j]) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+template <typename Scheme, size_t Index = 0>
+[[nodiscard]] constexpr uint32_t palindromic_step_count() noexcept {
+    if constexpr (Index >= Scheme::num_steps) {
+        return 0;
+    } else {
+        return (is_palindromic_step<SchemeStep<Scheme, Index>>() ? 1U : 0U) +
+               palindromic_step_count<Scheme, Index + 1>();
+    }
+}
+
+// Schemes with rounded steps map int32 samples to int32 coefficients and run
+// on the integer host executor; the FP32 paths reject them.
+template <typename Scheme, size_t Index = 0>
+[[nodiscard]] constexpr uint32_t rounded_step_count() noexcept {
+    if constexpr (Index >= Scheme::num_steps) {
+        return 0;
+    } else {
+        return (is_rounded_step(SchemeStep<Scheme, Index>::type) ? 1U : 0U) + rounded_step_count<Scheme, Index + 1>();
+    }
+}
+
 template <typename Scheme, size_t Index = 0>
 [[nodiscard]] constexpr uint32_t executable_step_count() noexcept {
     if constexpr (Index >= Scheme::num_steps) {
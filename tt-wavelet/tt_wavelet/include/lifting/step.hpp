@@ -10,6 +10,10 @@ enum class StepType : uint8_t {
     kScaleEven = 2,
     kScaleOdd = 3,
     kSwap = 4,
+    // Integer-to-integer predict/update: the stencil sum is rounded by an
+    // arithmetic shift before it is added to the base (StaticRoundedStep).
+    kRoundedPredict = 5,
+    kRoundedUpdate = 6,
 };
 
 }  // namespace ttwv
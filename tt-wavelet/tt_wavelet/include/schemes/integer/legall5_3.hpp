@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../../lifting/static_scheme.hpp"
+
+namespace ttwv::schemes::integer {
+
+struct legall5_3_inverse;
+
+// Reversible LeGall 5/3 (JPEG 2000 lossless) on int32 samples.  It shares the
+// stream geometry of bior2.2 but rounds each predict/update sum, so the
+// inverse scheme restores the input bit for bit.  Coefficients are within
+// rounding of bior2.2's, with the sqrt(2) normalisation left out: the
+// approximation is bior2.2's divided by sqrt(2), the detail multiplied by it.
+// Integer schemes run on the host executor only and carry no compute header.
+struct legall5_3 {
+    static constexpr const char* name = "legall5.3";
+    static constexpr uint32_t tap_size = 6U;
+    static constexpr int32_t delay_even = 1;
+    static constexpr int32_t delay_odd = 2;
+    static constexpr uint32_t num_steps = 5U;
+    using inverse = legall5_3_inverse;
+
+    template <std::size_t I>
+    struct step;
+};
+
+// d[n] = x[2n + 1] - floor((x[2n] + x[2n + 2]) / 2)
+template <>
+struct legall5_3::step<0> {
+    using type = StaticRoundedStep<StepType::kRoundedUpdate, -1, -1, 1U, 0, 1, 1>;
+    static_assert(type::k == 2U);
+};
+
+// s[n] = x[2n] + floor((d[n - 1] + d[n] + 2) / 4)
+template <>
+struct legall5_3::step<1> {
+    using type = StaticRoundedStep<StepType::kRoundedPredict, 0, 1, 2U, 2, 1, 1>;
+    static_assert(type::k == 2U);
+};
+
+template <>
+struct legall5_3::step<2> {
+    using type = StaticStep<StepType::kSwap, 0>;
+    static_assert(type::k == 0U);
+};
+
+template <>
+struct legall5_3::step<3> {
+    using type = StaticStep<StepType::kScaleEven, 0, 0x3f800000U>;
+    static_assert(type::k == 1U);
+};
+
+template <>
+struct legall5_3::step<4> {
+    using type = StaticStep<StepType::kScaleOdd, 0, 0xbf800000U>;
+    static_assert(type::k == 1U);
+};
+
+struct legall5_3_inverse {
+    static constexpr const char* name = "legall5.3-inverse";
+    static constexpr uint32_t tap_size = 6U;
+    static constexpr uint32_t num_steps = 5U;
+
+    template <std::size_t I>
+    struct step;
+};
+
+template <>
+struct legall5_3_inverse::step<0> {
+    using type = StaticStep<StepType::kScaleOdd, 0, 0xbf800000U>;
+    static_assert(type::k == 1U);
+};
+
+template <>
+struct legall5_3_inverse::step<1> {
+    using type = StaticStep<StepType::kScaleEven, 0, 0x3f800000U>;
+    static_assert(type::k == 1U);
+};
+
+template <>
+struct legall5_3_inverse::step<2> {
+    using type = StaticStep<StepType::kSwap, 0>;
+    static_assert(type::k == 0U);
+};
+
+template <>
+struct legall5_3_inverse::step<3> {
+    using type = StaticRoundedStep<StepType::kRoundedPredict, 0, -1, 2U, 2, 1, 1>;
+    static_assert(type::k == 2U);
+};
+
+template <>
+struct legall5_3_inverse::step<4> {
+    using type = StaticRoundedStep<StepType::kRoundedUpdate, -1, 1, 1U, 0, 1, 1>;
+    static_assert(type::k == 2U);
+};
+
+}  // namespace ttwv::schemes::integer
@@ -10,6 +10,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <tt_stl/assert.hpp>
 #include <utility>
 #include <vector>
@@ -23,6 +24,10 @@
 #include "tt-metalium/tensor_accessor_args.hpp"
 #include "tt-metalium/tile.hpp"
 #include "tt_wavelet/include/device_protocol/lwt_config.hpp"
+#include "tt_wavelet/include/lifting/chunk_placement.hpp"
+#include "tt_wavelet/include/lifting/config_words.hpp"
+#include "tt_wavelet/include/lifting/core_selection.hpp"
+#include "tt_wavelet/include/lifting/device_planning.hpp"
 #include "tt_wavelet/include/lifting/l1_accounting.hpp"
 #include "tt_wavelet/include/lifting/policy.hpp"
 
@@ -45,19 +50,11 @@ constexpr uint32_t kInterleaveCb = tt::CBIndex::c_4;
 constexpr uint32_t kSyncCb = tt::CBIndex::c_5;
 constexpr uint32_t kReaderConfigCb = tt::CBIndex::c_6;
 constexpr uint32_t kWriterConfigCb = tt::CBIndex::c_7;
+constexpr uint32_t kExtensionTableCb = tt::CBIndex::c_8;
 constexpr uint32_t kTileGroupBuffering = 2;
-constexpr uint32_t kIlwtInterleaveBatchSticks = 96;
-constexpr uint32_t kAlignedNocMaxRouteCount = 5;
-constexpr uint32_t kAlignedNocMinGroupsPerChunk = 2;
-constexpr uint32_t kWormholeSingleGroupLwtTileMinRouteCount = 4;
-constexpr uint32_t kWormholeSingleGroupIlwtTileMinRouteCount = 7;
-constexpr uint32_t kDefaultL1SignalBudgetBytes = 768 * 1024;
 constexpr const char* kL1SignalBudgetEnv = "TT_WAVELET_L1_SIGNAL_BUDGET_BYTES";
 constexpr const char* kWorkspaceLayoutEnv = "TT_WAVELET_LWT_WORKSPACE_LAYOUT";
-
-static_assert(
-    kIlwtInterleaveBatchSticks <= device_protocol::kIlwtGroupOutputElements / kStickWidth,
-    "ILWT interleave batch must fit in one output group");
+constexpr const char* kChunkPlacementEnv = "TT_WAVELET_CHUNK_PLACEMENT";
 
 struct LwtProgram {
     tt::tt_metal::Program program;
@@ -109,54 +106,6 @@ struct CoreChunkWork {
     return parse_positive_env(kL1SignalBudgetEnv, kDefaultL1SignalBudgetBytes);
 }
 
-[[nodiscard]] uint32_t ilwt_interleave_batch_sticks(const tt::ARCH architecture) {
-    // B96 was measured on Wormhole. Keep Blackhole on its existing one-stick
-    // path until the architecture has independent correctness and timing data.
-    return architecture == tt::ARCH::WORMHOLE_B0 ? kIlwtInterleaveBatchSticks : 1U;
-}
-
-[[nodiscard]] bool supports_hybrid_tile_mirror(const tt::ARCH architecture, const WorkspaceLayout layout) {
-    // The tile-shadow path is a Wormhole KEEP result. Blackhole keeps its
-    // tile-native policy until the row-major mirror has been measured there.
-    return architecture == tt::ARCH::WORMHOLE_B0 && layout == WorkspaceLayout::kRowMajor;
-}
-
-[[nodiscard]] uint32_t tile_mirror_elements(const uint32_t workspace_elements, const bool hybrid_tile_mirror) {
-    return hybrid_tile_mirror
-               ? checked_u32(
-                     ceil_div(workspace_elements, static_cast<uint32_t>(device_protocol::kLwtGroupOutputElements)) *
-                         device_protocol::kLwtGroupOutputElements,
-                     "hybrid tile mirror elements")
-               : 0U;
-}
-
-[[nodiscard]] uint32_t planner_signal_budget_bytes(
-    tt::tt_metal::distributed::MeshDevice& mesh_device,
-    const ArchitecturePolicy& policy,
-    const bool hybrid_tile_mirror,
-    const uint32_t interleave_batch_sticks) {
-    const uint32_t configured_budget = l1_signal_budget_bytes();
-    if (!hybrid_tile_mirror) {
-        return configured_budget;
-    }
-
-    const uint32_t capacity_bytes = mesh_device.l1_size_per_core();
-    const L1Accounting fixed =
-        make_l1_accounting(0, 0, 0, interleave_batch_sticks, policy.l1_scratch_bytes, capacity_bytes);
-    constexpr uint64_t mirror_rounding_reserve =
-        uint64_t{3} * (device_protocol::kLwtGroupOutputElements - 1U) * sizeof(float);
-    TT_FATAL(
-        fixed.total_bytes + mirror_rounding_reserve < capacity_bytes,
-        "LWT fixed resources leave no room for a hybrid workspace");
-
-    // The planner accounts for the logical three-slot workspace. A hybrid
-    // slot additionally owns a tile-native mirror of approximately the same
-    // size. Reserve the worst-case group-rounding overhead and halve the
-    // remaining physical workspace capacity.
-    const uint64_t capacity_limited_budget = (capacity_bytes - fixed.total_bytes - mirror_rounding_reserve) / 2U;
-    return std::min(configured_budget, checked_u32(capacity_limited_budget, "hybrid L1 signal budget"));
-}
-
 [[nodiscard]] std::optional<WorkspaceLayout> workspace_layout_override() {
     const char* raw = std::getenv(kWorkspaceLayoutEnv);
     if (raw == nullptr || raw[0] == '\0' || std::strcmp(raw, "auto") == 0) {
@@ -173,82 +122,6 @@ struct CoreChunkWork {
     return WorkspaceLayout::kTileNative;
 }
 
-[[nodiscard]] bool prefer_tile_native_workspace(const LwtExecutionPlan& plan, const tt::ARCH architecture) {
-    TT_FATAL(!plan.chunks.empty(), "LWT workspace selection requires at least one chunk");
-
-    // Interleaved repeated measurements on Blackhole P150 show tile-native
-    // wins across the complete 106-scheme sweep at 100K, 300K, 500K, and 1M.
-    // Keep this architecture-local; Wormhole retains its calibrated hybrid
-    // row-major policy below.
-    if (architecture == tt::ARCH::BLACKHOLE) {
-        return true;
-    }
-
-    // All-scheme Wormhole measurements show that one-group chunks do not
-    // amortize the row-major tile-shadow traffic once the lifting schedule has
-    // at least four executable routes.  Require multiple chunks so tiny and
-    // external-coefficient edge cases retain their proven layout. Multi-group
-    // chunks retain the hybrid row-major steady-state path. Keep this
-    // crossover architecture-local; Blackhole has an independently selected
-    // tile-native default.
-    if (architecture == tt::ARCH::WORMHOLE_B0 && plan.chunks.size() > 1 && plan.groups_per_chunk == 1 &&
-        plan.chunks.front().routes.size() >= kWormholeSingleGroupLwtTileMinRouteCount) {
-        return true;
-    }
-
-    // Tile-native persistence makes an aligned base a three-page transfer and
-    // makes every output write three pages instead of 96 half-sticks.  A
-    // shifted base still needs a tile/row remap, so keep row-major storage for
-    // schemes where fewer than half of predict/update routes can use the page
-    // path.  The override above keeps this policy directly benchmarkable.
-    uint32_t predict_update_count = 0;
-    uint32_t aligned_base_count = 0;
-    for (const auto& route : plan.chunks.front().routes) {
-        if (!is_predict_update_step(route.type)) {
-            continue;
-        }
-        ++predict_update_count;
-        aligned_base_count += route.base_offset_elements == 0 ? 1U : 0U;
-    }
-    return predict_update_count > 0 && 2U * aligned_base_count >= predict_update_count;
-}
-
-[[nodiscard]] bool prefer_tile_native_inverse_workspace(const IlwtExecutionPlan& plan, const tt::ARCH architecture) {
-    TT_FATAL(!plan.chunks.empty(), "ILWT workspace selection requires at least one chunk");
-
-    if (architecture == tt::ARCH::BLACKHOLE) {
-        const uint32_t route_count = checked_u32(plan.chunks.front().routes.size(), "ILWT route count");
-        // Blackhole tile-native is the general inverse winner. Row-major only
-        // crosses over once a core owns enough groups to amortize its setup,
-        // and only for very short schedules. This metadata rule explains the
-        // stable crossover cases without scheme-name checks.
-        const bool row_major_crossover = (plan.output_groups_per_chunk >= 2 && route_count <= 2) ||
-                                         (plan.output_groups_per_chunk >= 3 && route_count <= 3);
-        return !row_major_crossover;
-    }
-
-    // The inverse B96 row-major path remains faster for short lifting
-    // schedules.  On Wormhole, tile-native becomes the consistent winner for
-    // a one-group chunk at seven or more executable routes. Require multiple
-    // chunks so tiny/external ILWT inputs stay on the proven row-major path.
-    // Once a chunk owns multiple groups, the hybrid row-major mirror amortizes
-    // its setup cost.
-    return architecture == tt::ARCH::WORMHOLE_B0 && plan.chunks.size() > 1 && plan.output_groups_per_chunk == 1 &&
-           plan.chunks.front().routes.size() >= kWormholeSingleGroupIlwtTileMinRouteCount;
-}
-
-template <typename Plan>
-[[nodiscard]] bool prefer_aligned_row_major_noc_staging(
-    const Plan& plan, const uint32_t groups_per_chunk, const bool hybrid_tile_mirror) {
-    TT_FATAL(!plan.chunks.empty(), "LWT NoC staging selection requires at least one chunk");
-    // Matched standalone measurements show a clear win for short route
-    // schedules (notably bior3.9) once a core owns multiple groups. Longer
-    // schedules such as db10 and dmey lose to packet setup overhead, so they
-    // retain the scalar row-major gather while still using the tile mirror.
-    return hybrid_tile_mirror && groups_per_chunk >= kAlignedNocMinGroupsPerChunk &&
-           plan.chunks.front().routes.size() <= kAlignedNocMaxRouteCount;
-}
-
 [[nodiscard]] uint32_t core_limit(tt::tt_metal::distributed::MeshDevice& mesh_device) {
     const auto grid = mesh_device.compute_with_storage_grid_size();
     const uint32_t hardware_cores = static_cast<uint32_t>(grid.x * grid.y);
@@ -256,11 +129,50 @@ template <typename Plan>
     return std::min(hardware_cores, parse_positive_env("TT_WAVELET_LWT_MAX_CORES", hardware_cores));
 }
 
-[[nodiscard]] std::vector<tt::tt_metal::CoreCoord> select_cores(
-    tt::tt_metal::distributed::MeshDevice& mesh_device, const uint32_t active_core_count) {
+[[nodiscard]] WorkerGridTopology worker_grid_topology(tt::tt_metal::distributed::MeshDevice& mesh_device) {
+    // Harvested rows and columns never appear in the logical grid, so walking
+    // the logical-to-NoC mapping yields exactly the workers this device has.
     const auto grid = mesh_device.compute_with_storage_grid_size();
-    return tt::tt_metal::grid_to_cores(
-        active_core_count, static_cast<uint32_t>(grid.x), static_cast<uint32_t>(grid.y), true);
+    std::vector<uint32_t> columns;
+    columns.reserve(grid.x);
+    for (size_t x = 0; x < grid.x; ++x) {
+        columns.push_back(static_cast<uint32_t>(mesh_device.worker_core_from_logical_core({x, 0}).x));
+    }
+    std::vector<uint32_t> rows;
+    rows.reserve(grid.y);
+    for (size_t y = 0; y < grid.y; ++y) {
+        rows.push_back(static_cast<uint32_t>(mesh_device.worker_core_from_logical_core({0, y}).y));
+    }
+
+    const auto& allocator = mesh_device.allocator();
+    const uint32_t bank_count = allocator->get_num_banks(tt::tt_metal::BufferType::DRAM);
+    std::vector<NocCoordinate> dram_bank_endpoints;
+    dram_bank_endpoints.reserve(bank_count);
+    for (uint32_t bank = 0; bank < bank_count; ++bank) {
+        const tt::tt_metal::CoreCoord endpoint = mesh_device.virtual_core_from_logical_core(
+            mesh_device.logical_core_from_dram_channel(allocator->get_dram_channel_from_bank_id(bank)),
+            tt::CoreType::DRAM);
+        dram_bank_endpoints.push_back(
+            NocCoordinate{.x = static_cast<uint32_t>(endpoint.x), .y = static_cast<uint32_t>(endpoint.y)});
+    }
+
+    const auto noc = mesh_device.grid_size();
+    return make_worker_grid_topology(
+        mesh_device.arch() == tt::ARCH::BLACKHOLE ? "blackhole" : "wormhole_b0",
+        static_cast<uint32_t>(noc.x),
+        static_cast<uint32_t>(noc.y),
+        std::move(columns),
+        std::move(rows),
+        std::move(dram_bank_endpoints));
+}
+
+[[nodiscard]] std::vector<tt::tt_metal::CoreCoord> select_cores(const CoreSelection& selection) {
+    std::vector<tt::tt_metal::CoreCoord> cores;
+    cores.reserve(selection.cores.size());
+    for (const NocCoordinate core : selection.cores) {
+        cores.emplace_back(core.x, core.y);
+    }
+    return cores;
 }
 
 [[nodiscard]] tt::tt_metal::CoreRangeSet core_range_set(const std::vector<tt::tt_metal::CoreCoord>& cores) {
@@ -397,14 +309,8 @@ void add_l1_telemetry(
     const ArchitecturePolicy& policy,
     const bool hybrid_tile_mirror,
     const uint32_t interleave_batch_sticks) {
-    const uint32_t mirror_elements = tile_mirror_elements(plan.workspace_elements, hybrid_tile_mirror);
-    const L1Accounting accounting = make_l1_accounting(
-        plan.workspace_elements,
-        plan.max_workspace_elements,
-        mirror_elements,
-        interleave_batch_sticks,
-        policy.l1_scratch_bytes,
-        mesh_device.l1_size_per_core());
+    const L1Accounting accounting = make_device_l1_accounting(
+        plan, policy, hybrid_tile_mirror, interleave_batch_sticks, mesh_device.l1_size_per_core());
     telemetry.architecture = policy.architecture;
     telemetry.workspace_layout = plan.workspace_layout;
     telemetry.max_workspace_elements = plan.max_workspace_elements;
@@ -423,89 +329,21 @@ void add_l1_telemetry(
     telemetry.l1_headroom_bytes = accounting.headroom_bytes;
 }
 
-[[nodiscard]] uint32_t resolve_output_address(const LwtWorkingBuffers& buffers, const RouteOutputRef output) {
-    switch (output.storage) {
-        case RouteOutputStorage::kWorkspaceSlot:
-            return static_cast<uint32_t>(buffers.at(output.slot)->get_backing_buffer()->address());
-        case RouteOutputStorage::kFinalEvenDram:
-            return static_cast<uint32_t>(buffers.final_even->get_backing_buffer()->address());
-        case RouteOutputStorage::kFinalOddDram:
-            return static_cast<uint32_t>(buffers.final_odd->get_backing_buffer()->address());
-    }
-    TT_THROW("Unsupported LWT output storage");
-}
-
-[[nodiscard]] uint32_t resolve_workspace_address(const LwtWorkingBuffers& buffers, const StreamRef stream) {
-    return static_cast<uint32_t>(buffers.at(stream.slot)->get_backing_buffer()->address());
+[[nodiscard]] uint32_t buffer_address(const std::shared_ptr<tt::tt_metal::distributed::MeshBuffer>& buffer) {
+    return static_cast<uint32_t>(buffer->get_backing_buffer()->address());
 }
 
-[[nodiscard]] std::vector<uint32_t> build_chunk_config_words(const LwtExecutionPlan& plan) {
-    std::vector<uint32_t> words(std::max(plan.chunks.size(), size_t{1}) * device_protocol::kLwtChunkConfigWordCount, 0);
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const auto& chunk = plan.chunks[chunk_index];
-        const size_t offset = chunk_index * device_protocol::kLwtChunkConfigWordCount;
-        words[offset + device_protocol::kLwtInitialEvenBegin] =
-            checked_u32(chunk.initial_even.begin, "initial even begin");
-        words[offset + device_protocol::kLwtInitialEvenLength] =
-            checked_u32(chunk.initial_even.length(), "initial even length");
-        words[offset + device_protocol::kLwtInitialOddBegin] =
-            checked_u32(chunk.initial_odd.begin, "initial odd begin");
-        words[offset + device_protocol::kLwtInitialOddLength] =
-            checked_u32(chunk.initial_odd.length(), "initial odd length");
-    }
-    return words;
+[[nodiscard]] LwtConfigAddresses config_addresses(const LwtWorkingBuffers& buffers) {
+    return LwtConfigAddresses{
+        .slots = {buffer_address(buffers.slots[0]), buffer_address(buffers.slots[1]), buffer_address(buffers.slots[2])},
+        .final_even = buffer_address(buffers.final_even),
+        .final_odd = buffer_address(buffers.final_odd),
+    };
 }
 
-[[nodiscard]] std::vector<uint32_t> build_route_config_words(
-    const LwtExecutionPlan& plan, const LwtWorkingBuffers& buffers) {
-    TT_FATAL(!plan.chunks.empty(), "LWT plan has no chunks");
-    const size_t route_count = plan.chunks.front().routes.size();
-    std::vector<uint32_t> words(
-        std::max(plan.chunks.size() * route_count, size_t{1}) * device_protocol::kRouteConfigWordCount, 0);
-
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const auto& chunk = plan.chunks[chunk_index];
-        std::array<bool, 3> tile_mirror_valid{};
-        TT_FATAL(chunk.routes.size() == route_count, "LWT chunks have inconsistent route counts");
-        for (size_t route_index = 0; route_index < route_count; ++route_index) {
-            const auto& route = chunk.routes[route_index];
-            const uint32_t output_offset = checked_u32(route.output_offset_elements, "LWT output offset");
-            const size_t word_offset =
-                (chunk_index * route_count + route_index) * device_protocol::kRouteConfigWordCount;
-            words[word_offset + device_protocol::kRouteType] = static_cast<uint32_t>(route.type);
-            words[word_offset + device_protocol::kRouteSourceAddr] = resolve_workspace_address(buffers, route.source);
-            words[word_offset + device_protocol::kRouteSourceLength] =
-                checked_u32(route.source_storage_length, "LWT source storage end");
-            words[word_offset + device_protocol::kRouteBaseAddr] = resolve_workspace_address(buffers, route.base);
-            words[word_offset + device_protocol::kRouteBaseLength] =
-                checked_u32(route.base_storage_length, "LWT base storage end");
-            words[word_offset + device_protocol::kRouteOutputAddr] = resolve_output_address(buffers, route.output);
-            words[word_offset + device_protocol::kRouteOutputLength] =
-                checked_u32(route.output_length, "LWT output length");
-            words[word_offset + device_protocol::kRouteSourceOffset] =
-                checked_u32(route.source_offset_elements, "LWT source offset");
-            words[word_offset + device_protocol::kRouteBaseOffset] =
-                checked_u32(route.base_offset_elements, "LWT base offset");
-            words[word_offset + device_protocol::kRouteSourceLeftPad] = route.source_left_pad_elements;
-            words[word_offset + device_protocol::kRouteOutputOffset] = output_offset;
-            words[word_offset + device_protocol::kRouteGroupCount] = output_group_count(route.output_length);
-            uint32_t route_flags =
-                route.output.storage == RouteOutputStorage::kWorkspaceSlot ? 0U : device_protocol::kRouteFlagFinalDram;
-            route_flags |= tile_mirror_valid[static_cast<size_t>(route.source.slot)]
-                               ? device_protocol::kRouteFlagSourceTileMirror
-                               : 0U;
-            route_flags |= tile_mirror_valid[static_cast<size_t>(route.base.slot)]
-                               ? device_protocol::kRouteFlagBaseTileMirror
-                               : 0U;
-            if (route.output.storage == RouteOutputStorage::kWorkspaceSlot) {
-                const bool produces_tile_mirror = output_offset % device_protocol::kLwtGroupOutputElements == 0;
-                route_flags |= produces_tile_mirror ? device_protocol::kRouteFlagOutputTileMirror : 0U;
-                tile_mirror_valid[static_cast<size_t>(route.output.slot)] = produces_tile_mirror;
-            }
-            words[word_offset + device_protocol::kRouteFlags] = route_flags;
-        }
-    }
-    return words;
+[[nodiscard]] uint32_t extension_page_count(const LwtExecutionPlan& plan) {
+    const ExtensionTableKey key = lwt_extension_table_key(plan);
+    return device_protocol::extension_config_page_count(key.left + key.right);
 }
 
 [[nodiscard]] std::vector<uint32_t> reader_runtime_args(
@@ -529,6 +367,8 @@ void add_l1_telemetry(
         checked_u32(plan.workspace_elements * sizeof(float), "LWT tile mirror offset"),
         chunks_per_sample,
         input_pages_per_sample,
+        static_cast<uint32_t>(buffers.extension_config->get_backing_buffer()->address()),
+        extension_page_count(plan),
     };
 }
 
@@ -549,15 +389,17 @@ void add_l1_telemetry(
     };
 }
 
-[[nodiscard]] std::vector<uint32_t> compute_runtime_args(const LwtExecutionPlan& plan, const CoreChunkWork& work) {
+[[nodiscard]] std::vector<uint32_t> compute_runtime_args(
+    const LwtExecutionPlan& plan, const std::span<const uint32_t> chunk_order, const CoreChunkWork& work) {
     const size_t route_count = plan.chunks.front().routes.size();
     std::vector<uint32_t> args;
     args.reserve(1 + static_cast<size_t>(work.chunk_count) * route_count);
     args.push_back(work.chunk_count);
     for (uint32_t local_chunk = 0; local_chunk < work.chunk_count; ++local_chunk) {
-        const auto& chunk = plan.chunks[(work.chunk_begin + local_chunk) % plan.chunks.size()];
-        for (const auto& route : chunk.routes) {
-            args.push_back(output_group_count(route.output_length));
+        const auto& chunk =
+            plan.chunks[chunk_at_page(chunk_order, (work.chunk_begin + local_chunk) % plan.chunks.size())];
+        for (const size_t output_length : plan.route_table.rows_of(plan.route_table.output_length, chunk.routes)) {
+            args.push_back(output_group_count(output_length));
         }
     }
     return args;
@@ -571,7 +413,7 @@ void add_l1_telemetry(
     const WorkspaceLayout workspace_layout,
     const bool hybrid_tile_mirror,
     const bool row_major_noc_staging,
-    const BoundaryMode boundary_mode,
+    const uint32_t extension_pages,
     const char* compute_scheme_header,
     const char* compute_scheme_type) {
     tt::tt_metal::Program program = tt::tt_metal::CreateProgram();
@@ -586,8 +428,11 @@ void add_l1_telemetry(
     create_circular_buffer(program, cores, kSyncCb, 1, kNocAlignmentBytes);
     create_circular_buffer(program, cores, kReaderConfigCb, 1, device_protocol::kRouteConfigPageBytes);
     create_circular_buffer(program, cores, kWriterConfigCb, 1, device_protocol::kRouteConfigPageBytes);
+    create_circular_buffer(
+        program, cores, kExtensionTableCb, extension_pages, device_protocol::kExtensionConfigPageBytes);
 
     const auto& config_buffer = *buffers.route_config->get_backing_buffer();
+    const auto& extension_buffer = *buffers.extension_config->get_backing_buffer();
     const auto& final_buffer = *buffers.final_even->get_backing_buffer();
 
     std::vector<uint32_t> reader_compile_args = {
@@ -599,7 +444,7 @@ void add_l1_telemetry(
         kSyncCb,
         static_cast<uint32_t>(workspace_layout == WorkspaceLayout::kTileNative),
         0U,
-        static_cast<uint32_t>(boundary_mode),
+        kExtensionTableCb,
         checked_u32(input_buffer.page_size(), "LWT input page size"),
         static_cast<uint32_t>(row_major_noc_staging),
         static_cast<uint32_t>(hybrid_tile_mirror),
@@ -607,6 +452,7 @@ void add_l1_telemetry(
     tt::tt_metal::TensorAccessorArgs(config_buffer).append_to(reader_compile_args);
     tt::tt_metal::TensorAccessorArgs(input_buffer).append_to(reader_compile_args);
     tt::tt_metal::TensorAccessorArgs(input_buffer).append_to(reader_compile_args);
+    tt::tt_metal::TensorAccessorArgs(extension_buffer).append_to(reader_compile_args);
 
     std::vector<uint32_t> writer_compile_args = {
         kWriterConfigCb,
@@ -679,7 +525,10 @@ void set_runtime_args(
             core_work.core,
             reader_runtime_args(plan, buffers, input_buffer, core_work, chunks_per_sample, input_pages_per_sample));
         tt::tt_metal::SetRuntimeArgs(
-            program.program, program.compute, core_work.core, compute_runtime_args(plan, core_work));
+            program.program,
+            program.compute,
+            core_work.core,
+            compute_runtime_args(plan, buffers.chunk_order, core_work));
         tt::tt_metal::SetRuntimeArgs(
             program.program,
             program.writer,
@@ -688,95 +537,10 @@ void set_runtime_args(
     }
 }
 
-[[nodiscard]] uint32_t resolve_workspace_address(const IlwtWorkingBuffers& buffers, const StreamRef stream) {
-    return static_cast<uint32_t>(buffers.at(stream.slot)->get_backing_buffer()->address());
-}
-
-[[nodiscard]] std::vector<uint32_t> build_inverse_chunk_config_words(
-    const IlwtExecutionPlan& plan, const IlwtWorkingBuffers& buffers) {
-    std::vector<uint32_t> words(std::max(plan.chunks.size(), size_t{1}) * device_protocol::kLwtChunkConfigWordCount, 0);
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const auto& chunk = plan.chunks[chunk_index];
-        const size_t offset = chunk_index * device_protocol::kLwtChunkConfigWordCount;
-        words[offset + device_protocol::kIlwtApproximationBegin] =
-            checked_u32(chunk.canonical_approximation.begin, "ILWT approximation begin");
-        words[offset + device_protocol::kIlwtApproximationLength] =
-            checked_u32(chunk.canonical_approximation.length(), "ILWT approximation length");
-        words[offset + device_protocol::kIlwtDetailBegin] =
-            checked_u32(chunk.canonical_detail.begin, "ILWT detail begin");
-        words[offset + device_protocol::kIlwtDetailLength] =
-            checked_u32(chunk.canonical_detail.length(), "ILWT detail length");
-        words[offset + device_protocol::kIlwtFinalEvenAddr] = resolve_workspace_address(buffers, chunk.final_even);
-        words[offset + device_protocol::kIlwtFinalEvenStorageLength] =
-            checked_u32(chunk.final_even_storage_length, "ILWT final even storage length");
-        words[offset + device_protocol::kIlwtFinalEvenOffset] =
-            checked_u32(chunk.final_even_offset_elements, "ILWT final even offset");
-        words[offset + device_protocol::kIlwtFinalEvenBegin] =
-            checked_u32(chunk.reconstructed_even.begin, "ILWT final even begin");
-        words[offset + device_protocol::kIlwtFinalOddAddr] = resolve_workspace_address(buffers, chunk.final_odd);
-        words[offset + device_protocol::kIlwtFinalOddStorageLength] =
-            checked_u32(chunk.final_odd_storage_length, "ILWT final odd storage length");
-        words[offset + device_protocol::kIlwtFinalOddOffset] =
-            checked_u32(chunk.final_odd_offset_elements, "ILWT final odd offset");
-        words[offset + device_protocol::kIlwtFinalOddBegin] =
-            checked_u32(chunk.reconstructed_odd.begin, "ILWT final odd begin");
-        words[offset + device_protocol::kIlwtOutputBegin] = checked_u32(chunk.output_signal.begin, "ILWT output begin");
-        words[offset + device_protocol::kIlwtOutputLength] =
-            checked_u32(chunk.output_signal.length(), "ILWT output length");
-    }
-    return words;
-}
-
-[[nodiscard]] std::vector<uint32_t> build_inverse_route_config_words(
-    const IlwtExecutionPlan& plan, const IlwtWorkingBuffers& buffers) {
-    TT_FATAL(!plan.chunks.empty(), "ILWT plan has no chunks");
-    const size_t route_count = plan.chunks.front().routes.size();
-    std::vector<uint32_t> words(
-        std::max(plan.chunks.size() * route_count, size_t{1}) * device_protocol::kRouteConfigWordCount, 0);
-    for (size_t chunk_index = 0; chunk_index < plan.chunks.size(); ++chunk_index) {
-        const auto& chunk = plan.chunks[chunk_index];
-        std::array<bool, 3> tile_mirror_valid{};
-        TT_FATAL(chunk.routes.size() == route_count, "ILWT chunks have inconsistent route counts");
-        for (size_t route_index = 0; route_index < route_count; ++route_index) {
-            const auto& route = chunk.routes[route_index];
-            TT_FATAL(
-                route.output.storage == RouteOutputStorage::kWorkspaceSlot,
-                "ILWT intermediate route must target a local workspace slot");
-            const size_t word_offset =
-                (chunk_index * route_count + route_index) * device_protocol::kRouteConfigWordCount;
-            words[word_offset + device_protocol::kRouteType] = static_cast<uint32_t>(route.type);
-            words[word_offset + device_protocol::kRouteSourceAddr] = resolve_workspace_address(buffers, route.source);
-            words[word_offset + device_protocol::kRouteSourceLength] =
-                checked_u32(route.source_storage_length, "ILWT source storage length");
-            words[word_offset + device_protocol::kRouteBaseAddr] = resolve_workspace_address(buffers, route.base);
-            words[word_offset + device_protocol::kRouteBaseLength] =
-                checked_u32(route.base_storage_length, "ILWT base storage length");
-            words[word_offset + device_protocol::kRouteOutputAddr] =
-                resolve_workspace_address(buffers, StreamRef{.slot = route.output.slot});
-            words[word_offset + device_protocol::kRouteOutputLength] =
-                checked_u32(route.output_length, "ILWT output length");
-            words[word_offset + device_protocol::kRouteSourceOffset] =
-                checked_u32(route.source_offset_elements, "ILWT source offset");
-            words[word_offset + device_protocol::kRouteBaseOffset] =
-                checked_u32(route.base_offset_elements, "ILWT base offset");
-            words[word_offset + device_protocol::kRouteSourceLeftPad] = route.source_left_pad_elements;
-            words[word_offset + device_protocol::kRouteOutputOffset] = 0;
-            words[word_offset + device_protocol::kRouteGroupCount] = output_group_count(route.output_length);
-            uint32_t route_flags = plan.final_interleave_direct && route_index + 1 == route_count
-                                       ? device_protocol::kRouteFlagIlwtFinalInterleave
-                                       : 0U;
-            route_flags |= tile_mirror_valid[static_cast<size_t>(route.source.slot)]
-                               ? device_protocol::kRouteFlagSourceTileMirror
-                               : 0U;
-            route_flags |= tile_mirror_valid[static_cast<size_t>(route.base.slot)]
-                               ? device_protocol::kRouteFlagBaseTileMirror
-                               : 0U;
-            route_flags |= device_protocol::kRouteFlagOutputTileMirror;
-            tile_mirror_valid[static_cast<size_t>(route.output.slot)] = true;
-            words[word_offset + device_protocol::kRouteFlags] = route_flags;
-        }
-    }
-    return words;
+[[nodiscard]] IlwtConfigAddresses config_addresses(const IlwtWorkingBuffers& buffers) {
+    return IlwtConfigAddresses{
+        .slots = {buffer_address(buffers.slots[0]), buffer_address(buffers.slots[1]), buffer_address(buffers.slots[2])},
+    };
 }
 
 [[nodiscard]] std::vector<uint32_t> inverse_reader_runtime_args(
@@ -790,7 +554,7 @@ void set_runtime_args(
     return {
         static_cast<uint32_t>(approximation_buffer.address()),
         static_cast<uint32_t>(detail_buffer.address()),
-        checked_u32(plan.full_plan.coefficient_length, "ILWT coefficient length"),
+        checked_u32(ilwt_coefficient_period(plan.full_plan), "ILWT coefficient period"),
         static_cast<uint32_t>(buffers.at(StorageSlot::kA)->get_backing_buffer()->address()),
         static_cast<uint32_t>(buffers.at(StorageSlot::kB)->get_backing_buffer()->address()),
         static_cast<uint32_t>(buffers.chunk_config->get_backing_buffer()->address()),
@@ -832,8 +596,8 @@ void set_runtime_args(
     args.push_back(work.chunk_count);
     for (uint32_t local_chunk = 0; local_chunk < work.chunk_count; ++local_chunk) {
         const auto& chunk = plan.chunks[(work.chunk_begin + local_chunk) % plan.chunks.size()];
-        for (const auto& route : chunk.routes) {
-            args.push_back(output_group_count(route.output_length));
+        for (const size_t output_length : plan.route_table.rows_of(plan.route_table.output_length, chunk.routes)) {
+            args.push_back(output_group_count(output_length));
         }
     }
     return args;
@@ -876,9 +640,9 @@ void set_runtime_args(
         static_cast<uint32_t>(workspace_layout == WorkspaceLayout::kTileNative),
         1U,
         // Inverse reads canonical coefficients, not an extended original
-        // signal. Keep its unused shared-reader boundary specialization fixed
-        // so every ILWT mode reuses the same device binary.
-        static_cast<uint32_t>(BoundaryMode::kSymmetric),
+        // signal, so the shared reader never touches its extension table CB
+        // or the config accessor standing in for the table below.
+        kExtensionTableCb,
         checked_u32(approximation_buffer.page_size(), "ILWT input page size"),
         static_cast<uint32_t>(row_major_noc_staging),
         static_cast<uint32_t>(hybrid_tile_mirror),
@@ -886,6 +650,7 @@ void set_runtime_args(
     tt::tt_metal::TensorAccessorArgs(config_buffer).append_to(reader_compile_args);
     tt::tt_metal::TensorAccessorArgs(approximation_buffer).append_to(reader_compile_args);
     tt::tt_metal::TensorAccessorArgs(detail_buffer).append_to(reader_compile_args);
+    tt::tt_metal::TensorAccessorArgs(config_buffer).append_to(reader_compile_args);
 
     std::vector<uint32_t> writer_compile_args = {
         kWriterConfigCb,
@@ -1004,29 +769,51 @@ LwtExecutable create_lwt_executable_impl(
 
     const uint32_t max_cores = core_limit(mesh_device);
     const ArchitecturePolicy architecture_policy = make_architecture_policy(mesh_device.arch());
-    const std::optional<WorkspaceLayout> workspace_override = workspace_layout_override();
-    const WorkspaceLayout initial_workspace_layout = workspace_override.value_or(WorkspaceLayout::kRowMajor);
-    const bool initial_hybrid_tile_mirror =
-        supports_hybrid_tile_mirror(architecture_policy.architecture, initial_workspace_layout);
-    const uint32_t signal_budget_bytes =
-        planner_signal_budget_bytes(mesh_device, architecture_policy, initial_hybrid_tile_mirror, 1U);
-    LwtExecutionPlan plan =
-        make_lwt_execution_plan(std::move(full_plan), max_cores, signal_budget_bytes, initial_workspace_layout);
-    const bool tile_native_preferred = prefer_tile_native_workspace(plan, architecture_policy.architecture);
-    const bool hybrid_has_steady_state = plan.groups_per_chunk >= kAlignedNocMinGroupsPerChunk;
-    if (!workspace_override.has_value() && tile_native_preferred &&
-        (!initial_hybrid_tile_mirror || !hybrid_has_steady_state)) {
-        plan = make_lwt_execution_plan(
-            std::move(plan.full_plan), max_cores, signal_budget_bytes, WorkspaceLayout::kTileNative);
-    }
-    const bool hybrid_tile_mirror =
-        supports_hybrid_tile_mirror(architecture_policy.architecture, plan.workspace_layout);
-    const bool row_major_noc_staging =
-        prefer_aligned_row_major_noc_staging(plan, plan.groups_per_chunk, hybrid_tile_mirror);
+    LwtDevicePlan device_plan = select_lwt_device_plan(
+        std::move(full_plan),
+        architecture_policy,
+        max_cores,
+        mesh_device.l1_size_per_core(),
+        l1_signal_budget_bytes(),
+        workspace_layout_override());
+    LwtExecutionPlan plan = std::move(device_plan.plan);
+    TT_FATAL(
+        plan.page_geometry.device_native(),
+        "LWT kernels are compiled for {}-element {} sticks, got a plan for {}-element {} sticks",
+        kStickWidth,
+        sample_format_name(SampleFormat::kFloat32),
+        plan.page_geometry.stick_width,
+        sample_format_name(plan.page_geometry.sample_format));
+    const bool hybrid_tile_mirror = device_plan.hybrid_tile_mirror;
+    const bool row_major_noc_staging = device_plan.row_major_noc_staging;
     const uint32_t chunks_per_sample = checked_u32(plan.chunks.size(), "LWT chunks per sample");
     const uint32_t total_work_items =
         checked_u32(static_cast<size_t>(chunks_per_sample) * batch_count, "LWT total batch work items");
-    std::vector<tt::tt_metal::CoreCoord> cores = select_cores(mesh_device, std::min(max_cores, total_work_items));
+    const WorkerGridTopology topology = worker_grid_topology(mesh_device);
+    // Batched samples shift the bank of every page, so placement only pays
+    // off for a single large sample. The plan keeps its chunk order;
+    // placement permutes only the uploaded config pages.
+    std::vector<uint32_t> chunk_order;
+    CoreSelection core_selection;
+    if (batch_count == 1 &&
+        parse_chunk_placement_policy(std::getenv(kChunkPlacementEnv)) == ChunkPlacementPolicy::kDramBankAware) {
+        ChunkPlacement placement = place_chunks_near_dram_banks(
+            topology,
+            make_lwt_chunk_bank_histograms(plan, topology.bank_count()),
+            std::min(max_cores, total_work_items),
+            checked_u32(input_buffer.page_size(), "LWT input page size"));
+        if (placement.reordered()) {
+            chunk_order = std::move(placement.chunk_order);
+            core_selection = std::move(placement.cores);
+        }
+    }
+    const bool dram_bank_chunk_placement = !chunk_order.empty();
+    if (!dram_bank_chunk_placement) {
+        core_selection = select_worker_cores(
+            topology,
+            make_lwt_core_slot_demand(plan, batch_count, std::min(max_cores, total_work_items), topology.bank_count()));
+    }
+    std::vector<tt::tt_metal::CoreCoord> cores = select_cores(core_selection);
     std::array<std::shared_ptr<tt::tt_metal::distributed::MeshBuffer>, 3> slots;
     for (auto& slot : slots) {
         slot = create_workspace_buffer(mesh_device, cores, plan.workspace_elements, hybrid_tile_mirror);
@@ -1042,6 +829,10 @@ LwtExecutable create_lwt_executable_impl(
     auto route_config =
         create_dram_buffer(mesh_device, plan.chunks.size() * route_count, device_protocol::kRouteConfigPageBytes);
     auto chunk_config = create_dram_buffer(mesh_device, plan.chunks.size(), device_protocol::kLwtChunkConfigPageBytes);
+    ExtensionGatherTable extension_table = make_extension_gather_table(lwt_extension_table_key(plan));
+    const uint32_t extension_pages = extension_page_count(plan);
+    auto extension_config =
+        create_dram_buffer(mesh_device, extension_pages, device_protocol::kExtensionConfigPageBytes);
 
     const size_t max_final_length = plan.full_plan.output_length;
     const uint32_t active_core_count = checked_u32(cores.size(), "LWT active core count");
@@ -1051,7 +842,9 @@ LwtExecutable create_lwt_executable_impl(
         .final_odd = std::move(final_odd),
         .route_config = std::move(route_config),
         .chunk_config = std::move(chunk_config),
+        .extension_config = std::move(extension_config),
         .cores = std::move(cores),
+        .chunk_order = std::move(chunk_order),
         .scheduler =
             LiftingSchedulerTelemetry{
                 .signal_length = plan.full_plan.preprocess_layout.input.length,
@@ -1060,6 +853,9 @@ LwtExecutable create_lwt_executable_impl(
                 .chunks_per_sample = chunks_per_sample,
                 .total_work_items = total_work_items,
                 .active_core_count = active_core_count,
+                .modeled_dram_hops = core_selection.modeled_hops,
+                .first_n_modeled_dram_hops = core_selection.first_n_modeled_hops,
+                .dram_bank_chunk_placement = dram_bank_chunk_placement,
                 .chunk_count = checked_u32(plan.chunks.size(), "LWT chunk count"),
                 .route_count = checked_u32(route_count, "LWT route count"),
                 .groups_per_chunk = plan.groups_per_chunk,
@@ -1088,7 +884,7 @@ LwtExecutable create_lwt_executable_impl(
         plan.workspace_layout,
         hybrid_tile_mirror,
         row_major_noc_staging,
-        boundary_mode,
+        extension_pages,
         compute_scheme_header,
         compute_scheme_type);
     set_runtime_args(
@@ -1104,16 +900,33 @@ LwtExecutable create_lwt_executable_impl(
         .plan = std::move(plan),
         .buffers = std::move(buffers),
         .workload = make_workload(mesh_device, std::move(program.program)),
+        .extension_table = std::move(extension_table),
     };
 }
 
 void prepare_lwt(tt::tt_metal::distributed::MeshCommandQueue& command_queue, LwtExecutable& executable) {
-    const std::vector<uint32_t> chunk_words = build_chunk_config_words(executable.plan);
-    const std::vector<uint32_t> route_words = build_route_config_words(executable.plan, executable.buffers);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(
-        command_queue, executable.buffers.chunk_config, chunk_words, false);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(
-        command_queue, executable.buffers.route_config, route_words, false);
+    // The staging buffer is sized once per executable and must stay alive
+    // until Finish because every upload is non-blocking.
+    executable.config_upload.resize(lwt_config_upload_word_count(executable.plan));
+    prepare_lwt(command_queue, executable, executable.config_upload);
+}
+
+void prepare_lwt(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    LwtExecutable& executable,
+    const std::span<uint32_t> upload_words) {
+    const std::span<const uint32_t> chunk_words =
+        write_lwt_chunk_config_words(executable.plan, upload_words, executable.buffers.chunk_order);
+    const std::span<const uint32_t> route_words = write_lwt_route_config_words(
+        executable.plan,
+        config_addresses(executable.buffers),
+        upload_words.subspan(chunk_words.size()),
+        executable.buffers.chunk_order);
+    const std::span<const uint32_t> extension_words = write_extension_config_words(
+        executable.extension_table, upload_words.subspan(chunk_words.size() + route_words.size()));
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.chunk_config, chunk_words.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.route_config, route_words.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.extension_config, extension_words.data(), false);
     tt::tt_metal::distributed::Finish(command_queue);
 }
 
@@ -1152,40 +965,26 @@ IlwtExecutable create_ilwt_executable_impl(
     const uint32_t max_cores = core_limit(mesh_device);
     const std::optional<WorkspaceLayout> workspace_override = workspace_layout_override();
     const ArchitecturePolicy architecture_policy = make_architecture_policy(mesh_device.arch(), workspace_override);
-    const uint32_t interleave_batch_sticks = ilwt_interleave_batch_sticks(architecture_policy.architecture);
-    const bool initial_hybrid_tile_mirror =
-        supports_hybrid_tile_mirror(architecture_policy.architecture, architecture_policy.ilwt_layout);
-    const uint32_t signal_budget_bytes = planner_signal_budget_bytes(
-        mesh_device, architecture_policy, initial_hybrid_tile_mirror, interleave_batch_sticks);
-    TT_FATAL(architecture_policy.inverse_scale_inline, "ILWT policy must preserve inline FP32 inverse scaling");
-    IlwtExecutionPlan plan = make_ilwt_execution_plan(
+    IlwtDevicePlan device_plan = select_ilwt_device_plan(
         std::move(full_plan),
+        architecture_policy,
         max_cores,
-        signal_budget_bytes,
-        architecture_policy.ilwt_layout,
-        architecture_policy.final_interleave_direct);
-    const WorkspaceLayout preferred_layout =
-        prefer_tile_native_inverse_workspace(plan, architecture_policy.architecture) ? WorkspaceLayout::kTileNative
-                                                                                     : WorkspaceLayout::kRowMajor;
-    if (!workspace_override.has_value() && plan.workspace_layout != preferred_layout) {
-        const ArchitecturePolicy preferred_policy =
-            make_architecture_policy(architecture_policy.architecture, preferred_layout);
-        plan = make_ilwt_execution_plan(
-            std::move(plan.full_plan),
-            max_cores,
-            signal_budget_bytes,
-            preferred_layout,
-            preferred_policy.final_interleave_direct);
-    }
-    const bool hybrid_tile_mirror =
-        supports_hybrid_tile_mirror(architecture_policy.architecture, plan.workspace_layout);
-    const bool row_major_noc_staging =
-        prefer_aligned_row_major_noc_staging(plan, plan.output_groups_per_chunk, hybrid_tile_mirror);
+        mesh_device.l1_size_per_core(),
+        l1_signal_budget_bytes(),
+        workspace_override);
+    IlwtExecutionPlan plan = std::move(device_plan.plan);
+    const uint32_t interleave_batch_sticks = device_plan.interleave_batch_sticks;
+    const bool hybrid_tile_mirror = device_plan.hybrid_tile_mirror;
+    const bool row_major_noc_staging = device_plan.row_major_noc_staging;
 
     const uint32_t chunks_per_sample = checked_u32(plan.chunks.size(), "ILWT chunks per sample");
     const uint32_t total_work_items =
         checked_u32(static_cast<size_t>(chunks_per_sample) * batch_count, "ILWT total batch work items");
-    std::vector<tt::tt_metal::CoreCoord> cores = select_cores(mesh_device, std::min(max_cores, total_work_items));
+    const WorkerGridTopology topology = worker_grid_topology(mesh_device);
+    const CoreSelection core_selection = select_worker_cores(
+        topology,
+        make_ilwt_core_slot_demand(plan, batch_count, std::min(max_cores, total_work_items), topology.bank_count()));
+    std::vector<tt::tt_metal::CoreCoord> cores = select_cores(core_selection);
     std::array<std::shared_ptr<tt::tt_metal::distributed::MeshBuffer>, 3> slots;
     for (auto& slot : slots) {
         slot = create_workspace_buffer(mesh_device, cores, plan.workspace_elements, hybrid_tile_mirror);
@@ -1220,6 +1019,8 @@ IlwtExecutable create_ilwt_executable_impl(
                 .chunks_per_sample = chunks_per_sample,
                 .total_work_items = total_work_items,
                 .active_core_count = active_core_count,
+                .modeled_dram_hops = core_selection.modeled_hops,
+                .first_n_modeled_dram_hops = core_selection.first_n_modeled_hops,
                 .chunk_count = checked_u32(plan.chunks.size(), "ILWT chunk count"),
                 .route_count = checked_u32(route_count, "ILWT route count"),
                 .groups_per_chunk = plan.output_groups_per_chunk,
@@ -1274,12 +1075,21 @@ IlwtExecutable create_ilwt_executable_impl(
 }
 
 void prepare_ilwt(tt::tt_metal::distributed::MeshCommandQueue& command_queue, IlwtExecutable& executable) {
-    const std::vector<uint32_t> chunk_words = build_inverse_chunk_config_words(executable.plan, executable.buffers);
-    const std::vector<uint32_t> route_words = build_inverse_route_config_words(executable.plan, executable.buffers);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(
-        command_queue, executable.buffers.chunk_config, chunk_words, false);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(
-        command_queue, executable.buffers.route_config, route_words, false);
+    executable.config_upload.resize(ilwt_config_upload_word_count(executable.plan));
+    prepare_ilwt(command_queue, executable, executable.config_upload);
+}
+
+void prepare_ilwt(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    IlwtExecutable& executable,
+    const std::span<uint32_t> upload_words) {
+    const IlwtConfigAddresses addresses = config_addresses(executable.buffers);
+    const std::span<const uint32_t> chunk_words =
+        write_ilwt_chunk_config_words(executable.plan, addresses, upload_words);
+    const std::span<const uint32_t> route_words =
+        write_ilwt_route_config_words(executable.plan, addresses, upload_words.subspan(chunk_words.size()));
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.chunk_config, chunk_words.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.route_config, route_words.data(), false);
     tt::tt_metal::distributed::Finish(command_queue);
 }
 
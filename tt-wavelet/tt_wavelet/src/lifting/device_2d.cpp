@@ -8,11 +8,13 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <filesystem>
 #include <limits>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,6 +27,8 @@
 #include "tt-metalium/shape.hpp"
 #include "tt-metalium/tensor_accessor_args.hpp"
 #include "tt-metalium/tile.hpp"
+#include "tt_wavelet/include/lifting/chunk_placement.hpp"
+#include "tt_wavelet/include/lifting/core_selection.hpp"
 #include "tt_wavelet/include/lifting/policy.hpp"
 
 namespace ttwv {
@@ -49,6 +53,7 @@ constexpr uint32_t kConfigNocAlignmentBytes = 64;
 constexpr const char* kReaderKernel = "kernels/dataflow/lwt_2d_reader.cpp";
 constexpr const char* kComputeKernel = "kernels/compute/lwt_2d_compute.cpp";
 constexpr const char* kWriterKernel = "kernels/dataflow/lwt_2d_writer.cpp";
+constexpr const char* kChunkPlacementEnv = "TT_WAVELET_CHUNK_PLACEMENT";
 
 [[nodiscard]] constexpr uint32_t split_scratch_tile_count(const BoundaryMode boundary_mode, const bool inverse) {
     return !inverse && boundary_mode == BoundaryMode::kSymmetric ? device_protocol::kLwt2DSymmetricSplitScratchTileCount
@@ -94,14 +99,50 @@ struct CoreChunkWork {
     return root / relative;
 }
 
-[[nodiscard]] std::vector<tt::tt_metal::CoreCoord> select_cores(
-    tt::tt_metal::distributed::MeshDevice& mesh_device, const uint32_t active_core_count) {
+[[nodiscard]] WorkerGridTopology worker_grid_topology(tt::tt_metal::distributed::MeshDevice& mesh_device) {
+    // Harvested rows and columns never appear in the logical grid, so walking
+    // the logical-to-NoC mapping yields exactly the workers this device has.
     const auto grid = mesh_device.compute_with_storage_grid_size();
-    TT_FATAL(
-        active_core_count > 0 && active_core_count <= static_cast<uint32_t>(grid.x * grid.y),
-        "2D LWT active core count exceeds the worker grid");
-    return tt::tt_metal::grid_to_cores(
-        active_core_count, static_cast<uint32_t>(grid.x), static_cast<uint32_t>(grid.y), true);
+    std::vector<uint32_t> columns;
+    columns.reserve(grid.x);
+    for (size_t x = 0; x < grid.x; ++x) {
+        columns.push_back(static_cast<uint32_t>(mesh_device.worker_core_from_logical_core({x, 0}).x));
+    }
+    std::vector<uint32_t> rows;
+    rows.reserve(grid.y);
+    for (size_t y = 0; y < grid.y; ++y) {
+        rows.push_back(static_cast<uint32_t>(mesh_device.worker_core_from_logical_core({0, y}).y));
+    }
+
+    const auto& allocator = mesh_device.allocator();
+    const uint32_t bank_count = allocator->get_num_banks(tt::tt_metal::BufferType::DRAM);
+    std::vector<NocCoordinate> dram_bank_endpoints;
+    dram_bank_endpoints.reserve(bank_count);
+    for (uint32_t bank = 0; bank < bank_count; ++bank) {
+        const tt::tt_metal::CoreCoord endpoint = mesh_device.virtual_core_from_logical_core(
+            mesh_device.logical_core_from_dram_channel(allocator->get_dram_channel_from_bank_id(bank)),
+            tt::CoreType::DRAM);
+        dram_bank_endpoints.push_back(
+            NocCoordinate{.x = static_cast<uint32_t>(endpoint.x), .y = static_cast<uint32_t>(endpoint.y)});
+    }
+
+    const auto noc = mesh_device.grid_size();
+    return make_worker_grid_topology(
+        mesh_device.arch() == tt::ARCH::BLACKHOLE ? "blackhole" : "wormhole_b0",
+        static_cast<uint32_t>(noc.x),
+        static_cast<uint32_t>(noc.y),
+        std::move(columns),
+        std::move(rows),
+        std::move(dram_bank_endpoints));
+}
+
+[[nodiscard]] std::vector<tt::tt_metal::CoreCoord> select_cores(const CoreSelection& selection) {
+    std::vector<tt::tt_metal::CoreCoord> cores;
+    cores.reserve(selection.cores.size());
+    for (const NocCoordinate core : selection.cores) {
+        cores.emplace_back(core.x, core.y);
+    }
+    return cores;
 }
 
 [[nodiscard]] tt::tt_metal::CoreRangeSet core_set(const std::vector<tt::tt_metal::CoreCoord>& cores) {
@@ -345,19 +386,21 @@ void replace_plane_tile_counts_with_widths(std::vector<uint32_t>& args, const Pl
 }
 
 template <typename Plan>
-[[nodiscard]] std::vector<uint32_t> compute_args(const Plan& plan, const CoreChunkWork& work) {
+[[nodiscard]] std::vector<uint32_t> compute_args(
+    const Plan& plan, const std::span<const uint32_t> chunk_order, const CoreChunkWork& work) {
     const size_t route_count = plan.chunks.front().routes.size();
     const size_t packed_words_per_chunk = ceil_div(route_count, static_cast<size_t>(4));
     std::vector<uint32_t> args;
     args.reserve(1 + static_cast<size_t>(work.chunk_count) * packed_words_per_chunk);
     args.push_back(work.chunk_count);
     for (uint32_t local_chunk = 0; local_chunk < work.chunk_count; ++local_chunk) {
-        const Lwt2DChunkPlan& chunk = plan.chunks[(work.chunk_begin + local_chunk) % plan.chunks.size()];
+        const Lwt2DChunkPlan& chunk =
+            plan.chunks[chunk_at_page(chunk_order, (work.chunk_begin + local_chunk) % plan.chunks.size())];
         for (size_t route_begin = 0; route_begin < route_count; route_begin += 4) {
             uint32_t packed_counts = 0;
             const size_t route_end = std::min(route_begin + 4, route_count);
             for (size_t route_index = route_begin; route_index < route_end; ++route_index) {
-                const uint32_t count = route_tile_count(chunk.routes[route_index]);
+                const uint32_t count = route_tile_count(plan.route_table.at(chunk.routes, route_index));
                 TT_FATAL(
                     count <= std::numeric_limits<uint8_t>::max(), "2D route tile count {} exceeds packed uint8", count);
                 packed_counts |= count << (8 * (route_index - route_begin));
@@ -488,8 +531,29 @@ Lwt2DExecutable create_lwt_2d_executable_impl(
     const uint32_t total_work_items =
         checked_u32(static_cast<size_t>(chunks_per_sample) * batch_count, "2D LWT total batch work items");
     const uint32_t effective_core_limit = (core_limit == 0) ? std::numeric_limits<uint32_t>::max() : core_limit;
-    std::vector<tt::tt_metal::CoreCoord> cores =
-        select_cores(mesh_device, std::min(effective_core_limit, total_work_items));
+    const WorkerGridTopology topology = worker_grid_topology(mesh_device);
+    std::vector<uint32_t> chunk_order;
+    CoreSelection core_selection;
+    if (batch_count == 1 &&
+        parse_chunk_placement_policy(std::getenv(kChunkPlacementEnv)) == ChunkPlacementPolicy::kDramBankAware) {
+        ChunkPlacement placement = place_chunks_near_dram_banks(
+            topology,
+            make_lwt_2d_chunk_bank_histograms(plan, topology.bank_count()),
+            std::min(effective_core_limit, total_work_items),
+            kTileBytes);
+        if (placement.reordered()) {
+            chunk_order = std::move(placement.chunk_order);
+            core_selection = std::move(placement.cores);
+        }
+    }
+    const bool dram_bank_chunk_placement = !chunk_order.empty();
+    if (!dram_bank_chunk_placement) {
+        core_selection = select_worker_cores(
+            topology,
+            make_lwt_2d_core_slot_demand(
+                plan, batch_count, std::min(effective_core_limit, total_work_items), topology.bank_count()));
+    }
+    std::vector<tt::tt_metal::CoreCoord> cores = select_cores(core_selection);
 
     std::array<std::shared_ptr<tt::tt_metal::distributed::MeshBuffer>, device_protocol::kLwt2DPlaneCount> planes;
     for (size_t slot = 0; slot < planes.size(); ++slot) {
@@ -533,6 +597,7 @@ Lwt2DExecutable create_lwt_2d_executable_impl(
         .route_config = std::move(route_config),
         .band_config = std::move(band_config),
         .cores = std::move(cores),
+        .chunk_order = std::move(chunk_order),
         .scheduler =
             Lwt2DSchedulerTelemetry{
                 .architecture = mesh_device.arch(),
@@ -544,6 +609,9 @@ Lwt2DExecutable create_lwt_2d_executable_impl(
                 .available_worker_core_count = static_cast<uint32_t>(
                     mesh_device.compute_with_storage_grid_size().x * mesh_device.compute_with_storage_grid_size().y),
                 .active_core_count = active_core_count,
+                .modeled_dram_hops = core_selection.modeled_hops,
+                .first_n_modeled_dram_hops = core_selection.first_n_modeled_hops,
+                .dram_bank_chunk_placement = dram_bank_chunk_placement,
                 .batch_count = batch_count,
                 .chunks_per_sample = chunks_per_sample,
                 .total_work_items = total_work_items,
@@ -610,7 +678,7 @@ Lwt2DExecutable create_lwt_2d_executable_impl(
                     "2D input tiles per sample")));
         if (program.compute) {
             tt::tt_metal::SetRuntimeArgs(
-                program.program, *program.compute, core_work.core, compute_args(plan, core_work));
+                program.program, *program.compute, core_work.core, compute_args(plan, buffers.chunk_order, core_work));
         }
         if (program.writer) {
             tt::tt_metal::SetRuntimeArgs(
@@ -653,8 +721,15 @@ Ilwt2DExecutable create_ilwt_2d_executable_impl(
     const uint32_t total_work_items =
         checked_u32(static_cast<size_t>(chunks_per_sample) * batch_count, "2D ILWT total batch work items");
     const uint32_t effective_core_limit = (core_limit == 0) ? std::numeric_limits<uint32_t>::max() : core_limit;
-    std::vector<tt::tt_metal::CoreCoord> cores =
-        select_cores(mesh_device, std::min(effective_core_limit, total_work_items));
+    // Band reads are not modelled yet; zero demand keeps the row-major
+    // first-N order while sharing the selector and its telemetry.
+    const WorkerGridTopology topology = worker_grid_topology(mesh_device);
+    const CoreSelection core_selection = select_worker_cores(
+        topology,
+        std::vector<DramBankHistogram>(
+            std::min(effective_core_limit, total_work_items),
+            DramBankHistogram{.pages_per_bank = std::vector<uint64_t>(topology.bank_count())}));
+    std::vector<tt::tt_metal::CoreCoord> cores = select_cores(core_selection);
 
     std::array<std::shared_ptr<tt::tt_metal::distributed::MeshBuffer>, device_protocol::kLwt2DPlaneCount> planes;
     for (size_t slot = 0; slot < planes.size(); ++slot) {
@@ -706,6 +781,8 @@ Ilwt2DExecutable create_ilwt_2d_executable_impl(
                 .available_worker_core_count = static_cast<uint32_t>(
                     mesh_device.compute_with_storage_grid_size().x * mesh_device.compute_with_storage_grid_size().y),
                 .active_core_count = active_core_count,
+                .modeled_dram_hops = core_selection.modeled_hops,
+                .first_n_modeled_dram_hops = core_selection.first_n_modeled_hops,
                 .batch_count = batch_count,
                 .chunks_per_sample = chunks_per_sample,
                 .total_work_items = total_work_items,
@@ -761,7 +838,8 @@ Ilwt2DExecutable create_ilwt_2d_executable_impl(
                     checked_shape_area_2d(plan.tiling.band.storage, "2D ILWT input tiles") /
                         device_protocol::kLwt2DFullTileElements,
                     "2D ILWT input tiles per sample")));
-        tt::tt_metal::SetRuntimeArgs(program.program, *program.compute, core_work.core, compute_args(plan, core_work));
+        tt::tt_metal::SetRuntimeArgs(
+            program.program, *program.compute, core_work.core, compute_args(plan, buffers.chunk_order, core_work));
         tt::tt_metal::SetRuntimeArgs(
             program.program,
             *program.writer,
@@ -784,12 +862,24 @@ Ilwt2DExecutable create_ilwt_2d_executable_impl(
 }
 
 void prepare_lwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue, Lwt2DExecutable& executable) {
-    const std::vector<uint32_t> chunks = build_lwt_2d_chunk_config_words(executable.plan);
-    const std::vector<uint32_t> routes = build_lwt_2d_route_config_words(executable.plan);
-    const std::vector<uint32_t> bands = build_lwt_2d_band_config_words(executable.plan);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(command_queue, executable.buffers.chunk_config, chunks, false);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(command_queue, executable.buffers.route_config, routes, false);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(command_queue, executable.buffers.band_config, bands, false);
+    executable.config_upload.resize(lwt_2d_config_upload_word_count(executable.plan));
+    prepare_lwt_2d(command_queue, executable, executable.config_upload);
+}
+
+void prepare_lwt_2d(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    Lwt2DExecutable& executable,
+    const std::span<uint32_t> upload_words) {
+    const std::span<const uint32_t> chunk_order = executable.buffers.chunk_order;
+    const std::span<const uint32_t> chunks =
+        write_lwt_2d_chunk_config_words(executable.plan, upload_words, chunk_order);
+    const std::span<uint32_t> remaining = upload_words.subspan(chunks.size());
+    const std::span<const uint32_t> routes = write_lwt_2d_route_config_words(executable.plan, remaining, chunk_order);
+    const std::span<const uint32_t> bands =
+        write_lwt_2d_band_config_words(executable.plan, remaining.subspan(routes.size()), chunk_order);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.chunk_config, chunks.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.route_config, routes.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.band_config, bands.data(), false);
 
     const size_t output_elements = executable.buffers.scheduler.batch_count *
                                    checked_shape_area_2d(executable.plan.tiling.band.storage, "2D output band");
@@ -801,12 +891,22 @@ void prepare_lwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue,
 }
 
 void prepare_ilwt_2d(tt::tt_metal::distributed::MeshCommandQueue& command_queue, Ilwt2DExecutable& executable) {
-    const std::vector<uint32_t> chunks = build_ilwt_2d_chunk_config_words(executable.plan);
-    const std::vector<uint32_t> routes = build_ilwt_2d_route_config_words(executable.plan);
-    const std::vector<uint32_t> terminal = build_ilwt_2d_band_config_words(executable.plan);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(command_queue, executable.buffers.chunk_config, chunks, false);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(command_queue, executable.buffers.route_config, routes, false);
-    tt::tt_metal::distributed::EnqueueWriteMeshBuffer(command_queue, executable.buffers.band_config, terminal, false);
+    executable.config_upload.resize(ilwt_2d_config_upload_word_count(executable.plan));
+    prepare_ilwt_2d(command_queue, executable, executable.config_upload);
+}
+
+void prepare_ilwt_2d(
+    tt::tt_metal::distributed::MeshCommandQueue& command_queue,
+    Ilwt2DExecutable& executable,
+    const std::span<uint32_t> upload_words) {
+    const std::span<const uint32_t> chunks = write_ilwt_2d_chunk_config_words(executable.plan, upload_words);
+    const std::span<uint32_t> remaining = upload_words.subspan(chunks.size());
+    const std::span<const uint32_t> routes = write_ilwt_2d_route_config_words(executable.plan, remaining);
+    const std::span<const uint32_t> terminal =
+        write_ilwt_2d_band_config_words(executable.plan, remaining.subspan(routes.size()));
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.chunk_config, chunks.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.route_config, routes.data(), false);
+    command_queue.enqueue_write_mesh_buffer(executable.buffers.band_config, terminal.data(), false);
     const size_t output_elements = executable.buffers.scheduler.batch_count *
                                    checked_shape_area_2d(executable.plan.tiling.input.storage, "2D ILWT output");
     tt::tt_metal::distributed::EnqueueWriteMeshBuffer(
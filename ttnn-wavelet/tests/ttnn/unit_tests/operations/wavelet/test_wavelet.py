@@ -671,6 +671,31 @@ def test_wavelet_1d_program_cache_keys_and_address_override(
         device.disable_and_clear_program_cache()
 
 
+def test_wavelet_1d_stick_native_length_bucket_program_cache(
+    device: ttnn.MeshDevice,
+) -> None:
+    device.disable_and_clear_program_cache()
+    device.enable_program_cache()
+    try:
+        # db1 buckets stick-native inputs by final output group: [1, 3072] and
+        # [3073, 6144]. Members of one bucket share a program planned for its
+        # longest length; only the runtime lengths change.
+        for length, expected_entries in ((64, 1), (2048, 1), (3072, 1), (4096, 2)):
+            indices = torch.arange(length, dtype=torch.float32)
+            signal = 0.125 * indices + torch.sin(0.7 * indices)
+            approximation_ref, detail_ref = pywt.dwt(signal.numpy(), "db1", mode="symmetric")
+
+            approximation, detail = ttnn.dwt(
+                to_device_1d(device, signal.reshape(stick_shape(length))), "db1", boundary_mode="symmetric"
+            )
+            assert device.num_program_cache_entries() == expected_entries, length
+            assert tuple(approximation.shape) == stick_shape(len(approximation_ref))
+            assert_fp32_close_1d(approximation, torch.from_numpy(approximation_ref), atol=2e-4)
+            assert_fp32_close_1d(detail, torch.from_numpy(detail_ref), atol=2e-4)
+    finally:
+        device.disable_and_clear_program_cache()
+
+
 def test_wavelet_2d_program_cache_keys_and_address_override(
     device: ttnn.MeshDevice,
 ) -> None:
@@ -411,6 +411,8 @@ void kernel_main() {
         const uint32_t tile_mirror_offset = get_arg_val<uint32_t>(6);
         const uint32_t chunks_per_sample = get_arg_val<uint32_t>(7);
         const uint32_t output_pages_per_sample = get_arg_val<uint32_t>(8);
+        // Coefficients of this call; a bucketed program plans its longest member.
+        const uint32_t valid_output_length = get_arg_val<uint32_t>(9);
         const uint32_t local_route_count = chunk_count * route_count;
         uint32_t flattened_route = 0;
         for (uint32_t local_chunk = 0; local_chunk < chunk_count; ++local_chunk) {
@@ -433,8 +435,13 @@ void kernel_main() {
                                       ? final_even_addr
                                       : final_odd_addr;
                     const auto dst = TensorAccessor(final_args, output_addr, output_page_size);
+                    const uint32_t valid_route_length =
+                        output_offset >= valid_output_length
+                            ? 0
+                            : (output_length < valid_output_length - output_offset ? output_length
+                                                                                   : valid_output_length - output_offset);
                     write_dram_output_groups(
-                        dst, cb_output, tile_bytes, output_page, output_offset, output_length, group_count);
+                        dst, cb_output, tile_bytes, output_page, output_offset, valid_route_length, group_count);
                 } else {
                     write_local_output_groups<use_noc_local_write, tile_native_workspace, hybrid_tile_mirror>(
                         resolve_workspace_slot(output_addr, workspace_a_addr, workspace_b_addr, workspace_scratch_addr),
@@ -27,9 +27,11 @@
 #include "tt-metalium/workload_descriptor.hpp"
 #include "ttnn/operations/wavelet/common/wavelet_host.hpp"
 #include "ttnn/operations/wavelet/device/protocol/lwt_config.hpp"
+#include "ttnn/operations/wavelet/planner/bucket_plan.hpp"
 #include "ttnn/operations/wavelet/planner/inverse_plan.hpp"
 #include "ttnn/operations/wavelet/planner/l1_accounting.hpp"
 #include "ttnn/operations/wavelet/planner/policy.hpp"
+#include "ttnn/operation.hpp"
 #include "ttnn/tensor/tensor_ops.hpp"
 
 namespace ttnn::prim {
@@ -105,6 +107,7 @@ struct Logical1DShape {
     uint32_t batch_count{1};
     uint32_t length{0};
     bool rank_four{false};
+    bool stick_native{false};
 };
 
 [[nodiscard]] uint32_t checked_u32(const size_t value, const char* label) {
@@ -130,6 +133,7 @@ struct Logical1DShape {
             .batch_count = 1,
             .length = checked_u32(static_cast<uint64_t>(shape[0]) * shape[1], tensor_name),
             .rank_four = false,
+            .stick_native = true,
         };
     }
     if (shape.rank() == 1) {
@@ -137,6 +141,7 @@ struct Logical1DShape {
             .batch_count = 1,
             .length = checked_u32(shape[0], tensor_name),
             .rank_four = false,
+            .stick_native = false,
         };
     }
     TT_FATAL(
@@ -152,6 +157,7 @@ struct Logical1DShape {
             .batch_count = checked_u32(shape[0], "1D wavelet batch count"),
             .length = checked_u32(static_cast<uint64_t>(shape[2]) * shape[3], tensor_name),
             .rank_four = true,
+            .stick_native = true,
         };
     }
     TT_FATAL(shape[2] == 1, "{} requires H == 1, got {}", tensor_name, shape[2]);
@@ -159,9 +165,23 @@ struct Logical1DShape {
         .batch_count = checked_u32(shape[0], "1D wavelet batch count"),
         .length = checked_u32(shape[3], tensor_name),
         .rank_four = true,
+        .stick_native = false,
     };
 }
 
+// Stick-native inputs keep one 128-byte page per stick at every length, so
+// nothing compiled into the forward program depends on the exact length: one
+// program, planned for the longest member, serves the whole length bucket.
+// Other shapes compile their page size into the reader and plan exactly.
+[[nodiscard]] std::optional<LengthBucket> forward_length_bucket(
+    const Lwt1DParams& operation_attributes, const Logical1DShape& input_shape) {
+    if (!input_shape.stick_native) {
+        return std::nullopt;
+    }
+    return make_lwt_length_bucket(
+        input_shape.length, scheme_info(operation_attributes.scheme_id).tap_size, operation_attributes.boundary_mode);
+}
+
 [[nodiscard]] uint32_t pages_per_batch_item(const Tensor& tensor, const uint32_t batch_count, const char* tensor_name) {
     TT_FATAL(batch_count > 0, "{} batch count must be positive", tensor_name);
     const uint64_t physical_bytes = static_cast<uint64_t>(tensor.physical_volume()) * sizeof(float);
@@ -492,12 +512,13 @@ void add_narrow_tile_circular_buffer(
     const LwtWorkingBuffers& buffers,
     const tt::tt_metal::Buffer& input_buffer,
     const CoreChunkWork& work,
+    const uint32_t input_length,
     const uint32_t chunks_per_sample,
     const uint32_t input_pages_per_sample) {
     tt::tt_metal::KernelDescriptor::RTArgList args;
-    args.reserve(10);
+    args.reserve(13);
     args.push_back(const_cast<tt::tt_metal::Buffer*>(&input_buffer));
-    args.push_back(checked_u32(plan.full_plan.preprocess_layout.input.length, "LWT input length"));
+    args.push_back(input_length);
     args.push_back(plan.full_plan.preprocess_layout.pad_config.left);
     args.push_back(buffers.slot_id(StorageSlot::kA));
     args.push_back(buffers.slot_id(StorageSlot::kB));
@@ -516,10 +537,11 @@ void add_narrow_tile_circular_buffer(
     const LwtExecutionPlan& plan,
     const LwtWorkingBuffers& buffers,
     const CoreChunkWork& work,
+    const uint32_t output_length,
     const uint32_t chunks_per_sample,
     const uint32_t output_pages_per_sample) {
     tt::tt_metal::KernelDescriptor::RTArgList args;
-    args.reserve(6);
+    args.reserve(10);
     args.push_back(buffers.route_config->get_backing_buffer());
     args.push_back(work.chunk_begin);
     args.push_back(work.chunk_count);
@@ -529,6 +551,7 @@ void add_narrow_tile_circular_buffer(
     args.push_back(checked_u32(plan.workspace_elements * sizeof(float), "LWT tile mirror offset"));
     args.push_back(chunks_per_sample);
     args.push_back(output_pages_per_sample);
+    args.push_back(output_length);
     return args;
 }
 
@@ -558,6 +581,8 @@ void add_narrow_tile_circular_buffer(
     const char* compute_scheme_header,
     const char* compute_scheme_type,
     const std::vector<CoreChunkWork>& work,
+    const uint32_t input_length,
+    const uint32_t output_length,
     const uint32_t chunks_per_sample,
     const uint32_t input_pages_per_sample,
     const uint32_t output_pages_per_sample) {
@@ -655,12 +680,14 @@ void add_narrow_tile_circular_buffer(
     for (const auto& core_work : work) {
         reader_descriptor.emplace_runtime_args(
             core_work.core,
-            reader_runtime_args(plan, buffers, input_buffer, core_work, chunks_per_sample, input_pages_per_sample));
+            reader_runtime_args(
+                plan, buffers, input_buffer, core_work, input_length, chunks_per_sample, input_pages_per_sample));
         tt::tt_metal::KernelDescriptor::RTArgList compute_args;
         compute_args.append(compute_runtime_args(plan, core_work));
         compute_descriptor.emplace_runtime_args(core_work.core, compute_args);
         writer_descriptor.emplace_runtime_args(
-            core_work.core, writer_runtime_args(plan, buffers, core_work, chunks_per_sample, output_pages_per_sample));
+            core_work.core,
+            writer_runtime_args(plan, buffers, core_work, output_length, chunks_per_sample, output_pages_per_sample));
     }
 
     descriptor.kernels.push_back(std::move(reader_descriptor));
@@ -1167,8 +1194,13 @@ template <typename Scheme>
     auto& mesh_device = *tensor_args.input.device();
     const auto& input_buffer = *tensor_args.input.buffer();
     const Logical1DShape input_shape = logical_1d_shape(tensor_args.input, "DWT input");
-    LwtExecutionPlan plan =
-        make_forward_execution_plan<Scheme>(mesh_device, input_shape.length, operation_attributes.boundary_mode);
+    const std::optional<LengthBucket> bucket = forward_length_bucket(operation_attributes, input_shape);
+    LwtExecutionPlan plan = make_forward_execution_plan<Scheme>(
+        mesh_device, bucket ? bucket->max_length : input_shape.length, operation_attributes.boundary_mode);
+    if (bucket) {
+        validate_lwt_length_bucket<Scheme>(*bucket, plan.full_plan, operation_attributes.boundary_mode, kStickWidth);
+    }
+    const uint32_t output_length = dwt_coefficient_length(input_shape.length, operation_attributes.scheme_id);
     const ArchitecturePolicy architecture_policy = make_architecture_policy(mesh_device.arch());
     const bool hybrid_tile_mirror =
         supports_hybrid_tile_mirror(architecture_policy.architecture, plan.workspace_layout);
@@ -1254,6 +1286,8 @@ template <typename Scheme>
         Scheme::compute_scheme_header,
         Scheme::compute_scheme_type,
         work,
+        input_shape.length,
+        output_length,
         chunks_per_sample,
         input_pages_per_sample,
         output_pages_per_sample);
@@ -1447,6 +1481,23 @@ tt::tt_metal::WorkloadDescriptor Lwt1DDeviceOperation::ProgramFactory::create_wo
     });
 }
 
+tt::stl::hash::hash_t Lwt1DDeviceOperation::compute_program_hash(
+    const operation_attributes_t& operation_attributes, const tensor_args_t& tensor_args) {
+    const Tensor& input = tensor_args.input;
+    const Logical1DShape input_shape = logical_1d_shape(input, "DWT input");
+    const std::optional<LengthBucket> bucket = forward_length_bucket(operation_attributes, input_shape);
+    return tt::tt_metal::operation::hash_operation<Lwt1DDeviceOperation>(
+        operation_attributes,
+        input.dtype(),
+        input.memory_config(),
+        input.logical_shape().rank(),
+        input.buffer()->page_size(),
+        input_shape.batch_count,
+        bucket ? bucket->min_length : size_t{input_shape.length},
+        bucket ? bucket->max_length : size_t{input_shape.length},
+        tensor_args.preallocated_outputs.has_value());
+}
+
 void Lwt1DDeviceOperation::validate_on_program_cache_miss(
     const operation_attributes_t& operation_attributes, const tensor_args_t& tensor_args) {
     validate_forward_inputs(operation_attributes, tensor_args);
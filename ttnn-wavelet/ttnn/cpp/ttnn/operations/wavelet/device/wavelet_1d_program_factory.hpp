@@ -46,6 +46,8 @@ struct Lwt1DDeviceOperation {
 
     using program_factory_t = std::variant<ProgramFactory>;
 
+    // Stick-native inputs are keyed by length bucket rather than exact length.
+    static tt::stl::hash::hash_t compute_program_hash(const operation_attributes_t&, const tensor_args_t&);
     static void validate_on_program_cache_miss(const operation_attributes_t&, const tensor_args_t&);
     static void validate_on_program_cache_hit(const operation_attributes_t&, const tensor_args_t&);
     static spec_return_value_t compute_output_specs(const operation_attributes_t&, const tensor_args_t&);
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent USA, Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tt_stl/assert.hpp>
+
+#include "ttnn/operations/wavelet/common/boundary.hpp"
+#include "ttnn/operations/wavelet/common/constants.hpp"
+#include "ttnn/operations/wavelet/common/signal.hpp"
+#include "ttnn/operations/wavelet/device/protocol/lwt_config.hpp"
+#include "ttnn/operations/wavelet/planner/plan.hpp"
+
+namespace ttnn::operations::wavelet {
+
+/**
+ * Inclusive range of logical input lengths served by one cached program.
+ */
+struct LengthBucket {
+    size_t min_length{1};
+    size_t max_length{1};
+
+    [[nodiscard]] constexpr bool contains(const size_t length) const noexcept {
+        return min_length <= length && length <= max_length;
+    }
+};
+
+/**
+ * Bucket containing `length`: every input whose canonical output fits the
+ * same number of final output groups. Reflect and antireflect buckets start
+ * at two samples.
+ */
+[[nodiscard]] inline LengthBucket make_lwt_length_bucket(
+    const size_t length, const size_t tap_size, const BoundaryMode boundary_mode) {
+    TT_FATAL(length > 0, "LWT length bucket requires a positive length");
+    constexpr size_t group = device_protocol::kLwtGroupOutputElements;
+    TT_FATAL(tap_size <= 2 * group, "Lifting tap {} exceeds one output group", tap_size);
+    // A length with output (N + tap - 1) / 2 <= M satisfies N <= 2 * M + 2 - tap.
+    const auto max_length_for_groups = [tap_size](const size_t groups) { return 2 * groups * group + 2 - tap_size; };
+    const size_t groups = std::max(ceil_div((length + tap_size - 1) / 2, group), size_t{1});
+    const size_t shortest = boundary_mode_requires_multiple_samples(boundary_mode) ? 2 : 1;
+    return LengthBucket{
+        .min_length = groups == 1 ? shortest : max_length_for_groups(groups - 1) + 1,
+        .max_length = max_length_for_groups(groups),
+    };
+}
+
+namespace bucket_detail {
+
+[[nodiscard]] inline bool same_route_geometry(const LiftingStepRoute& lhs, const LiftingStepRoute& rhs) noexcept {
+    return lhs.type == rhs.type && lhs.source.slot == rhs.source.slot && lhs.base.slot == rhs.base.slot &&
+           lhs.output.storage == rhs.output.storage && lhs.output.slot == rhs.output.slot &&
+           lhs.source_offset == rhs.source_offset && lhs.base_offset == rhs.base_offset &&
+           lhs.source_left_pad == rhs.source_left_pad;
+}
+
+}  // namespace bucket_detail
+
+/**
+ * Prove that the plan of `bucket.max_length` computes the canonical prefix of
+ * every member length in steps of `length_step`.
+ *
+ * A member reuses the bucket plan when every route keeps the same stream
+ * shifts and local offsets and is nowhere longer: each of its streams is then
+ * a prefix of the bucket stream, computed by the same stencil from the same
+ * extended input samples.
+ */
+template <typename Scheme>
+void validate_lwt_length_bucket(
+    const LengthBucket bucket,
+    const LiftingForwardPlan& bucket_plan,
+    const BoundaryMode boundary_mode,
+    const size_t length_step = 1) {
+    TT_FATAL(length_step > 0, "LWT bucket validation step must be positive");
+    const Pad1DConfig& bucket_pad = bucket_plan.preprocess_layout.pad_config;
+    const size_t first = round_up(bucket.min_length, length_step);
+    for (size_t length = first; length <= bucket.max_length; length += length_step) {
+        const LiftingForwardPlan candidate =
+            make_forward_lifting_plan<Scheme>(SignalBuffer{.length = length}, 0, 0, boundary_mode);
+        const Pad1DConfig& candidate_pad = candidate.preprocess_layout.pad_config;
+        TT_FATAL(
+            candidate_pad.left == bucket_pad.left && candidate_pad.right == bucket_pad.right &&
+                candidate.final_even_shift == bucket_plan.final_even_shift &&
+                candidate.final_odd_shift == bucket_plan.final_odd_shift &&
+                candidate.routes.size() == bucket_plan.routes.size(),
+            "Length {} changes the stream layout of bucket [{}, {}]",
+            length,
+            bucket.min_length,
+            bucket.max_length);
+        for (size_t route_index = 0; route_index < candidate.routes.size(); ++route_index) {
+            TT_FATAL(
+                bucket_detail::same_route_geometry(candidate.routes[route_index], bucket_plan.routes[route_index]) &&
+                    candidate.routes[route_index].output_length <= bucket_plan.routes[route_index].output_length,
+                "Length {} changes bucket route {}",
+                length,
+                route_index);
+        }
+        TT_FATAL(
+            candidate.output_length <= bucket_plan.output_length &&
+                candidate.final_even_length <= bucket_plan.final_even_length &&
+                candidate.final_odd_length <= bucket_plan.final_odd_length,
+            "Length {} produces a longer output than its bucket",
+            length);
+    }
+}
+
+}  // namespace ttnn::operations::wavelet